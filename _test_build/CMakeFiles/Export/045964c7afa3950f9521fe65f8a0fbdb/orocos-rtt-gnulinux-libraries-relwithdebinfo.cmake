@@ -0,0 +1,75 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "RelWithDebInfo".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "imported_rtt-typekit-gnulinux_plugin" for configuration "RelWithDebInfo"
+set_property(TARGET imported_rtt-typekit-gnulinux_plugin APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(imported_rtt-typekit-gnulinux_plugin PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELWITHDEBINFO "imported_orocos-rtt-gnulinux_dynamic"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/orocos/gnulinux/types/librtt-typekit-gnulinux.so.2.8.99"
+  IMPORTED_SONAME_RELWITHDEBINFO "librtt-typekit-gnulinux.so.2.8"
+  )
+
+list(APPEND _cmake_import_check_targets imported_rtt-typekit-gnulinux_plugin )
+list(APPEND _cmake_import_check_files_for_imported_rtt-typekit-gnulinux_plugin "${_IMPORT_PREFIX}/lib/orocos/gnulinux/types/librtt-typekit-gnulinux.so.2.8.99" )
+
+# Import target "imported_rtt-transport-mqueue-gnulinux_plugin" for configuration "RelWithDebInfo"
+set_property(TARGET imported_rtt-transport-mqueue-gnulinux_plugin APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(imported_rtt-transport-mqueue-gnulinux_plugin PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELWITHDEBINFO "imported_orocos-rtt-gnulinux_dynamic;imported_orocos-rtt-mqueue-gnulinux_dynamic"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/orocos/gnulinux/types/librtt-transport-mqueue-gnulinux.so.2.8.99"
+  IMPORTED_SONAME_RELWITHDEBINFO "librtt-transport-mqueue-gnulinux.so.2.8"
+  )
+
+list(APPEND _cmake_import_check_targets imported_rtt-transport-mqueue-gnulinux_plugin )
+list(APPEND _cmake_import_check_files_for_imported_rtt-transport-mqueue-gnulinux_plugin "${_IMPORT_PREFIX}/lib/orocos/gnulinux/types/librtt-transport-mqueue-gnulinux.so.2.8.99" )
+
+# Import target "imported_orocos-rtt-mqueue-gnulinux_dynamic" for configuration "RelWithDebInfo"
+set_property(TARGET imported_orocos-rtt-mqueue-gnulinux_dynamic APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(imported_orocos-rtt-mqueue-gnulinux_dynamic PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELWITHDEBINFO "imported_orocos-rtt-gnulinux_dynamic;/usr/lib/x86_64-linux-gnu/libboost_serialization.so"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/liborocos-rtt-mqueue-gnulinux.so.2.8.99"
+  IMPORTED_SONAME_RELWITHDEBINFO "liborocos-rtt-mqueue-gnulinux.so.2.8"
+  )
+
+list(APPEND _cmake_import_check_targets imported_orocos-rtt-mqueue-gnulinux_dynamic )
+list(APPEND _cmake_import_check_files_for_imported_orocos-rtt-mqueue-gnulinux_dynamic "${_IMPORT_PREFIX}/lib/liborocos-rtt-mqueue-gnulinux.so.2.8.99" )
+
+# Import target "imported_rtt-transport-shm-gnulinux_plugin" for configuration "RelWithDebInfo"
+set_property(TARGET imported_rtt-transport-shm-gnulinux_plugin APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(imported_rtt-transport-shm-gnulinux_plugin PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELWITHDEBINFO "imported_orocos-rtt-gnulinux_dynamic;imported_orocos-rtt-shm-gnulinux_dynamic"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/orocos/gnulinux/types/librtt-transport-shm-gnulinux.so.2.8.99"
+  IMPORTED_SONAME_RELWITHDEBINFO "librtt-transport-shm-gnulinux.so.2.8"
+  )
+
+list(APPEND _cmake_import_check_targets imported_rtt-transport-shm-gnulinux_plugin )
+list(APPEND _cmake_import_check_files_for_imported_rtt-transport-shm-gnulinux_plugin "${_IMPORT_PREFIX}/lib/orocos/gnulinux/types/librtt-transport-shm-gnulinux.so.2.8.99" )
+
+# Import target "imported_orocos-rtt-shm-gnulinux_dynamic" for configuration "RelWithDebInfo"
+set_property(TARGET imported_orocos-rtt-shm-gnulinux_dynamic APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(imported_orocos-rtt-shm-gnulinux_dynamic PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELWITHDEBINFO "imported_orocos-rtt-gnulinux_dynamic;rt"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/liborocos-rtt-shm-gnulinux.so.2.8.99"
+  IMPORTED_SONAME_RELWITHDEBINFO "liborocos-rtt-shm-gnulinux.so.2.8"
+  )
+
+list(APPEND _cmake_import_check_targets imported_orocos-rtt-shm-gnulinux_dynamic )
+list(APPEND _cmake_import_check_files_for_imported_orocos-rtt-shm-gnulinux_dynamic "${_IMPORT_PREFIX}/lib/liborocos-rtt-shm-gnulinux.so.2.8.99" )
+
+# Import target "imported_orocos-rtt-gnulinux_dynamic" for configuration "RelWithDebInfo"
+set_property(TARGET imported_orocos-rtt-gnulinux_dynamic APPEND PROPERTY IMPORTED_CONFIGURATIONS RELWITHDEBINFO)
+set_target_properties(imported_orocos-rtt-gnulinux_dynamic PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELWITHDEBINFO "/usr/lib/x86_64-linux-gnu/libboost_filesystem.so;/usr/lib/x86_64-linux-gnu/libboost_system.so;/usr/lib/x86_64-linux-gnu/libboost_serialization.so;/usr/lib/x86_64-linux-gnu/libpthread.a;rt;dl"
+  IMPORTED_LOCATION_RELWITHDEBINFO "${_IMPORT_PREFIX}/lib/liborocos-rtt-gnulinux.so.2.8.99"
+  IMPORTED_SONAME_RELWITHDEBINFO "liborocos-rtt-gnulinux.so.2.8"
+  )
+
+list(APPEND _cmake_import_check_targets imported_orocos-rtt-gnulinux_dynamic )
+list(APPEND _cmake_import_check_files_for_imported_orocos-rtt-gnulinux_dynamic "${_IMPORT_PREFIX}/lib/liborocos-rtt-gnulinux.so.2.8.99" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
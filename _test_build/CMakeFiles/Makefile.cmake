@@ -0,0 +1,275 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/config/CreatePCFlags.cmake"
+  "/root/repo/config/FindBoost.cmake"
+  "/root/repo/config/FindCorba.cmake"
+  "/root/repo/config/FindPthread.cmake"
+  "/root/repo/config/FindXerces.cmake"
+  "/root/repo/config/LibFindMacros.cmake"
+  "/root/repo/config/SelectOneLibrary.cmake"
+  "/root/repo/config/check_depend.cmake"
+  "/root/repo/config/cmake_uninstall.cmake.in"
+  "/root/repo/config/rtt_macros.cmake"
+  "/root/repo/doc/AnyToPNG.cmake"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/doc/DocBookToHTML.cmake"
+  "/root/repo/doc/DocBookToPDF.cmake"
+  "/root/repo/doc/SvgToPDF.cmake"
+  "/root/repo/doc/xml/catalog.xml.in"
+  "/root/repo/doc/xml/orocos.ent.in"
+  "/root/repo/env-hooks/00.rtt.sh.in"
+  "/root/repo/orocos-rtt-config-version.cmake.in"
+  "/root/repo/orocos-rtt-config.cmake.in"
+  "/root/repo/orocos-rtt.default.cmake"
+  "/root/repo/rtt/CMakeLists.txt"
+  "/root/repo/rtt/base/CMakeLists.txt"
+  "/root/repo/rtt/deployment/CMakeLists.txt"
+  "/root/repo/rtt/deployment/comppath.cpp.in"
+  "/root/repo/rtt/extras/CMakeLists.txt"
+  "/root/repo/rtt/extras/dev/CMakeLists.txt"
+  "/root/repo/rtt/internal/CMakeLists.txt"
+  "/root/repo/rtt/marsh/CMakeLists.txt"
+  "/root/repo/rtt/marsh/rtt-marsh-config.h.in"
+  "/root/repo/rtt/orocos-rtt.pc.in"
+  "/root/repo/rtt/os/CMakeLists.txt"
+  "/root/repo/rtt/os/ecos/CMakeLists.txt"
+  "/root/repo/rtt/os/gnulinux/CMakeLists.txt"
+  "/root/repo/rtt/os/lxrt/CMakeLists.txt"
+  "/root/repo/rtt/os/macosx/CMakeLists.txt"
+  "/root/repo/rtt/os/oro_gcc/CMakeLists.txt"
+  "/root/repo/rtt/os/oro_i386/CMakeLists.txt"
+  "/root/repo/rtt/os/oro_msvc/CMakeLists.txt"
+  "/root/repo/rtt/os/oro_noasm/CMakeLists.txt"
+  "/root/repo/rtt/os/oro_powerpc/CMakeLists.txt"
+  "/root/repo/rtt/os/oro_x86_64/CMakeLists.txt"
+  "/root/repo/rtt/os/targets/CMakeLists.txt"
+  "/root/repo/rtt/os/targets/rtt-target.h.in"
+  "/root/repo/rtt/os/targets/target-config.h.in"
+  "/root/repo/rtt/os/win32/CMakeLists.txt"
+  "/root/repo/rtt/os/xenomai/CMakeLists.txt"
+  "/root/repo/rtt/plugin/CMakeLists.txt"
+  "/root/repo/rtt/plugin/pluginpath.cpp.in"
+  "/root/repo/rtt/rtt-config.h.in"
+  "/root/repo/rtt/scripting/CMakeLists.txt"
+  "/root/repo/rtt/scripting/rtt-scripting-config.h.in"
+  "/root/repo/rtt/transports/corba/CMakeLists.txt"
+  "/root/repo/rtt/transports/mqueue/CMakeLists.txt"
+  "/root/repo/rtt/transports/mqueue/orocos-rtt-mqueue.pc.in"
+  "/root/repo/rtt/transports/mqueue/rtt-mqueue-config.h.in"
+  "/root/repo/rtt/transports/shm/CMakeLists.txt"
+  "/root/repo/rtt/transports/shm/orocos-rtt-shm.pc.in"
+  "/root/repo/rtt/transports/shm/rtt-shm-config.h.in"
+  "/root/repo/rtt/typekit/CMakeLists.txt"
+  "/root/repo/rtt/typekit/rtt-typekit-config.h.in"
+  "/root/repo/rtt/types/CMakeLists.txt"
+  "/root/repo/tests/AddUnitTest.cmake"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/testproject/plugins/CMakeLists.txt"
+  "/root/repo/tests/testproject/types/CMakeLists.txt"
+  "/root/repo/tests/testtypes/types/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "cmake_uninstall.cmake"
+  "orocos-rtt-config-gnulinux.cmake"
+  "orocos-rtt-config-version.cmake"
+  "env-hooks/00.rtt.sh"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/rtt-config.h"
+  "rtt/os/targets/rtt-target.h"
+  "rtt/os/targets/gnulinux-config.h"
+  "rtt/orocos-rtt-gnulinux.pc"
+  "rtt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/gnulinux/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/lxrt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/xenomai/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/ecos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/macosx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/win32/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/oro_i386/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/oro_x86_64/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/oro_powerpc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/oro_msvc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/oro_noasm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/oro_gcc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/os/targets/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/internal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/types/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/typekit/rtt-typekit-config.h"
+  "rtt/typekit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/transports/corba/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/transports/mqueue/orocos-rtt-mqueue-gnulinux.pc"
+  "rtt/transports/mqueue/rtt-mqueue-config.h"
+  "rtt/transports/mqueue/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/transports/shm/orocos-rtt-shm-gnulinux.pc"
+  "rtt/transports/shm/rtt-shm-config.h"
+  "rtt/transports/shm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/scripting/rtt-scripting-config.h"
+  "rtt/scripting/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/marsh/rtt-marsh-config.h"
+  "rtt/marsh/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/plugin/pluginpath.cpp"
+  "rtt/plugin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/deployment/comppath.cpp"
+  "rtt/deployment/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/extras/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rtt/extras/dev/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/xml/catalog.xml"
+  "doc/xml/orocos.ent"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/testproject/plugins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/testproject/types/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/testtypes/types/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/docs.dir/DependInfo.cmake"
+  "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/DependInfo.cmake"
+  "rtt/transports/mqueue/CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/DependInfo.cmake"
+  "rtt/transports/mqueue/CMakeFiles/rtt-transport-mqueue-gnulinux_plugin.dir/DependInfo.cmake"
+  "rtt/transports/shm/CMakeFiles/orocos-rtt-shm-gnulinux_dynamic.dir/DependInfo.cmake"
+  "rtt/transports/shm/CMakeFiles/rtt-transport-shm-gnulinux_plugin.dir/DependInfo.cmake"
+  "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DependInfo.cmake"
+  "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/DependInfo.cmake"
+  "doc/CMakeFiles/docpng.dir/DependInfo.cmake"
+  "doc/CMakeFiles/dochtml.dir/DependInfo.cmake"
+  "doc/CMakeFiles/docpdf.dir/DependInfo.cmake"
+  "doc/CMakeFiles/message.dir/DependInfo.cmake"
+  "tests/CMakeFiles/fixtures.dir/DependInfo.cmake"
+  "tests/CMakeFiles/SetupTests.dir/DependInfo.cmake"
+  "tests/CMakeFiles/main-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/list-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/core-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/task-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/specactivities-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mqueue-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/mqueue_archive_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/shm-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/buffers_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/method_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/remote_method_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/functors_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/service_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/service_port_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/event_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/operation_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/operation_performance_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/taskstates_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/channelelements_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ports_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/dataflow_performance_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/dataobject_performance_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/configuration_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/slave_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/scripting_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/types_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/program_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/state_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/rtstring_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/tlsf_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/function_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/enum_type_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/enum_string_type_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/marshalling_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/property_loader_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/property_marsh_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/property_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/property_composition_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/type_discovery_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/type_discovery_struct_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/type_discovery_container_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/datasource_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/typekit_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/plugins_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check.dir/DependInfo.cmake"
+  "tests/testproject/plugins/CMakeFiles/service_plugin.dir/DependInfo.cmake"
+  "tests/testproject/plugins/CMakeFiles/global_service_plugin.dir/DependInfo.cmake"
+  "tests/testproject/types/CMakeFiles/typekit_plugin.dir/DependInfo.cmake"
+  "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/DependInfo.cmake"
+  )
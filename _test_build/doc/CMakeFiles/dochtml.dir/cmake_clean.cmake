@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dochtml"
+  "xml/orocos-components-manual.html"
+  "xml/orocos-faq.html"
+  "xml/orocos-html.css"
+  "xml/orocos-installation.html"
+  "xml/orocos-ocl-intro.html"
+  "xml/orocos-overview.html"
+  "xml/orocos-rtt-changes.html"
+  "xml/orocos-rtt-plugins.html"
+  "xml/orocos-transports-corba.html"
+  "xml/orocos-transports-mqueue.html"
+  "xml/orocos-typekit-plugin.html"
+  "xml/orocos-user-manual.html"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/dochtml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
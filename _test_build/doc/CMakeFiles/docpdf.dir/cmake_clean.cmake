@@ -0,0 +1,22 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/docpdf"
+  "orocos_cheat_sheet.pdf"
+  "rtt_cheat_sheet.pdf"
+  "xml/orocos-components-manual.pdf"
+  "xml/orocos-installation.pdf"
+  "xml/orocos-ocl-intro.pdf"
+  "xml/orocos-overview.pdf"
+  "xml/orocos-rtt-changes.pdf"
+  "xml/orocos-rtt-plugins.pdf"
+  "xml/orocos-transports-corba.pdf"
+  "xml/orocos-transports-mqueue.pdf"
+  "xml/orocos-typekit-plugin.pdf"
+  "xml/orocos-user-manual.pdf"
+  "xml/orocos_cheat_sheet.pdf"
+  "xml/rtt_cheat_sheet.pdf"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/docpdf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
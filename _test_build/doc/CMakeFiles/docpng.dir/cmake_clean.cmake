@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/docpng"
+  "xml/images/ATaskContext-basic.png"
+  "xml/images/ATaskContext-basics.png"
+  "xml/images/ATaskContext-plugins.png"
+  "xml/images/ATaskContext-properties.png"
+  "xml/images/ATaskContext-services.png"
+  "xml/images/ATaskContext.png"
+  "xml/images/AnalogMeter.png"
+  "xml/images/ApplicationStack.png"
+  "xml/images/ApplicationStack2.png"
+  "xml/images/AutomaticState.png"
+  "xml/images/ComponentArch-3.png"
+  "xml/images/ComponentFlows.png"
+  "xml/images/ComponentImplementation.png"
+  "xml/images/ComponentInterface.png"
+  "xml/images/ComponentStates.png"
+  "xml/images/ComponentStatesExtended.png"
+  "xml/images/ComponentTriggering.png"
+  "xml/images/CoreVsContext.png"
+  "xml/images/DataFlowPorts.png"
+  "xml/images/DeploymentLevels.png"
+  "xml/images/FDIvsFOSI.png"
+  "xml/images/FrameworkOverview.png"
+  "xml/images/HelloDeployment.png"
+  "xml/images/HelloWorld.png"
+  "xml/images/MachineStates.png"
+  "xml/images/Meter_1.png"
+  "xml/images/ProgramStates.png"
+  "xml/images/ProgramTransitions.png"
+  "xml/images/RTT_KDL_BFL_400.png"
+  "xml/images/RTT_KDL_BFL_fill.png"
+  "xml/images/ReactiveState.png"
+  "xml/images/RealTimeToolkit.png"
+  "xml/images/RunTimeStates.png"
+  "xml/images/SimpleLogo.png"
+  "xml/images/StateTransitions.png"
+  "xml/images/TaskContextExecution.png"
+  "xml/images/TaskPeers2.png"
+  "xml/images/UpdateStepDetail.png"
+  "xml/images/app-directories.png"
+  "xml/images/fdi.png"
+  "xml/images/front-logos2.png"
+  "xml/images/gear-image.png"
+  "xml/images/icons/caution.png"
+  "xml/images/icons/home.png"
+  "xml/images/icons/important.png"
+  "xml/images/icons/next.png"
+  "xml/images/icons/note.png"
+  "xml/images/icons/prev.png"
+  "xml/images/icons/tip.png"
+  "xml/images/icons/up.png"
+  "xml/images/icons/warning.png"
+  "xml/images/properties.png"
+  "xml/images/red-car.png"
+  "xml/images/robot.png"
+  "xml/images/scriptingExample.png"
+  "xml/images/services-and-operations.png"
+  "xml/images/services-and-requests.png"
+  "xml/images/small-app-package.png"
+  "xml/images/toolkit.png"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/docpng.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/message"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/message.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
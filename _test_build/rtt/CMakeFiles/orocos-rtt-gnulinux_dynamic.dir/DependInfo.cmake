@@ -0,0 +1,132 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/rtt/os/gnulinux/fosi.c" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/fosi.c.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/fosi.c.o.d"
+  "/root/repo/rtt/os/tlsf/tlsf.c" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/tlsf/tlsf.c.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/tlsf/tlsf.c.o.d"
+  "/root/repo/rtt/Activity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Activity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Activity.cpp.o.d"
+  "/root/repo/rtt/ArgumentDescription.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ArgumentDescription.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ArgumentDescription.cpp.o.d"
+  "/root/repo/rtt/Attribute.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Attribute.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Attribute.cpp.o.d"
+  "/root/repo/rtt/BinaryLog.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/BinaryLog.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/BinaryLog.cpp.o.d"
+  "/root/repo/rtt/BufferPolicy.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/BufferPolicy.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/BufferPolicy.cpp.o.d"
+  "/root/repo/rtt/ConfigurationInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ConfigurationInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ConfigurationInterface.cpp.o.d"
+  "/root/repo/rtt/ConnPolicy.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ConnPolicy.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ConnPolicy.cpp.o.d"
+  "/root/repo/rtt/DataFlowInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DataFlowInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DataFlowInterface.cpp.o.d"
+  "/root/repo/rtt/ExecutionEngine.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ExecutionEngine.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ExecutionEngine.cpp.o.d"
+  "/root/repo/rtt/FactoryExceptions.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/FactoryExceptions.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/FactoryExceptions.cpp.o.d"
+  "/root/repo/rtt/FlowStatus.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/FlowStatus.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/FlowStatus.cpp.o.d"
+  "/root/repo/rtt/Handle.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Handle.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Handle.cpp.o.d"
+  "/root/repo/rtt/Logger.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Logger.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Logger.cpp.o.d"
+  "/root/repo/rtt/Operation.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Operation.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Operation.cpp.o.d"
+  "/root/repo/rtt/OperationInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/OperationInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/OperationInterface.cpp.o.d"
+  "/root/repo/rtt/Property.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Property.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Property.cpp.o.d"
+  "/root/repo/rtt/PropertyBag.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/PropertyBag.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/PropertyBag.cpp.o.d"
+  "/root/repo/rtt/SendStatus.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/SendStatus.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/SendStatus.cpp.o.d"
+  "/root/repo/rtt/Service.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Service.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Service.cpp.o.d"
+  "/root/repo/rtt/ServiceRequester.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ServiceRequester.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ServiceRequester.cpp.o.d"
+  "/root/repo/rtt/TaskContext.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/TaskContext.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/TaskContext.cpp.o.d"
+  "/root/repo/rtt/base/ActionInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ActionInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ActionInterface.cpp.o.d"
+  "/root/repo/rtt/base/ActivityInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ActivityInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ActivityInterface.cpp.o.d"
+  "/root/repo/rtt/base/BufferBase.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferBase.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferBase.cpp.o.d"
+  "/root/repo/rtt/base/BufferLockFree.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferLockFree.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferLockFree.cpp.o.d"
+  "/root/repo/rtt/base/BufferSPSC.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferSPSC.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferSPSC.cpp.o.d"
+  "/root/repo/rtt/base/ChannelInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ChannelInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ChannelInterface.cpp.o.d"
+  "/root/repo/rtt/base/CoreRunnableInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/CoreRunnableInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/CoreRunnableInterface.cpp.o.d"
+  "/root/repo/rtt/base/DataObjectBase.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/DataObjectBase.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/DataObjectBase.cpp.o.d"
+  "/root/repo/rtt/base/InputPortInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/InputPortInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/InputPortInterface.cpp.o.d"
+  "/root/repo/rtt/base/OperationBase.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OperationBase.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OperationBase.cpp.o.d"
+  "/root/repo/rtt/base/OperationCallerInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OperationCallerInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OperationCallerInterface.cpp.o.d"
+  "/root/repo/rtt/base/OutputPortInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OutputPortInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OutputPortInterface.cpp.o.d"
+  "/root/repo/rtt/base/PortInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PortInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PortInterface.cpp.o.d"
+  "/root/repo/rtt/base/PropertyBagVisitor.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PropertyBagVisitor.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PropertyBagVisitor.cpp.o.d"
+  "/root/repo/rtt/base/PropertyBase.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PropertyBase.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PropertyBase.cpp.o.d"
+  "/root/repo/rtt/base/TaskCore.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/TaskCore.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/TaskCore.cpp.o.d"
+  "/root/repo/rtt/deployment/ComponentLoader.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/deployment/ComponentLoader.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/deployment/ComponentLoader.cpp.o.d"
+  "/root/repo/_test_build/rtt/deployment/comppath.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/deployment/comppath.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/deployment/comppath.cpp.o.d"
+  "/root/repo/rtt/extras/FileDescriptorActivity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/FileDescriptorActivity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/FileDescriptorActivity.cpp.o.d"
+  "/root/repo/rtt/extras/FileDescriptorSimulationActivity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/FileDescriptorSimulationActivity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/FileDescriptorSimulationActivity.cpp.o.d"
+  "/root/repo/rtt/extras/IRQActivity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/IRQActivity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/IRQActivity.cpp.o.d"
+  "/root/repo/rtt/extras/MultiVector.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/MultiVector.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/MultiVector.cpp.o.d"
+  "/root/repo/rtt/extras/PeriodicActivity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/PeriodicActivity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/PeriodicActivity.cpp.o.d"
+  "/root/repo/rtt/extras/PoolScheduler.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/PoolScheduler.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/PoolScheduler.cpp.o.d"
+  "/root/repo/rtt/extras/SequentialActivity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SequentialActivity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SequentialActivity.cpp.o.d"
+  "/root/repo/rtt/extras/SimulationActivity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SimulationActivity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SimulationActivity.cpp.o.d"
+  "/root/repo/rtt/extras/SimulationThread.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SimulationThread.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SimulationThread.cpp.o.d"
+  "/root/repo/rtt/extras/SlaveActivity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SlaveActivity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SlaveActivity.cpp.o.d"
+  "/root/repo/rtt/extras/ThreadPoolActivity.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/ThreadPoolActivity.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/ThreadPoolActivity.cpp.o.d"
+  "/root/repo/rtt/extras/TimerThread.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/TimerThread.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/TimerThread.cpp.o.d"
+  "/root/repo/rtt/internal/CatchConfig.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/CatchConfig.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/CatchConfig.cpp.o.d"
+  "/root/repo/rtt/internal/ConnFactory.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnFactory.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnFactory.cpp.o.d"
+  "/root/repo/rtt/internal/ConnID.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnID.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnID.cpp.o.d"
+  "/root/repo/rtt/internal/ConnectionManager.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnectionManager.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnectionManager.cpp.o.d"
+  "/root/repo/rtt/internal/ConnectionStatistics.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnectionStatistics.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnectionStatistics.cpp.o.d"
+  "/root/repo/rtt/internal/DataSource.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSource.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSource.cpp.o.d"
+  "/root/repo/rtt/internal/DataSourceCommand.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSourceCommand.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSourceCommand.cpp.o.d"
+  "/root/repo/rtt/internal/DataSources.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSources.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSources.cpp.o.d"
+  "/root/repo/rtt/internal/GlobalEngine.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/GlobalEngine.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/GlobalEngine.cpp.o.d"
+  "/root/repo/rtt/internal/GlobalService.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/GlobalService.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/GlobalService.cpp.o.d"
+  "/root/repo/rtt/internal/ListLockFree.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ListLockFree.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ListLockFree.cpp.o.d"
+  "/root/repo/rtt/internal/OperationCallerC.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/OperationCallerC.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/OperationCallerC.cpp.o.d"
+  "/root/repo/rtt/internal/OperationInterfacePartFused.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/OperationInterfacePartFused.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/OperationInterfacePartFused.cpp.o.d"
+  "/root/repo/rtt/internal/SegmentedMWSRQueue.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SegmentedMWSRQueue.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SegmentedMWSRQueue.cpp.o.d"
+  "/root/repo/rtt/internal/SendHandleC.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SendHandleC.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SendHandleC.cpp.o.d"
+  "/root/repo/rtt/internal/SharedConnection.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SharedConnection.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SharedConnection.cpp.o.d"
+  "/root/repo/rtt/internal/SignalBase.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SignalBase.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SignalBase.cpp.o.d"
+  "/root/repo/rtt/os/CpuSet.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/CpuSet.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/CpuSet.cpp.o.d"
+  "/root/repo/rtt/os/MainThread.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/MainThread.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/MainThread.cpp.o.d"
+  "/root/repo/rtt/os/Mutex.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Mutex.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Mutex.cpp.o.d"
+  "/root/repo/rtt/os/StartStopManager.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/StartStopManager.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/StartStopManager.cpp.o.d"
+  "/root/repo/rtt/os/Thread.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Thread.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Thread.cpp.o.d"
+  "/root/repo/rtt/os/ThreadInterface.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/ThreadInterface.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/ThreadInterface.cpp.o.d"
+  "/root/repo/rtt/os/ThreadStatistics.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/ThreadStatistics.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/ThreadStatistics.cpp.o.d"
+  "/root/repo/rtt/os/TimeService.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/TimeService.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/TimeService.cpp.o.d"
+  "/root/repo/rtt/os/Timer.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Timer.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Timer.cpp.o.d"
+  "/root/repo/rtt/os/exceptions.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/exceptions.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/exceptions.cpp.o.d"
+  "/root/repo/rtt/os/gnulinux/fosi_internal.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/fosi_internal.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/fosi_internal.cpp.o.d"
+  "/root/repo/rtt/os/gnulinux/gnuthreads.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/gnuthreads.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/gnuthreads.cpp.o.d"
+  "/root/repo/rtt/os/rint.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rint.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rint.cpp.o.d"
+  "/root/repo/rtt/os/rtconversions.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rtconversions.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rtconversions.cpp.o.d"
+  "/root/repo/rtt/os/rtstreams.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rtstreams.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rtstreams.cpp.o.d"
+  "/root/repo/rtt/os/startstop.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/startstop.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/startstop.cpp.o.d"
+  "/root/repo/rtt/os/threads.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/threads.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/threads.cpp.o.d"
+  "/root/repo/rtt/plugin/Plugin.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/Plugin.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/Plugin.cpp.o.d"
+  "/root/repo/rtt/plugin/PluginLoader.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/PluginLoader.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/PluginLoader.cpp.o.d"
+  "/root/repo/_test_build/rtt/plugin/pluginpath.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/pluginpath.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/pluginpath.cpp.o.d"
+  "/root/repo/rtt/rt_string.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/rt_string.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/rt_string.cpp.o.d"
+  "/root/repo/rtt/types/CompositionFactory.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/CompositionFactory.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/CompositionFactory.cpp.o.d"
+  "/root/repo/rtt/types/GlobalsRepository.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/GlobalsRepository.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/GlobalsRepository.cpp.o.d"
+  "/root/repo/rtt/types/MemberFactory.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/MemberFactory.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/MemberFactory.cpp.o.d"
+  "/root/repo/rtt/types/Operators.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/Operators.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/Operators.cpp.o.d"
+  "/root/repo/rtt/types/PropertyComposition.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/PropertyComposition.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/PropertyComposition.cpp.o.d"
+  "/root/repo/rtt/types/PropertyDecomposition.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/PropertyDecomposition.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/PropertyDecomposition.cpp.o.d"
+  "/root/repo/rtt/types/SequenceTypeInfoBase.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/SequenceTypeInfoBase.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/SequenceTypeInfoBase.cpp.o.d"
+  "/root/repo/rtt/types/StreamFactory.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/StreamFactory.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/StreamFactory.cpp.o.d"
+  "/root/repo/rtt/types/TypeConstructor.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeConstructor.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeConstructor.cpp.o.d"
+  "/root/repo/rtt/types/TypeInfo.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeInfo.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeInfo.cpp.o.d"
+  "/root/repo/rtt/types/TypeInfoRepository.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeInfoRepository.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeInfoRepository.cpp.o.d"
+  "/root/repo/rtt/types/TypeStream-io.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeStream-io.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeStream-io.cpp.o.d"
+  "/root/repo/rtt/types/TypeStream.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeStream.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeStream.cpp.o.d"
+  "/root/repo/rtt/types/TypekitRepository.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypekitRepository.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypekitRepository.cpp.o.d"
+  "/root/repo/rtt/types/Types.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/Types.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/Types.cpp.o.d"
+  "/root/repo/rtt/types/ValueFactory.cpp" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/ValueFactory.cpp.o" "gcc" "rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/ValueFactory.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/rtt/liborocos-rtt-gnulinux.so" "/root/repo/_test_build/rtt/liborocos-rtt-gnulinux.so.2.8.99"
+  "/root/repo/_test_build/rtt/liborocos-rtt-gnulinux.so.2.8" "/root/repo/_test_build/rtt/liborocos-rtt-gnulinux.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
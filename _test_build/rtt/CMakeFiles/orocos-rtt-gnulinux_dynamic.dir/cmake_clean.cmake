@@ -0,0 +1,225 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Activity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Activity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ArgumentDescription.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ArgumentDescription.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Attribute.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Attribute.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/BinaryLog.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/BinaryLog.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/BufferPolicy.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/BufferPolicy.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ConfigurationInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ConfigurationInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ConnPolicy.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ConnPolicy.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DataFlowInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DataFlowInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ExecutionEngine.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ExecutionEngine.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/FactoryExceptions.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/FactoryExceptions.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/FlowStatus.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/FlowStatus.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Handle.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Handle.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Logger.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Logger.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Operation.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Operation.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/OperationInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/OperationInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Property.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Property.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/PropertyBag.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/PropertyBag.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/SendStatus.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/SendStatus.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Service.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/Service.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ServiceRequester.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/ServiceRequester.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/TaskContext.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/TaskContext.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ActionInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ActionInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ActivityInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ActivityInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferBase.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferBase.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferLockFree.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferLockFree.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferSPSC.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/BufferSPSC.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ChannelInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/ChannelInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/CoreRunnableInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/CoreRunnableInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/DataObjectBase.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/DataObjectBase.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/InputPortInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/InputPortInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OperationBase.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OperationBase.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OperationCallerInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OperationCallerInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OutputPortInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/OutputPortInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PortInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PortInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PropertyBagVisitor.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PropertyBagVisitor.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PropertyBase.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/PropertyBase.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/TaskCore.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/base/TaskCore.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/deployment/ComponentLoader.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/deployment/ComponentLoader.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/deployment/comppath.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/deployment/comppath.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/FileDescriptorActivity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/FileDescriptorActivity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/FileDescriptorSimulationActivity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/FileDescriptorSimulationActivity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/IRQActivity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/IRQActivity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/MultiVector.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/MultiVector.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/PeriodicActivity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/PeriodicActivity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/PoolScheduler.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/PoolScheduler.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SequentialActivity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SequentialActivity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SimulationActivity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SimulationActivity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SimulationThread.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SimulationThread.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SlaveActivity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/SlaveActivity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/ThreadPoolActivity.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/ThreadPoolActivity.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/TimerThread.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/extras/TimerThread.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/CatchConfig.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/CatchConfig.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnFactory.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnFactory.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnID.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnID.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnectionManager.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnectionManager.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnectionStatistics.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ConnectionStatistics.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSource.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSource.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSourceCommand.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSourceCommand.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSources.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/DataSources.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/GlobalEngine.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/GlobalEngine.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/GlobalService.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/GlobalService.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ListLockFree.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/ListLockFree.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/OperationCallerC.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/OperationCallerC.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/OperationInterfacePartFused.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/OperationInterfacePartFused.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SegmentedMWSRQueue.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SegmentedMWSRQueue.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SendHandleC.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SendHandleC.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SharedConnection.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SharedConnection.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SignalBase.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/internal/SignalBase.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/CpuSet.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/CpuSet.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/MainThread.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/MainThread.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Mutex.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Mutex.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/StartStopManager.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/StartStopManager.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Thread.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Thread.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/ThreadInterface.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/ThreadInterface.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/ThreadStatistics.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/ThreadStatistics.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/TimeService.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/TimeService.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Timer.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/Timer.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/exceptions.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/exceptions.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/fosi.c.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/fosi.c.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/fosi_internal.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/fosi_internal.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/gnuthreads.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/gnulinux/gnuthreads.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rint.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rint.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rtconversions.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rtconversions.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rtstreams.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/rtstreams.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/startstop.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/startstop.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/threads.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/threads.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/tlsf/tlsf.c.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/os/tlsf/tlsf.c.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/Plugin.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/Plugin.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/PluginLoader.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/PluginLoader.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/pluginpath.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/plugin/pluginpath.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/rt_string.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/rt_string.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/CompositionFactory.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/CompositionFactory.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/GlobalsRepository.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/GlobalsRepository.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/MemberFactory.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/MemberFactory.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/Operators.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/Operators.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/PropertyComposition.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/PropertyComposition.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/PropertyDecomposition.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/PropertyDecomposition.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/SequenceTypeInfoBase.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/SequenceTypeInfoBase.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/StreamFactory.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/StreamFactory.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeConstructor.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeConstructor.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeInfo.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeInfo.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeInfoRepository.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeInfoRepository.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeStream-io.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeStream-io.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeStream.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypeStream.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypekitRepository.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/TypekitRepository.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/Types.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/Types.cpp.o.d"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/ValueFactory.cpp.o"
+  "CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/types/ValueFactory.cpp.o.d"
+  "liborocos-rtt-gnulinux.pdb"
+  "liborocos-rtt-gnulinux.so"
+  "liborocos-rtt-gnulinux.so.2.8"
+  "liborocos-rtt-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/rtt
+# Build directory: /root/repo/_test_build/rtt
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("os")
+subdirs("base")
+subdirs("internal")
+subdirs("types")
+subdirs("typekit")
+subdirs("transports/corba")
+subdirs("transports/mqueue")
+subdirs("transports/shm")
+subdirs("scripting")
+subdirs("marsh")
+subdirs("plugin")
+subdirs("deployment")
+subdirs("extras")
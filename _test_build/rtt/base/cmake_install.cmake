@@ -0,0 +1,86 @@
+# Install script for directory: /root/repo/rtt/base
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/base" TYPE FILE FILES
+    "/root/repo/rtt/base/ActionInterface.hpp"
+    "/root/repo/rtt/base/ActivityInterface.hpp"
+    "/root/repo/rtt/base/AttributeBase.hpp"
+    "/root/repo/rtt/base/Buffer.hpp"
+    "/root/repo/rtt/base/BufferBase.hpp"
+    "/root/repo/rtt/base/BufferInterface.hpp"
+    "/root/repo/rtt/base/BufferLockFree.hpp"
+    "/root/repo/rtt/base/BufferLocked.hpp"
+    "/root/repo/rtt/base/BufferSPSC.hpp"
+    "/root/repo/rtt/base/BufferUnSync.hpp"
+    "/root/repo/rtt/base/Buffers.hpp"
+    "/root/repo/rtt/base/ChannelElement.hpp"
+    "/root/repo/rtt/base/ChannelElementBase.hpp"
+    "/root/repo/rtt/base/DataObject.hpp"
+    "/root/repo/rtt/base/DataObjectBase.hpp"
+    "/root/repo/rtt/base/DataObjectInterface.hpp"
+    "/root/repo/rtt/base/DataObjectLockFree.hpp"
+    "/root/repo/rtt/base/DataObjectLocked.hpp"
+    "/root/repo/rtt/base/DataObjectSeqLock.hpp"
+    "/root/repo/rtt/base/DataObjectUnSync.hpp"
+    "/root/repo/rtt/base/DataSourceBase.hpp"
+    "/root/repo/rtt/base/DisposableInterface.hpp"
+    "/root/repo/rtt/base/ExecutableInterface.hpp"
+    "/root/repo/rtt/base/InputPortInterface.hpp"
+    "/root/repo/rtt/base/OperationBase.hpp"
+    "/root/repo/rtt/base/OperationCallerBase.hpp"
+    "/root/repo/rtt/base/OperationCallerBaseInvoker.hpp"
+    "/root/repo/rtt/base/OperationCallerInterface.hpp"
+    "/root/repo/rtt/base/OutputPortInterface.hpp"
+    "/root/repo/rtt/base/PortInterface.hpp"
+    "/root/repo/rtt/base/PropertyBagVisitor.hpp"
+    "/root/repo/rtt/base/PropertyBase.hpp"
+    "/root/repo/rtt/base/PropertyIntrospection.hpp"
+    "/root/repo/rtt/base/PropertyIntrospection.inl"
+    "/root/repo/rtt/base/RunnableInterface.hpp"
+    "/root/repo/rtt/base/TaskCore.hpp"
+    "/root/repo/rtt/base/rtt-base-fwd.hpp"
+    )
+endif()
+
@@ -0,0 +1,158 @@
+# Install script for directory: /root/repo/rtt
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt" TYPE FILE FILES
+    "/root/repo/rtt/Activity.hpp"
+    "/root/repo/rtt/ArgumentDescription.hpp"
+    "/root/repo/rtt/Attribute.hpp"
+    "/root/repo/rtt/BinaryLog.hpp"
+    "/root/repo/rtt/BufferPolicy.hpp"
+    "/root/repo/rtt/Component.hpp"
+    "/root/repo/rtt/ConfigurationInterface.hpp"
+    "/root/repo/rtt/ConnPolicy.hpp"
+    "/root/repo/rtt/DataFlowInterface.hpp"
+    "/root/repo/rtt/ExecutionEngine.hpp"
+    "/root/repo/rtt/FactoryExceptions.hpp"
+    "/root/repo/rtt/FlowStatus.hpp"
+    "/root/repo/rtt/Handle.hpp"
+    "/root/repo/rtt/InputPort.hpp"
+    "/root/repo/rtt/Logger.hpp"
+    "/root/repo/rtt/Logger.inl"
+    "/root/repo/rtt/Operation.hpp"
+    "/root/repo/rtt/OperationCaller.hpp"
+    "/root/repo/rtt/OperationInterface.hpp"
+    "/root/repo/rtt/OperationInterfacePart.hpp"
+    "/root/repo/rtt/OutputPort.hpp"
+    "/root/repo/rtt/Port.hpp"
+    "/root/repo/rtt/Property.hpp"
+    "/root/repo/rtt/PropertyBag.hpp"
+    "/root/repo/rtt/RTT.hpp"
+    "/root/repo/rtt/SendHandle.hpp"
+    "/root/repo/rtt/SendStatus.hpp"
+    "/root/repo/rtt/Service.hpp"
+    "/root/repo/rtt/ServiceRequester.hpp"
+    "/root/repo/rtt/TaskContext.hpp"
+    "/root/repo/rtt/Time.hpp"
+    "/root/repo/rtt/rt_string.hpp"
+    "/root/repo/rtt/rtt-detail-fwd.hpp"
+    "/root/repo/rtt/rtt-fwd.hpp"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt" TYPE FILE FILES "/root/repo/_test_build/rtt/rtt-config.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/os/tlsf" TYPE FILE FILES "/root/repo/rtt/os/tlsf/tlsf.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/pkgconfig" TYPE FILE FILES "/root/repo/_test_build/rtt/orocos-rtt-gnulinux.pc")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so.2.8.99"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so.2.8"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_test_build/rtt/liborocos-rtt-gnulinux.so.2.8.99"
+    "/root/repo/_test_build/rtt/liborocos-rtt-gnulinux.so.2.8"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so.2.8.99"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so.2.8"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_test_build/rtt/liborocos-rtt-gnulinux.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/liborocos-rtt-gnulinux.so")
+    endif()
+  endif()
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_test_build/rtt/os/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/base/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/internal/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/types/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/typekit/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/transports/corba/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/transports/mqueue/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/transports/shm/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/scripting/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/marsh/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/plugin/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/deployment/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/extras/cmake_install.cmake")
+
+endif()
+
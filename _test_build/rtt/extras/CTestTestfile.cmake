@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/rtt/extras
+# Build directory: /root/repo/_test_build/rtt/extras
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("dev")
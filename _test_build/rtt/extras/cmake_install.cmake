@@ -0,0 +1,76 @@
+# Install script for directory: /root/repo/rtt/extras
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/extras" TYPE FILE FILES
+    "/root/repo/rtt/extras/Activities.hpp"
+    "/root/repo/rtt/extras/Execution.hpp"
+    "/root/repo/rtt/extras/FileDescriptorActivity.hpp"
+    "/root/repo/rtt/extras/FileDescriptorActivityInterface.hpp"
+    "/root/repo/rtt/extras/FileDescriptorSimulationActivity.hpp"
+    "/root/repo/rtt/extras/IRQActivity.hpp"
+    "/root/repo/rtt/extras/MultiVector.hpp"
+    "/root/repo/rtt/extras/MultiVectorComposition.hpp"
+    "/root/repo/rtt/extras/Orocos.Main.hpp"
+    "/root/repo/rtt/extras/PeriodicActivity.hpp"
+    "/root/repo/rtt/extras/PoolScheduler.hpp"
+    "/root/repo/rtt/extras/Properties.hpp"
+    "/root/repo/rtt/extras/ReadOnlyPointer.hpp"
+    "/root/repo/rtt/extras/SequentialActivity.hpp"
+    "/root/repo/rtt/extras/SimulationActivity.hpp"
+    "/root/repo/rtt/extras/SimulationThread.hpp"
+    "/root/repo/rtt/extras/SlaveActivity.hpp"
+    "/root/repo/rtt/extras/TaskContexts.hpp"
+    "/root/repo/rtt/extras/ThreadPoolActivity.hpp"
+    "/root/repo/rtt/extras/TimerThread.hpp"
+    "/root/repo/rtt/extras/rtt-extras-fwd.hpp"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_test_build/rtt/extras/dev/cmake_install.cmake")
+
+endif()
+
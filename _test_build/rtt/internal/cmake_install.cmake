@@ -0,0 +1,138 @@
+# Install script for directory: /root/repo/rtt/internal
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/internal" TYPE FILE FILES
+    "/root/repo/rtt/internal/ArrayPartDataSource.hpp"
+    "/root/repo/rtt/internal/AssignCommand.hpp"
+    "/root/repo/rtt/internal/AtomicMWMRQueue.hpp"
+    "/root/repo/rtt/internal/AtomicMWSRQueue.hpp"
+    "/root/repo/rtt/internal/AtomicQueue.hpp"
+    "/root/repo/rtt/internal/BindStorage.hpp"
+    "/root/repo/rtt/internal/CatchConfig.hpp"
+    "/root/repo/rtt/internal/ChannelBufferElement.hpp"
+    "/root/repo/rtt/internal/ChannelDataElement.hpp"
+    "/root/repo/rtt/internal/ChannelStatisticsElement.hpp"
+    "/root/repo/rtt/internal/ChannelZeroCopyElement.hpp"
+    "/root/repo/rtt/internal/Channels.hpp"
+    "/root/repo/rtt/internal/Collect.hpp"
+    "/root/repo/rtt/internal/CollectBase.hpp"
+    "/root/repo/rtt/internal/CollectSignature.hpp"
+    "/root/repo/rtt/internal/ConnFactory.hpp"
+    "/root/repo/rtt/internal/ConnID.hpp"
+    "/root/repo/rtt/internal/ConnInputEndPoint.hpp"
+    "/root/repo/rtt/internal/ConnOutputEndPoint.hpp"
+    "/root/repo/rtt/internal/ConnectionManager.hpp"
+    "/root/repo/rtt/internal/ConnectionStatistics.hpp"
+    "/root/repo/rtt/internal/CreateSequence.hpp"
+    "/root/repo/rtt/internal/DataObjectDataSource.hpp"
+    "/root/repo/rtt/internal/DataSource.hpp"
+    "/root/repo/rtt/internal/DataSource.inl"
+    "/root/repo/rtt/internal/DataSourceCommand.hpp"
+    "/root/repo/rtt/internal/DataSourceGenerator.hpp"
+    "/root/repo/rtt/internal/DataSourceStorage.hpp"
+    "/root/repo/rtt/internal/DataSourceTypeInfo.hpp"
+    "/root/repo/rtt/internal/DataSourceTypeInfo.inl"
+    "/root/repo/rtt/internal/DataSources.hpp"
+    "/root/repo/rtt/internal/DataSources.inl"
+    "/root/repo/rtt/internal/Exceptions.hpp"
+    "/root/repo/rtt/internal/FusedFunctorDataSource.hpp"
+    "/root/repo/rtt/internal/GetSignature.hpp"
+    "/root/repo/rtt/internal/GlobalEngine.hpp"
+    "/root/repo/rtt/internal/GlobalService.hpp"
+    "/root/repo/rtt/internal/InputPortSource.hpp"
+    "/root/repo/rtt/internal/Invoker.hpp"
+    "/root/repo/rtt/internal/InvokerBase.hpp"
+    "/root/repo/rtt/internal/InvokerSignature.hpp"
+    "/root/repo/rtt/internal/List.hpp"
+    "/root/repo/rtt/internal/ListLockFree.hpp"
+    "/root/repo/rtt/internal/ListLocked.hpp"
+    "/root/repo/rtt/internal/LocalOperationCaller.hpp"
+    "/root/repo/rtt/internal/LockedQueue.hpp"
+    "/root/repo/rtt/internal/MWSRQueue.hpp"
+    "/root/repo/rtt/internal/NA.hpp"
+    "/root/repo/rtt/internal/OperationCallerBinder.hpp"
+    "/root/repo/rtt/internal/OperationCallerC.hpp"
+    "/root/repo/rtt/internal/OperationInterfacePartFused.hpp"
+    "/root/repo/rtt/internal/PartDataSource.hpp"
+    "/root/repo/rtt/internal/PortConnectionLock.hpp"
+    "/root/repo/rtt/internal/Processors.hpp"
+    "/root/repo/rtt/internal/Queue.hpp"
+    "/root/repo/rtt/internal/Reference.hpp"
+    "/root/repo/rtt/internal/RemoteOperationCaller.hpp"
+    "/root/repo/rtt/internal/Return.hpp"
+    "/root/repo/rtt/internal/ReturnBase.hpp"
+    "/root/repo/rtt/internal/ReturnSignature.hpp"
+    "/root/repo/rtt/internal/SegmentedMWSRQueue.hpp"
+    "/root/repo/rtt/internal/SendHandleC.hpp"
+    "/root/repo/rtt/internal/SharedConnection.hpp"
+    "/root/repo/rtt/internal/SharedSample.hpp"
+    "/root/repo/rtt/internal/Signal.hpp"
+    "/root/repo/rtt/internal/SignalBase.hpp"
+    "/root/repo/rtt/internal/TsPool.hpp"
+    "/root/repo/rtt/internal/UnMember.hpp"
+    "/root/repo/rtt/internal/carray.hpp"
+    "/root/repo/rtt/internal/mystd.hpp"
+    "/root/repo/rtt/internal/rtt-internal-fwd.hpp"
+    "/root/repo/rtt/internal/signal0.hpp"
+    "/root/repo/rtt/internal/signal1.hpp"
+    "/root/repo/rtt/internal/signal2.hpp"
+    "/root/repo/rtt/internal/signal3.hpp"
+    "/root/repo/rtt/internal/signal4.hpp"
+    "/root/repo/rtt/internal/signal5.hpp"
+    "/root/repo/rtt/internal/signal6.hpp"
+    "/root/repo/rtt/internal/signal7.hpp"
+    "/root/repo/rtt/internal/signal_template.hpp"
+    "/root/repo/rtt/internal/signature0.hpp"
+    "/root/repo/rtt/internal/signature1.hpp"
+    "/root/repo/rtt/internal/signature2.hpp"
+    "/root/repo/rtt/internal/signature3.hpp"
+    "/root/repo/rtt/internal/signature4.hpp"
+    "/root/repo/rtt/internal/signature5.hpp"
+    "/root/repo/rtt/internal/signature6.hpp"
+    "/root/repo/rtt/internal/signature7.hpp"
+    "/root/repo/rtt/internal/signature_template.hpp"
+    )
+endif()
+
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/rtt/marsh/CPFDTD.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/CPFDTD.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/CPFDTD.cpp.o.d"
+  "/root/repo/rtt/marsh/CPFMarshaller.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/CPFMarshaller.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/CPFMarshaller.cpp.o.d"
+  "/root/repo/rtt/marsh/Marshalling.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/Marshalling.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/Marshalling.cpp.o.d"
+  "/root/repo/rtt/marsh/MarshallingService.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/MarshallingService.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/MarshallingService.cpp.o.d"
+  "/root/repo/rtt/marsh/PropertyBagIntrospector.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyBagIntrospector.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyBagIntrospector.cpp.o.d"
+  "/root/repo/rtt/marsh/PropertyDemarshaller.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyDemarshaller.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyDemarshaller.cpp.o.d"
+  "/root/repo/rtt/marsh/PropertyLoader.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyLoader.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyLoader.cpp.o.d"
+  "/root/repo/rtt/marsh/PropertyMarshaller.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyMarshaller.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyMarshaller.cpp.o.d"
+  "/root/repo/rtt/marsh/TinyDemarshaller.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/TinyDemarshaller.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/TinyDemarshaller.cpp.o.d"
+  "/root/repo/rtt/marsh/tinystr.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinystr.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinystr.cpp.o.d"
+  "/root/repo/rtt/marsh/tinyxml.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxml.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxml.cpp.o.d"
+  "/root/repo/rtt/marsh/tinyxmlerror.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxmlerror.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxmlerror.cpp.o.d"
+  "/root/repo/rtt/marsh/tinyxmlparser.cpp" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxmlparser.cpp.o" "gcc" "rtt/marsh/CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxmlparser.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/rtt/marsh/librtt-marshalling-gnulinux.so" "/root/repo/_test_build/rtt/marsh/librtt-marshalling-gnulinux.so.2.8.99"
+  "/root/repo/_test_build/rtt/marsh/librtt-marshalling-gnulinux.so.2.8" "/root/repo/_test_build/rtt/marsh/librtt-marshalling-gnulinux.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/CPFDTD.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/CPFDTD.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/CPFMarshaller.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/CPFMarshaller.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/Marshalling.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/Marshalling.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/MarshallingService.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/MarshallingService.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyBagIntrospector.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyBagIntrospector.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyDemarshaller.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyDemarshaller.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyLoader.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyLoader.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyMarshaller.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/PropertyMarshaller.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/TinyDemarshaller.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/TinyDemarshaller.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinystr.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinystr.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxml.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxml.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxmlerror.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxmlerror.cpp.o.d"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxmlparser.cpp.o"
+  "CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/tinyxmlparser.cpp.o.d"
+  "librtt-marshalling-gnulinux.pdb"
+  "librtt-marshalling-gnulinux.so"
+  "librtt-marshalling-gnulinux.so.2.8"
+  "librtt-marshalling-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rtt-marshalling-gnulinux_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,127 @@
+# Install script for directory: /root/repo/rtt/marsh
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/marsh" TYPE FILE FILES
+    "/root/repo/rtt/marsh/PropertyMarshaller.hpp"
+    "/root/repo/rtt/marsh/PropertyDemarshaller.hpp"
+    "/root/repo/rtt/marsh/MarshallInterface.hpp"
+    "/root/repo/rtt/marsh/MarshallingService.hpp"
+    "/root/repo/rtt/marsh/PropertyBagIntrospector.hpp"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/marsh" TYPE FILE FILES
+    "/root/repo/rtt/marsh/CPFMarshaller.hpp"
+    "/root/repo/rtt/marsh/XMLRPCDemarshaller.hpp"
+    "/root/repo/rtt/marsh/XMLRPCMarshaller.hpp"
+    "/root/repo/rtt/marsh/CPFDTD.hpp"
+    "/root/repo/rtt/marsh/StreamProcessor.hpp"
+    "/root/repo/rtt/marsh/Marshalling.hpp"
+    "/root/repo/rtt/marsh/PropertyLoader.hpp"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/marsh" TYPE FILE FILES "/root/repo/rtt/marsh/TinyDemarshaller.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so.2.8.99"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so.2.8"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "/usr/local/lib/orocos/gnulinux/types:/usr/local/lib")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_test_build/rtt/marsh/librtt-marshalling-gnulinux.so.2.8.99"
+    "/root/repo/_test_build/rtt/marsh/librtt-marshalling-gnulinux.so.2.8"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so.2.8.99"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so.2.8"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_test_build/rtt:::::::::::::::::::::::::"
+           NEW_RPATH "/usr/local/lib/orocos/gnulinux/types:/usr/local/lib")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so"
+         RPATH "/usr/local/lib/orocos/gnulinux/types:/usr/local/lib")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins" TYPE SHARED_LIBRARY FILES "/root/repo/_test_build/rtt/marsh/librtt-marshalling-gnulinux.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so"
+         OLD_RPATH "/root/repo/_test_build/rtt:::::::::::::::::::::::::"
+         NEW_RPATH "/usr/local/lib/orocos/gnulinux/types:/usr/local/lib")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-marshalling-gnulinux.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/marsh" TYPE FILE FILES "/root/repo/_test_build/rtt/marsh/rtt-marsh-config.h")
+endif()
+
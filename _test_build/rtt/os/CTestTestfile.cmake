@@ -0,0 +1,19 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/rtt/os
+# Build directory: /root/repo/_test_build/rtt/os
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("gnulinux")
+subdirs("lxrt")
+subdirs("xenomai")
+subdirs("ecos")
+subdirs("macosx")
+subdirs("win32")
+subdirs("oro_i386")
+subdirs("oro_x86_64")
+subdirs("oro_powerpc")
+subdirs("oro_msvc")
+subdirs("oro_noasm")
+subdirs("oro_gcc")
+subdirs("targets")
@@ -0,0 +1,101 @@
+# Install script for directory: /root/repo/rtt/os
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/os" TYPE FILE FILES
+    "/root/repo/rtt/os/Atomic.hpp"
+    "/root/repo/rtt/os/CAS.hpp"
+    "/root/repo/rtt/os/Condition.hpp"
+    "/root/repo/rtt/os/CpuSet.hpp"
+    "/root/repo/rtt/os/MainThread.hpp"
+    "/root/repo/rtt/os/Mutex.hpp"
+    "/root/repo/rtt/os/MutexLock.hpp"
+    "/root/repo/rtt/os/OS.hpp"
+    "/root/repo/rtt/os/Semaphore.hpp"
+    "/root/repo/rtt/os/StartStopManager.hpp"
+    "/root/repo/rtt/os/Thread.hpp"
+    "/root/repo/rtt/os/ThreadInterface.hpp"
+    "/root/repo/rtt/os/ThreadStatistics.hpp"
+    "/root/repo/rtt/os/Time.hpp"
+    "/root/repo/rtt/os/TimeService.hpp"
+    "/root/repo/rtt/os/Timer.hpp"
+    "/root/repo/rtt/os/fosi.h"
+    "/root/repo/rtt/os/fosi_interface.h"
+    "/root/repo/rtt/os/fosi_internal_interface.hpp"
+    "/root/repo/rtt/os/main.h"
+    "/root/repo/rtt/os/oro_allocator.hpp"
+    "/root/repo/rtt/os/oro_arch.h"
+    "/root/repo/rtt/os/oro_arch_interface.h"
+    "/root/repo/rtt/os/oro_limits.h"
+    "/root/repo/rtt/os/oro_malloc.h"
+    "/root/repo/rtt/os/rint.h"
+    "/root/repo/rtt/os/rt_list.hpp"
+    "/root/repo/rtt/os/rtconversions.hpp"
+    "/root/repo/rtt/os/rtstreambufs.hpp"
+    "/root/repo/rtt/os/rtstreams.hpp"
+    "/root/repo/rtt/os/rtt-os-fwd.hpp"
+    "/root/repo/rtt/os/startstop.h"
+    "/root/repo/rtt/os/threads.hpp"
+    "/root/repo/rtt/os/traces.h"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_test_build/rtt/os/gnulinux/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/lxrt/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/xenomai/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/ecos/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/macosx/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/win32/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/oro_i386/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/oro_x86_64/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/oro_powerpc/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/oro_msvc/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/oro_noasm/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/oro_gcc/cmake_install.cmake")
+  include("/root/repo/_test_build/rtt/os/targets/cmake_install.cmake")
+
+endif()
+
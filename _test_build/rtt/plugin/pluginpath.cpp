@@ -0,0 +1,51 @@
+/***************************************************************************
+  tag: Peter Soetens Thu Nov 4 14:56:47 2010 +0100 pluginpath.cpp.in
+
+                        pluginpath.cpp.in -  description
+                           -------------------
+    begin                : Thu Nov 4 2010
+    copyright            : (C) 2010 Peter Soetens
+    email                : peter@thesourceworks.com
+
+ ***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   General Public License for more details.                              *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+// WARNING: This is an auto-generated file by the build system. Do not modify it. //
+
+#include "plugin/PluginLoader.hpp"
+
+namespace RTT
+{ 
+    namespace plugin {
+        /** @cond */
+        char const* default_plugin_path = "/usr/local/lib/orocos";
+        /** @endcond */
+    }
+}
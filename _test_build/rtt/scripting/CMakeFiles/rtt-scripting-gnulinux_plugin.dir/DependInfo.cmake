@@ -0,0 +1,72 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/rtt/scripting/ArgumentsParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ArgumentsParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ArgumentsParser.cpp.o.d"
+  "/root/repo/rtt/scripting/CommandCounter.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandCounter.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandCounter.cpp.o.d"
+  "/root/repo/rtt/scripting/CommandIllegal.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandIllegal.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandIllegal.cpp.o.d"
+  "/root/repo/rtt/scripting/CommandNOP.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandNOP.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandNOP.cpp.o.d"
+  "/root/repo/rtt/scripting/CommandString.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandString.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandString.cpp.o.d"
+  "/root/repo/rtt/scripting/CommonParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommonParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommonParser.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionBool.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBool.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBool.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionBoolDataSource.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBoolDataSource.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBoolDataSource.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionBoolProperty.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBoolProperty.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBoolProperty.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionComposite.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionComposite.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionComposite.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionDSDuration.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionDSDuration.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionDSDuration.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionDuration.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionDuration.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionDuration.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionInterface.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionInterface.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionInterface.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionOnce.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionOnce.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionOnce.cpp.o.d"
+  "/root/repo/rtt/scripting/ConditionParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionParser.cpp.o.d"
+  "/root/repo/rtt/scripting/DataSourceCondition.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DataSourceCondition.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DataSourceCondition.cpp.o.d"
+  "/root/repo/rtt/scripting/DumpObject.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DumpObject.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DumpObject.cpp.o.d"
+  "/root/repo/rtt/scripting/EdgeCondition.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/EdgeCondition.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/EdgeCondition.cpp.o.d"
+  "/root/repo/rtt/scripting/ExpressionParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ExpressionParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ExpressionParser.cpp.o.d"
+  "/root/repo/rtt/scripting/FunctionFactory.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionFactory.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionFactory.cpp.o.d"
+  "/root/repo/rtt/scripting/FunctionGraph.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionGraph.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionGraph.cpp.o.d"
+  "/root/repo/rtt/scripting/FunctionGraphBuilder.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionGraphBuilder.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionGraphBuilder.cpp.o.d"
+  "/root/repo/rtt/scripting/ParsedStateMachine.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ParsedStateMachine.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ParsedStateMachine.cpp.o.d"
+  "/root/repo/rtt/scripting/Parser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/Parser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/Parser.cpp.o.d"
+  "/root/repo/rtt/scripting/PeerParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/PeerParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/PeerParser.cpp.o.d"
+  "/root/repo/rtt/scripting/ProgramGraphParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramGraphParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramGraphParser.cpp.o.d"
+  "/root/repo/rtt/scripting/ProgramGraphParser2.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramGraphParser2.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramGraphParser2.cpp.o.d"
+  "/root/repo/rtt/scripting/ProgramInterface.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramInterface.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramInterface.cpp.o.d"
+  "/root/repo/rtt/scripting/ProgramService.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramService.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramService.cpp.o.d"
+  "/root/repo/rtt/scripting/PropertyParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/PropertyParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/PropertyParser.cpp.o.d"
+  "/root/repo/rtt/scripting/ScriptParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ScriptParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ScriptParser.cpp.o.d"
+  "/root/repo/rtt/scripting/Scripting.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/Scripting.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/Scripting.cpp.o.d"
+  "/root/repo/rtt/scripting/ScriptingService.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ScriptingService.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ScriptingService.cpp.o.d"
+  "/root/repo/rtt/scripting/SendHandleAlias.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/SendHandleAlias.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/SendHandleAlias.cpp.o.d"
+  "/root/repo/rtt/scripting/StateDescription.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateDescription.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateDescription.cpp.o.d"
+  "/root/repo/rtt/scripting/StateGraphParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateGraphParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateGraphParser.cpp.o.d"
+  "/root/repo/rtt/scripting/StateInterface.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateInterface.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateInterface.cpp.o.d"
+  "/root/repo/rtt/scripting/StateMachine.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachine.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachine.cpp.o.d"
+  "/root/repo/rtt/scripting/StateMachineBuilder.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachineBuilder.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachineBuilder.cpp.o.d"
+  "/root/repo/rtt/scripting/StateMachineService.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachineService.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachineService.cpp.o.d"
+  "/root/repo/rtt/scripting/StatementProcessor.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StatementProcessor.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StatementProcessor.cpp.o.d"
+  "/root/repo/rtt/scripting/TryCommand.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/TryCommand.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/TryCommand.cpp.o.d"
+  "/root/repo/rtt/scripting/ValueChangeParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ValueChangeParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ValueChangeParser.cpp.o.d"
+  "/root/repo/rtt/scripting/ValueParser.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ValueParser.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ValueParser.cpp.o.d"
+  "/root/repo/rtt/scripting/VertexNode.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/VertexNode.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/VertexNode.cpp.o.d"
+  "/root/repo/rtt/scripting/parse_exception.cpp" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/parse_exception.cpp.o" "gcc" "rtt/scripting/CMakeFiles/rtt-scripting-gnulinux_plugin.dir/parse_exception.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/rtt/scripting/librtt-scripting-gnulinux.so" "/root/repo/_test_build/rtt/scripting/librtt-scripting-gnulinux.so.2.8.99"
+  "/root/repo/_test_build/rtt/scripting/librtt-scripting-gnulinux.so.2.8" "/root/repo/_test_build/rtt/scripting/librtt-scripting-gnulinux.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
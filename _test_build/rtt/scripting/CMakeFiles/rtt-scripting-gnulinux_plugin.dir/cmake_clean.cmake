@@ -0,0 +1,103 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ArgumentsParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ArgumentsParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandCounter.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandCounter.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandIllegal.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandIllegal.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandNOP.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandNOP.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandString.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommandString.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommonParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/CommonParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBool.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBool.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBoolDataSource.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBoolDataSource.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBoolProperty.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionBoolProperty.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionComposite.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionComposite.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionDSDuration.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionDSDuration.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionDuration.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionDuration.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionInterface.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionInterface.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionOnce.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionOnce.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ConditionParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DataSourceCondition.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DataSourceCondition.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DumpObject.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/DumpObject.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/EdgeCondition.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/EdgeCondition.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ExpressionParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ExpressionParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionFactory.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionFactory.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionGraph.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionGraph.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionGraphBuilder.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/FunctionGraphBuilder.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ParsedStateMachine.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ParsedStateMachine.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/Parser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/Parser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/PeerParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/PeerParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramGraphParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramGraphParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramGraphParser2.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramGraphParser2.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramInterface.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramInterface.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramService.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ProgramService.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/PropertyParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/PropertyParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ScriptParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ScriptParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/Scripting.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/Scripting.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ScriptingService.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ScriptingService.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/SendHandleAlias.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/SendHandleAlias.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateDescription.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateDescription.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateGraphParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateGraphParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateInterface.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateInterface.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachine.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachine.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachineBuilder.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachineBuilder.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachineService.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StateMachineService.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StatementProcessor.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/StatementProcessor.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/TryCommand.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/TryCommand.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ValueChangeParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ValueChangeParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ValueParser.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/ValueParser.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/VertexNode.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/VertexNode.cpp.o.d"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/parse_exception.cpp.o"
+  "CMakeFiles/rtt-scripting-gnulinux_plugin.dir/parse_exception.cpp.o.d"
+  "librtt-scripting-gnulinux.pdb"
+  "librtt-scripting-gnulinux.so"
+  "librtt-scripting-gnulinux.so.2.8"
+  "librtt-scripting-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rtt-scripting-gnulinux_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,169 @@
+# Install script for directory: /root/repo/rtt/scripting
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/scripting" TYPE FILE FILES
+    "/root/repo/rtt/scripting/ArgumentsParser.hpp"
+    "/root/repo/rtt/scripting/CallFunction.hpp"
+    "/root/repo/rtt/scripting/CommandBinary.hpp"
+    "/root/repo/rtt/scripting/CommandComposite.hpp"
+    "/root/repo/rtt/scripting/CommandCounter.hpp"
+    "/root/repo/rtt/scripting/CommandDataSource.hpp"
+    "/root/repo/rtt/scripting/CommandFunctors.hpp"
+    "/root/repo/rtt/scripting/CommandIllegal.hpp"
+    "/root/repo/rtt/scripting/CommandNOP.hpp"
+    "/root/repo/rtt/scripting/CommandString.hpp"
+    "/root/repo/rtt/scripting/CommonParser.hpp"
+    "/root/repo/rtt/scripting/ConditionBool.hpp"
+    "/root/repo/rtt/scripting/ConditionBoolDataSource.hpp"
+    "/root/repo/rtt/scripting/ConditionBoolProperty.hpp"
+    "/root/repo/rtt/scripting/ConditionCache.hpp"
+    "/root/repo/rtt/scripting/ConditionCompare.hpp"
+    "/root/repo/rtt/scripting/ConditionComposite.hpp"
+    "/root/repo/rtt/scripting/ConditionDSDuration.hpp"
+    "/root/repo/rtt/scripting/ConditionDuration.hpp"
+    "/root/repo/rtt/scripting/ConditionExpire.hpp"
+    "/root/repo/rtt/scripting/ConditionFalse.hpp"
+    "/root/repo/rtt/scripting/ConditionInterface.hpp"
+    "/root/repo/rtt/scripting/ConditionInvert.hpp"
+    "/root/repo/rtt/scripting/ConditionOnce.hpp"
+    "/root/repo/rtt/scripting/ConditionParser.hpp"
+    "/root/repo/rtt/scripting/ConditionTrue.hpp"
+    "/root/repo/rtt/scripting/DataSourceCondition.hpp"
+    "/root/repo/rtt/scripting/DataSourceTime.hpp"
+    "/root/repo/rtt/scripting/DumpObject.hpp"
+    "/root/repo/rtt/scripting/EdgeCondition.hpp"
+    "/root/repo/rtt/scripting/ExpressionParser.hpp"
+    "/root/repo/rtt/scripting/FunctionFactory.hpp"
+    "/root/repo/rtt/scripting/FunctionGraph.hpp"
+    "/root/repo/rtt/scripting/FunctionGraphBuilder.hpp"
+    "/root/repo/rtt/scripting/GraphCopier.hpp"
+    "/root/repo/rtt/scripting/ParsedStateMachine.hpp"
+    "/root/repo/rtt/scripting/Parser.Main.hpp"
+    "/root/repo/rtt/scripting/Parser.hpp"
+    "/root/repo/rtt/scripting/PeerParser.hpp"
+    "/root/repo/rtt/scripting/ProgramExceptions.hpp"
+    "/root/repo/rtt/scripting/ProgramGraphParser.hpp"
+    "/root/repo/rtt/scripting/ProgramInterface.hpp"
+    "/root/repo/rtt/scripting/ProgramService.hpp"
+    "/root/repo/rtt/scripting/PropertyParser.hpp"
+    "/root/repo/rtt/scripting/ScriptParser.hpp"
+    "/root/repo/rtt/scripting/Scripting.hpp"
+    "/root/repo/rtt/scripting/ScriptingService.hpp"
+    "/root/repo/rtt/scripting/SendHandleAlias.hpp"
+    "/root/repo/rtt/scripting/StateDescription.hpp"
+    "/root/repo/rtt/scripting/StateGraphParser.hpp"
+    "/root/repo/rtt/scripting/StateInterface.hpp"
+    "/root/repo/rtt/scripting/StateMachine.hpp"
+    "/root/repo/rtt/scripting/StateMachineBuilder.hpp"
+    "/root/repo/rtt/scripting/StateMachineService.hpp"
+    "/root/repo/rtt/scripting/StatementProcessor.hpp"
+    "/root/repo/rtt/scripting/TryCommand.hpp"
+    "/root/repo/rtt/scripting/ValueChangeParser.hpp"
+    "/root/repo/rtt/scripting/ValueParser.hpp"
+    "/root/repo/rtt/scripting/VertexNode.hpp"
+    "/root/repo/rtt/scripting/parse_exception.hpp"
+    "/root/repo/rtt/scripting/parser-debug.hpp"
+    "/root/repo/rtt/scripting/parser-types.hpp"
+    "/root/repo/rtt/scripting/rtt-scripting-fwd.hpp"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so.2.8.99"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so.2.8"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "/usr/local/lib/orocos/gnulinux/types:/usr/local/lib")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_test_build/rtt/scripting/librtt-scripting-gnulinux.so.2.8.99"
+    "/root/repo/_test_build/rtt/scripting/librtt-scripting-gnulinux.so.2.8"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so.2.8.99"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so.2.8"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_test_build/rtt:::::::::::::::::::::::::"
+           NEW_RPATH "/usr/local/lib/orocos/gnulinux/types:/usr/local/lib")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so"
+         RPATH "/usr/local/lib/orocos/gnulinux/types:/usr/local/lib")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins" TYPE SHARED_LIBRARY FILES "/root/repo/_test_build/rtt/scripting/librtt-scripting-gnulinux.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so"
+         OLD_RPATH "/root/repo/_test_build/rtt:::::::::::::::::::::::::"
+         NEW_RPATH "/usr/local/lib/orocos/gnulinux/types:/usr/local/lib")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/orocos/gnulinux/plugins/librtt-scripting-gnulinux.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/scripting" TYPE FILE FILES "/root/repo/_test_build/rtt/scripting/rtt-scripting-config.h")
+endif()
+
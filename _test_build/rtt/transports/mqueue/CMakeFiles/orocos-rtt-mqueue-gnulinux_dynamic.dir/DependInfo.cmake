@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/rtt/transports/mqueue/Dispatcher.cpp" "rtt/transports/mqueue/CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/Dispatcher.cpp.o" "gcc" "rtt/transports/mqueue/CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/Dispatcher.cpp.o.d"
+  "/root/repo/rtt/transports/mqueue/MQBufferPool.cpp" "rtt/transports/mqueue/CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/MQBufferPool.cpp.o" "gcc" "rtt/transports/mqueue/CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/MQBufferPool.cpp.o.d"
+  "/root/repo/rtt/transports/mqueue/MQSendRecv.cpp" "rtt/transports/mqueue/CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/MQSendRecv.cpp.o" "gcc" "rtt/transports/mqueue/CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/MQSendRecv.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/rtt/transports/mqueue/liborocos-rtt-mqueue-gnulinux.so" "/root/repo/_test_build/rtt/transports/mqueue/liborocos-rtt-mqueue-gnulinux.so.2.8.99"
+  "/root/repo/_test_build/rtt/transports/mqueue/liborocos-rtt-mqueue-gnulinux.so.2.8" "/root/repo/_test_build/rtt/transports/mqueue/liborocos-rtt-mqueue-gnulinux.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/Dispatcher.cpp.o"
+  "CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/Dispatcher.cpp.o.d"
+  "CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/MQBufferPool.cpp.o"
+  "CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/MQBufferPool.cpp.o.d"
+  "CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/MQSendRecv.cpp.o"
+  "CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/MQSendRecv.cpp.o.d"
+  "liborocos-rtt-mqueue-gnulinux.pdb"
+  "liborocos-rtt-mqueue-gnulinux.so"
+  "liborocos-rtt-mqueue-gnulinux.so.2.8"
+  "liborocos-rtt-mqueue-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/rtt/transports/mqueue/MQLib.cpp" "rtt/transports/mqueue/CMakeFiles/rtt-transport-mqueue-gnulinux_plugin.dir/MQLib.cpp.o" "gcc" "rtt/transports/mqueue/CMakeFiles/rtt-transport-mqueue-gnulinux_plugin.dir/MQLib.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/rtt/transports/mqueue/librtt-transport-mqueue-gnulinux.so" "/root/repo/_test_build/rtt/transports/mqueue/librtt-transport-mqueue-gnulinux.so.2.8.99"
+  "/root/repo/_test_build/rtt/transports/mqueue/librtt-transport-mqueue-gnulinux.so.2.8" "/root/repo/_test_build/rtt/transports/mqueue/librtt-transport-mqueue-gnulinux.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/rtt/transports/mqueue/CMakeFiles/orocos-rtt-mqueue-gnulinux_dynamic.dir/DependInfo.cmake"
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtt-transport-mqueue-gnulinux_plugin.dir/MQLib.cpp.o"
+  "CMakeFiles/rtt-transport-mqueue-gnulinux_plugin.dir/MQLib.cpp.o.d"
+  "librtt-transport-mqueue-gnulinux.pdb"
+  "librtt-transport-mqueue-gnulinux.so"
+  "librtt-transport-mqueue-gnulinux.so.2.8"
+  "librtt-transport-mqueue-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rtt-transport-mqueue-gnulinux_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orocos-rtt-shm-gnulinux_dynamic.dir/Dispatcher.cpp.o"
+  "CMakeFiles/orocos-rtt-shm-gnulinux_dynamic.dir/Dispatcher.cpp.o.d"
+  "CMakeFiles/orocos-rtt-shm-gnulinux_dynamic.dir/SHMSendRecv.cpp.o"
+  "CMakeFiles/orocos-rtt-shm-gnulinux_dynamic.dir/SHMSendRecv.cpp.o.d"
+  "liborocos-rtt-shm-gnulinux.pdb"
+  "liborocos-rtt-shm-gnulinux.so"
+  "liborocos-rtt-shm-gnulinux.so.2.8"
+  "liborocos-rtt-shm-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orocos-rtt-shm-gnulinux_dynamic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
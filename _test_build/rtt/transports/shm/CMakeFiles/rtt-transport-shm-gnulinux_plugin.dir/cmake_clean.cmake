@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtt-transport-shm-gnulinux_plugin.dir/SHMLib.cpp.o"
+  "CMakeFiles/rtt-transport-shm-gnulinux_plugin.dir/SHMLib.cpp.o.d"
+  "librtt-transport-shm-gnulinux.pdb"
+  "librtt-transport-shm-gnulinux.so"
+  "librtt-transport-shm-gnulinux.so.2.8"
+  "librtt-transport-shm-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rtt-transport-shm-gnulinux_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/rtt/typekit/RealTimeTypekit.cpp" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekit.cpp.o" "gcc" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekit.cpp.o.d"
+  "/root/repo/rtt/typekit/RealTimeTypekitConstructors.cpp" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitConstructors.cpp.o" "gcc" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitConstructors.cpp.o.d"
+  "/root/repo/rtt/typekit/RealTimeTypekitGlobals.cpp" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitGlobals.cpp.o" "gcc" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitGlobals.cpp.o.d"
+  "/root/repo/rtt/typekit/RealTimeTypekitOperators.cpp" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitOperators.cpp.o" "gcc" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitOperators.cpp.o.d"
+  "/root/repo/rtt/typekit/RealTimeTypekitStdTypes.cpp" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitStdTypes.cpp.o" "gcc" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitStdTypes.cpp.o.d"
+  "/root/repo/rtt/typekit/RealTimeTypekitTypes.cpp" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitTypes.cpp.o" "gcc" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitTypes.cpp.o.d"
+  "/root/repo/rtt/typekit/RealTimeTypekitTypes2.cpp" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitTypes2.cpp.o" "gcc" "rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitTypes2.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/rtt/typekit/librtt-typekit-gnulinux.so" "/root/repo/_test_build/rtt/typekit/librtt-typekit-gnulinux.so.2.8.99"
+  "/root/repo/_test_build/rtt/typekit/librtt-typekit-gnulinux.so.2.8" "/root/repo/_test_build/rtt/typekit/librtt-typekit-gnulinux.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekit.cpp.o"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekit.cpp.o.d"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitConstructors.cpp.o"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitConstructors.cpp.o.d"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitGlobals.cpp.o"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitGlobals.cpp.o.d"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitOperators.cpp.o"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitOperators.cpp.o.d"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitStdTypes.cpp.o"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitStdTypes.cpp.o.d"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitTypes.cpp.o"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitTypes.cpp.o.d"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitTypes2.cpp.o"
+  "CMakeFiles/rtt-typekit-gnulinux_plugin.dir/RealTimeTypekitTypes2.cpp.o.d"
+  "librtt-typekit-gnulinux.pdb"
+  "librtt-typekit-gnulinux.so"
+  "librtt-typekit-gnulinux.so.2.8"
+  "librtt-typekit-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rtt-typekit-gnulinux_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,91 @@
+# Install script for directory: /root/repo/rtt/types
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/rtt/types" TYPE FILE FILES
+    "/root/repo/rtt/types/BoostArrayTypeInfo.hpp"
+    "/root/repo/rtt/types/CArrayTypeInfo.hpp"
+    "/root/repo/rtt/types/CompositionFactory.hpp"
+    "/root/repo/rtt/types/EnumTypeInfo.hpp"
+    "/root/repo/rtt/types/GlobalsRepository.hpp"
+    "/root/repo/rtt/types/MemberFactory.hpp"
+    "/root/repo/rtt/types/OperatorTypes.hpp"
+    "/root/repo/rtt/types/Operators.hpp"
+    "/root/repo/rtt/types/PrimitiveSequenceTypeInfo.hpp"
+    "/root/repo/rtt/types/PrimitiveTypeInfo.hpp"
+    "/root/repo/rtt/types/PropertyComposition.hpp"
+    "/root/repo/rtt/types/PropertyDecomposition.hpp"
+    "/root/repo/rtt/types/SequenceConstructor.hpp"
+    "/root/repo/rtt/types/SequenceTypeInfo.hpp"
+    "/root/repo/rtt/types/SequenceTypeInfoBase.hpp"
+    "/root/repo/rtt/types/StdVectorTemplateTypeInfo.hpp"
+    "/root/repo/rtt/types/StreamFactory.hpp"
+    "/root/repo/rtt/types/StructTypeInfo.hpp"
+    "/root/repo/rtt/types/TemplateCompositionFactory.hpp"
+    "/root/repo/rtt/types/TemplateConnFactory.hpp"
+    "/root/repo/rtt/types/TemplateConstructor.hpp"
+    "/root/repo/rtt/types/TemplateTypeInfo.hpp"
+    "/root/repo/rtt/types/TemplateValueFactory.hpp"
+    "/root/repo/rtt/types/TransportPlugin.hpp"
+    "/root/repo/rtt/types/TypeConstructor.hpp"
+    "/root/repo/rtt/types/TypeInfo.hpp"
+    "/root/repo/rtt/types/TypeInfoGenerator.hpp"
+    "/root/repo/rtt/types/TypeInfoName.hpp"
+    "/root/repo/rtt/types/TypeInfoRepository.hpp"
+    "/root/repo/rtt/types/TypeMarshaller.hpp"
+    "/root/repo/rtt/types/TypeStream-io.hpp"
+    "/root/repo/rtt/types/TypeStream.hpp"
+    "/root/repo/rtt/types/TypeStreamSelector.hpp"
+    "/root/repo/rtt/types/TypeTransporter.hpp"
+    "/root/repo/rtt/types/TypekitPlugin.hpp"
+    "/root/repo/rtt/types/TypekitRepository.hpp"
+    "/root/repo/rtt/types/Types.hpp"
+    "/root/repo/rtt/types/ValueFactory.hpp"
+    "/root/repo/rtt/types/VectorTemplateComposition.hpp"
+    "/root/repo/rtt/types/carray.hpp"
+    "/root/repo/rtt/types/rtt-types-fwd.hpp"
+    "/root/repo/rtt/types/type_discovery.hpp"
+    )
+endif()
+
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SetupTests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/SetupTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/channelelements_test.cpp" "tests/CMakeFiles/channelelements_test.dir/channelelements_test.cpp.o" "gcc" "tests/CMakeFiles/channelelements_test.dir/channelelements_test.cpp.o.d"
+  "/root/repo/tests/test-runner.cpp" "tests/CMakeFiles/channelelements_test.dir/test-runner.cpp.o" "gcc" "tests/CMakeFiles/channelelements_test.dir/test-runner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/tests/CMakeFiles/fixtures.dir/DependInfo.cmake"
+  "/root/repo/_test_build/rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/DependInfo.cmake"
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/channelelements_test.dir/channelelements_test.cpp.o"
+  "CMakeFiles/channelelements_test.dir/channelelements_test.cpp.o.d"
+  "CMakeFiles/channelelements_test.dir/test-runner.cpp.o"
+  "CMakeFiles/channelelements_test.dir/test-runner.cpp.o.d"
+  "channelelements_test"
+  "channelelements_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/channelelements_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
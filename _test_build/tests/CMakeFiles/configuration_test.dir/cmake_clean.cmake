@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/configuration_test.dir/configuration_test.cpp.o"
+  "CMakeFiles/configuration_test.dir/configuration_test.cpp.o.d"
+  "CMakeFiles/configuration_test.dir/test-runner.cpp.o"
+  "CMakeFiles/configuration_test.dir/test-runner.cpp.o.d"
+  "configuration_test"
+  "configuration_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/configuration_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
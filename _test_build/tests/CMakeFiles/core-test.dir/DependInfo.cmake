@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/logger_test.cpp" "tests/CMakeFiles/core-test.dir/logger_test.cpp.o" "gcc" "tests/CMakeFiles/core-test.dir/logger_test.cpp.o.d"
+  "/root/repo/tests/ptr_test.cpp" "tests/CMakeFiles/core-test.dir/ptr_test.cpp.o" "gcc" "tests/CMakeFiles/core-test.dir/ptr_test.cpp.o.d"
+  "/root/repo/tests/test-runner.cpp" "tests/CMakeFiles/core-test.dir/test-runner.cpp.o" "gcc" "tests/CMakeFiles/core-test.dir/test-runner.cpp.o.d"
+  "/root/repo/tests/time_test.cpp" "tests/CMakeFiles/core-test.dir/time_test.cpp.o" "gcc" "tests/CMakeFiles/core-test.dir/time_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/tests/CMakeFiles/fixtures.dir/DependInfo.cmake"
+  "/root/repo/_test_build/rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/DependInfo.cmake"
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
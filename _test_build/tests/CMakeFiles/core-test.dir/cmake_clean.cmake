@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/core-test.dir/logger_test.cpp.o"
+  "CMakeFiles/core-test.dir/logger_test.cpp.o.d"
+  "CMakeFiles/core-test.dir/ptr_test.cpp.o"
+  "CMakeFiles/core-test.dir/ptr_test.cpp.o.d"
+  "CMakeFiles/core-test.dir/test-runner.cpp.o"
+  "CMakeFiles/core-test.dir/test-runner.cpp.o.d"
+  "CMakeFiles/core-test.dir/time_test.cpp.o"
+  "CMakeFiles/core-test.dir/time_test.cpp.o.d"
+  "core-test"
+  "core-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/core-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dataflow_performance_test.dir/dataflow_performance_test.cpp.o"
+  "CMakeFiles/dataflow_performance_test.dir/dataflow_performance_test.cpp.o.d"
+  "CMakeFiles/dataflow_performance_test.dir/test-runner.cpp.o"
+  "CMakeFiles/dataflow_performance_test.dir/test-runner.cpp.o.d"
+  "dataflow_performance_test"
+  "dataflow_performance_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dataflow_performance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dataobject_performance_test.dir/dataobject_performance_test.cpp.o"
+  "CMakeFiles/dataobject_performance_test.dir/dataobject_performance_test.cpp.o.d"
+  "CMakeFiles/dataobject_performance_test.dir/test-runner.cpp.o"
+  "CMakeFiles/dataobject_performance_test.dir/test-runner.cpp.o.d"
+  "dataobject_performance_test"
+  "dataobject_performance_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dataobject_performance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
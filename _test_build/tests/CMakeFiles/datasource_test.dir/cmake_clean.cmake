@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/datasource_test.dir/datasource_test.cpp.o"
+  "CMakeFiles/datasource_test.dir/datasource_test.cpp.o.d"
+  "CMakeFiles/datasource_test.dir/test-runner.cpp.o"
+  "CMakeFiles/datasource_test.dir/test-runner.cpp.o.d"
+  "datasource_test"
+  "datasource_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/datasource_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/enum_type_test.dir/enum_type_test.cpp.o"
+  "CMakeFiles/enum_type_test.dir/enum_type_test.cpp.o.d"
+  "CMakeFiles/enum_type_test.dir/test-runner.cpp.o"
+  "CMakeFiles/enum_type_test.dir/test-runner.cpp.o.d"
+  "enum_type_test"
+  "enum_type_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/enum_type_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/datasource_fixture.cpp" "tests/CMakeFiles/fixtures.dir/datasource_fixture.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/datasource_fixture.cpp.o.d"
+  "/root/repo/tests/operations_fixture.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture.cpp.o.d"
+  "/root/repo/tests/operations_fixture0.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture0.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture0.cpp.o.d"
+  "/root/repo/tests/operations_fixture1.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture1.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture1.cpp.o.d"
+  "/root/repo/tests/operations_fixture2.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture2.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture2.cpp.o.d"
+  "/root/repo/tests/operations_fixture3.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture3.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture3.cpp.o.d"
+  "/root/repo/tests/operations_fixture4.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture4.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture4.cpp.o.d"
+  "/root/repo/tests/operations_fixture5.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture5.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture5.cpp.o.d"
+  "/root/repo/tests/operations_fixture6.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture6.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture6.cpp.o.d"
+  "/root/repo/tests/operations_fixture7.cpp" "tests/CMakeFiles/fixtures.dir/operations_fixture7.cpp.o" "gcc" "tests/CMakeFiles/fixtures.dir/operations_fixture7.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/tests/libfixtures.so" "/root/repo/_test_build/tests/libfixtures.so.2.8.99"
+  "/root/repo/_test_build/tests/libfixtures.so.2.8" "/root/repo/_test_build/tests/libfixtures.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/DependInfo.cmake"
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fixtures.dir/datasource_fixture.cpp.o"
+  "CMakeFiles/fixtures.dir/datasource_fixture.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture0.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture0.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture1.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture1.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture2.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture2.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture3.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture3.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture4.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture4.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture5.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture5.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture6.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture6.cpp.o.d"
+  "CMakeFiles/fixtures.dir/operations_fixture7.cpp.o"
+  "CMakeFiles/fixtures.dir/operations_fixture7.cpp.o.d"
+  "libfixtures.pdb"
+  "libfixtures.so"
+  "libfixtures.so.2.8"
+  "libfixtures.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fixtures.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
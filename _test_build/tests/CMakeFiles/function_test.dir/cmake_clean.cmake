@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/function_test.dir/function_test.cpp.o"
+  "CMakeFiles/function_test.dir/function_test.cpp.o.d"
+  "CMakeFiles/function_test.dir/test-runner.cpp.o"
+  "CMakeFiles/function_test.dir/test-runner.cpp.o.d"
+  "function_test"
+  "function_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
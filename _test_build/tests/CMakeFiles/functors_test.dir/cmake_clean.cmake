@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/functors_test.dir/functors_test.cpp.o"
+  "CMakeFiles/functors_test.dir/functors_test.cpp.o.d"
+  "CMakeFiles/functors_test.dir/test-runner.cpp.o"
+  "CMakeFiles/functors_test.dir/test-runner.cpp.o.d"
+  "functors_test"
+  "functors_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/functors_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/list-test.dir/listlocked_test.cpp.o"
+  "CMakeFiles/list-test.dir/listlocked_test.cpp.o.d"
+  "CMakeFiles/list-test.dir/test-runner.cpp.o"
+  "CMakeFiles/list-test.dir/test-runner.cpp.o.d"
+  "list-test"
+  "list-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/list-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
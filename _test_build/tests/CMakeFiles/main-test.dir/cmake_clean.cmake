@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/main-test.dir/test-main.cpp.o"
+  "CMakeFiles/main-test.dir/test-main.cpp.o.d"
+  "main-test"
+  "main-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
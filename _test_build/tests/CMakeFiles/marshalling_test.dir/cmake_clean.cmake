@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/marshalling_test.dir/marshalling_test.cpp.o"
+  "CMakeFiles/marshalling_test.dir/marshalling_test.cpp.o.d"
+  "CMakeFiles/marshalling_test.dir/test-runner.cpp.o"
+  "CMakeFiles/marshalling_test.dir/test-runner.cpp.o.d"
+  "marshalling_test"
+  "marshalling_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/marshalling_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
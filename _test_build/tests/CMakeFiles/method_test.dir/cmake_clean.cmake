@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/method_test.dir/method_test.cpp.o"
+  "CMakeFiles/method_test.dir/method_test.cpp.o.d"
+  "CMakeFiles/method_test.dir/test-runner.cpp.o"
+  "CMakeFiles/method_test.dir/test-runner.cpp.o.d"
+  "method_test"
+  "method_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/method_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
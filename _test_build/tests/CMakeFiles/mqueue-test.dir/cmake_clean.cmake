@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mqueue-test.dir/mqueue_test.cpp.o"
+  "CMakeFiles/mqueue-test.dir/mqueue_test.cpp.o.d"
+  "CMakeFiles/mqueue-test.dir/test-runner.cpp.o"
+  "CMakeFiles/mqueue-test.dir/test-runner.cpp.o.d"
+  "mqueue-test"
+  "mqueue-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mqueue-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
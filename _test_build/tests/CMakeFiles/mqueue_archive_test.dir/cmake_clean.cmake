@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mqueue_archive_test.dir/mqueue_archive_test.cpp.o"
+  "CMakeFiles/mqueue_archive_test.dir/mqueue_archive_test.cpp.o.d"
+  "CMakeFiles/mqueue_archive_test.dir/test-runner.cpp.o"
+  "CMakeFiles/mqueue_archive_test.dir/test-runner.cpp.o.d"
+  "mqueue_archive_test"
+  "mqueue_archive_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mqueue_archive_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
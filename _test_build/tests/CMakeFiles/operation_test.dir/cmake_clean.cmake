@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/operation_test.dir/operation_test.cpp.o"
+  "CMakeFiles/operation_test.dir/operation_test.cpp.o.d"
+  "CMakeFiles/operation_test.dir/test-runner.cpp.o"
+  "CMakeFiles/operation_test.dir/test-runner.cpp.o.d"
+  "operation_test"
+  "operation_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/operation_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/plugins_test.dir/plugins_test.cpp.o"
+  "CMakeFiles/plugins_test.dir/plugins_test.cpp.o.d"
+  "CMakeFiles/plugins_test.dir/test-runner.cpp.o"
+  "CMakeFiles/plugins_test.dir/test-runner.cpp.o.d"
+  "plugins_test"
+  "plugins_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/plugins_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/program_test.dir/program_test.cpp.o"
+  "CMakeFiles/program_test.dir/program_test.cpp.o.d"
+  "CMakeFiles/program_test.dir/test-runner.cpp.o"
+  "CMakeFiles/program_test.dir/test-runner.cpp.o.d"
+  "program_test"
+  "program_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/program_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
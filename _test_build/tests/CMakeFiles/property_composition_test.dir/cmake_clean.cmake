@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/property_composition_test.dir/property_composition_test.cpp.o"
+  "CMakeFiles/property_composition_test.dir/property_composition_test.cpp.o.d"
+  "CMakeFiles/property_composition_test.dir/test-runner.cpp.o"
+  "CMakeFiles/property_composition_test.dir/test-runner.cpp.o.d"
+  "property_composition_test"
+  "property_composition_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/property_composition_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
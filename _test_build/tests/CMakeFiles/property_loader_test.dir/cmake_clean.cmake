@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/property_loader_test.dir/property_loader_test.cpp.o"
+  "CMakeFiles/property_loader_test.dir/property_loader_test.cpp.o.d"
+  "CMakeFiles/property_loader_test.dir/test-runner.cpp.o"
+  "CMakeFiles/property_loader_test.dir/test-runner.cpp.o.d"
+  "property_loader_test"
+  "property_loader_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/property_loader_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
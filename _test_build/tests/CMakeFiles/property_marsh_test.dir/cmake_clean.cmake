@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/property_marsh_test.dir/property_marsh_test.cpp.o"
+  "CMakeFiles/property_marsh_test.dir/property_marsh_test.cpp.o.d"
+  "CMakeFiles/property_marsh_test.dir/test-runner.cpp.o"
+  "CMakeFiles/property_marsh_test.dir/test-runner.cpp.o.d"
+  "property_marsh_test"
+  "property_marsh_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/property_marsh_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/remote_method_test.dir/remote_method_test.cpp.o"
+  "CMakeFiles/remote_method_test.dir/remote_method_test.cpp.o.d"
+  "CMakeFiles/remote_method_test.dir/test-runner.cpp.o"
+  "CMakeFiles/remote_method_test.dir/test-runner.cpp.o.d"
+  "remote_method_test"
+  "remote_method_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remote_method_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
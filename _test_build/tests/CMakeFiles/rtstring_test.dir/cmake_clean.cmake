@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtstring_test.dir/rtstring_test.cpp.o"
+  "CMakeFiles/rtstring_test.dir/rtstring_test.cpp.o.d"
+  "CMakeFiles/rtstring_test.dir/test-runner.cpp.o"
+  "CMakeFiles/rtstring_test.dir/test-runner.cpp.o.d"
+  "rtstring_test"
+  "rtstring_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rtstring_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scripting_test.dir/scripting_test.cpp.o"
+  "CMakeFiles/scripting_test.dir/scripting_test.cpp.o.d"
+  "CMakeFiles/scripting_test.dir/test-runner.cpp.o"
+  "CMakeFiles/scripting_test.dir/test-runner.cpp.o.d"
+  "scripting_test"
+  "scripting_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scripting_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
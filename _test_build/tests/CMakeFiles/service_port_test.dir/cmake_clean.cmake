@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/service_port_test.dir/service_port_test.cpp.o"
+  "CMakeFiles/service_port_test.dir/service_port_test.cpp.o.d"
+  "CMakeFiles/service_port_test.dir/test-runner.cpp.o"
+  "CMakeFiles/service_port_test.dir/test-runner.cpp.o.d"
+  "service_port_test"
+  "service_port_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/service_port_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
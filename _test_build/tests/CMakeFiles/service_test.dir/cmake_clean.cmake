@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/service_test.dir/service_test.cpp.o"
+  "CMakeFiles/service_test.dir/service_test.cpp.o.d"
+  "CMakeFiles/service_test.dir/test-runner.cpp.o"
+  "CMakeFiles/service_test.dir/test-runner.cpp.o.d"
+  "service_test"
+  "service_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/service_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm-test.dir/shm_test.cpp.o"
+  "CMakeFiles/shm-test.dir/shm_test.cpp.o.d"
+  "CMakeFiles/shm-test.dir/test-runner.cpp.o"
+  "CMakeFiles/shm-test.dir/test-runner.cpp.o.d"
+  "shm-test"
+  "shm-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
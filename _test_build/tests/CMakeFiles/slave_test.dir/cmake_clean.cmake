@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slave_test.dir/slave_test.cpp.o"
+  "CMakeFiles/slave_test.dir/slave_test.cpp.o.d"
+  "CMakeFiles/slave_test.dir/test-runner.cpp.o"
+  "CMakeFiles/slave_test.dir/test-runner.cpp.o.d"
+  "slave_test"
+  "slave_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slave_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/specactivities-test.dir/specialized_activities.cpp.o"
+  "CMakeFiles/specactivities-test.dir/specialized_activities.cpp.o.d"
+  "CMakeFiles/specactivities-test.dir/test-runner.cpp.o"
+  "CMakeFiles/specactivities-test.dir/test-runner.cpp.o.d"
+  "specactivities-test"
+  "specactivities-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/specactivities-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/state_test.dir/state_test.cpp.o"
+  "CMakeFiles/state_test.dir/state_test.cpp.o.d"
+  "CMakeFiles/state_test.dir/test-runner.cpp.o"
+  "CMakeFiles/state_test.dir/test-runner.cpp.o.d"
+  "state_test"
+  "state_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/state_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/tasks_multiple_test.cpp" "tests/CMakeFiles/task-test.dir/tasks_multiple_test.cpp.o" "gcc" "tests/CMakeFiles/task-test.dir/tasks_multiple_test.cpp.o.d"
+  "/root/repo/tests/tasks_test.cpp" "tests/CMakeFiles/task-test.dir/tasks_test.cpp.o" "gcc" "tests/CMakeFiles/task-test.dir/tasks_test.cpp.o.d"
+  "/root/repo/tests/taskthread_fd_test.cpp" "tests/CMakeFiles/task-test.dir/taskthread_fd_test.cpp.o" "gcc" "tests/CMakeFiles/task-test.dir/taskthread_fd_test.cpp.o.d"
+  "/root/repo/tests/taskthread_test.cpp" "tests/CMakeFiles/task-test.dir/taskthread_test.cpp.o" "gcc" "tests/CMakeFiles/task-test.dir/taskthread_test.cpp.o.d"
+  "/root/repo/tests/test-runner.cpp" "tests/CMakeFiles/task-test.dir/test-runner.cpp.o" "gcc" "tests/CMakeFiles/task-test.dir/test-runner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/tests/CMakeFiles/fixtures.dir/DependInfo.cmake"
+  "/root/repo/_test_build/rtt/typekit/CMakeFiles/rtt-typekit-gnulinux_plugin.dir/DependInfo.cmake"
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/task-test.dir/tasks_multiple_test.cpp.o"
+  "CMakeFiles/task-test.dir/tasks_multiple_test.cpp.o.d"
+  "CMakeFiles/task-test.dir/tasks_test.cpp.o"
+  "CMakeFiles/task-test.dir/tasks_test.cpp.o.d"
+  "CMakeFiles/task-test.dir/taskthread_fd_test.cpp.o"
+  "CMakeFiles/task-test.dir/taskthread_fd_test.cpp.o.d"
+  "CMakeFiles/task-test.dir/taskthread_test.cpp.o"
+  "CMakeFiles/task-test.dir/taskthread_test.cpp.o.d"
+  "CMakeFiles/task-test.dir/test-runner.cpp.o"
+  "CMakeFiles/task-test.dir/test-runner.cpp.o.d"
+  "task-test"
+  "task-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
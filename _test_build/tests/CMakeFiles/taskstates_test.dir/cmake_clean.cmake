@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/taskstates_test.dir/taskstates_test.cpp.o"
+  "CMakeFiles/taskstates_test.dir/taskstates_test.cpp.o.d"
+  "CMakeFiles/taskstates_test.dir/test-runner.cpp.o"
+  "CMakeFiles/taskstates_test.dir/test-runner.cpp.o.d"
+  "taskstates_test"
+  "taskstates_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/taskstates_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tlsf_test.dir/test-runner.cpp.o"
+  "CMakeFiles/tlsf_test.dir/test-runner.cpp.o.d"
+  "CMakeFiles/tlsf_test.dir/tlsf_test.cpp.o"
+  "CMakeFiles/tlsf_test.dir/tlsf_test.cpp.o.d"
+  "tlsf_test"
+  "tlsf_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tlsf_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/type_discovery_container_test.dir/test-runner.cpp.o"
+  "CMakeFiles/type_discovery_container_test.dir/test-runner.cpp.o.d"
+  "CMakeFiles/type_discovery_container_test.dir/type_discovery_container_test.cpp.o"
+  "CMakeFiles/type_discovery_container_test.dir/type_discovery_container_test.cpp.o.d"
+  "type_discovery_container_test"
+  "type_discovery_container_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/type_discovery_container_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
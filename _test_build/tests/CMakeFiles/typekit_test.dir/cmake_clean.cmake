@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/typekit_test.dir/test-runner.cpp.o"
+  "CMakeFiles/typekit_test.dir/test-runner.cpp.o.d"
+  "CMakeFiles/typekit_test.dir/typekit_test.cpp.o"
+  "CMakeFiles/typekit_test.dir/typekit_test.cpp.o.d"
+  "typekit_test"
+  "typekit_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/typekit_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_test.dir/test-runner.cpp.o"
+  "CMakeFiles/types_test.dir/test-runner.cpp.o.d"
+  "CMakeFiles/types_test.dir/types_test.cpp.o"
+  "CMakeFiles/types_test.dir/types_test.cpp.o.d"
+  "types_test"
+  "types_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,97 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_test_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(main-test "/root/repo/_test_build/tests/main-test")
+set_tests_properties(main-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;88;ADD_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(list-test "/root/repo/_test_build/tests/list-test")
+set_tests_properties(list-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;95;ADD_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(core-test "/root/repo/_test_build/tests/core-test")
+set_tests_properties(core-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;110;ADD_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(task-test "/root/repo/_test_build/tests/task-test")
+set_tests_properties(task-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;116;ADD_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(specactivities-test "/root/repo/_test_build/tests/specactivities-test")
+set_tests_properties(specactivities-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;124;ADD_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(mqueue-test "/root/repo/_test_build/tests/mqueue-test")
+set_tests_properties(mqueue-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;191;ADD_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(mqueue_archive_test "/root/repo/_test_build/tests/mqueue_archive_test")
+set_tests_properties(mqueue_archive_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;194;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(shm-test "/root/repo/_test_build/tests/shm-test")
+set_tests_properties(shm-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;204;ADD_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(buffers_test "/root/repo/_test_build/tests/buffers_test")
+set_tests_properties(buffers_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;249;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(method_test "/root/repo/_test_build/tests/method_test")
+set_tests_properties(method_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;252;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(remote_method_test "/root/repo/_test_build/tests/remote_method_test")
+set_tests_properties(remote_method_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;254;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(functors_test "/root/repo/_test_build/tests/functors_test")
+set_tests_properties(functors_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;256;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(service_test "/root/repo/_test_build/tests/service_test")
+set_tests_properties(service_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;257;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(service_port_test "/root/repo/_test_build/tests/service_port_test")
+set_tests_properties(service_port_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;258;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(event_test "/root/repo/_test_build/tests/event_test")
+set_tests_properties(event_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;259;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(operation_test "/root/repo/_test_build/tests/operation_test")
+set_tests_properties(operation_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;260;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(operation_performance_test "/root/repo/_test_build/tests/operation_performance_test")
+set_tests_properties(operation_performance_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;261;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(taskstates_test "/root/repo/_test_build/tests/taskstates_test")
+set_tests_properties(taskstates_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;262;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(channelelements_test "/root/repo/_test_build/tests/channelelements_test")
+set_tests_properties(channelelements_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;263;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ports_test "/root/repo/_test_build/tests/ports_test")
+set_tests_properties(ports_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;264;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(dataflow_performance_test "/root/repo/_test_build/tests/dataflow_performance_test")
+set_tests_properties(dataflow_performance_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;265;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(dataobject_performance_test "/root/repo/_test_build/tests/dataobject_performance_test")
+set_tests_properties(dataobject_performance_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;266;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(configuration_test "/root/repo/_test_build/tests/configuration_test")
+set_tests_properties(configuration_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;267;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(slave_test "/root/repo/_test_build/tests/slave_test")
+set_tests_properties(slave_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;271;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(scripting_test "/root/repo/_test_build/tests/scripting_test")
+set_tests_properties(scripting_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;273;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(types_test "/root/repo/_test_build/tests/types_test")
+set_tests_properties(types_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;274;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(program_test "/root/repo/_test_build/tests/program_test")
+set_tests_properties(program_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;275;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(state_test "/root/repo/_test_build/tests/state_test")
+set_tests_properties(state_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;276;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(rtstring_test "/root/repo/_test_build/tests/rtstring_test")
+set_tests_properties(rtstring_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;278;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tlsf_test "/root/repo/_test_build/tests/tlsf_test")
+set_tests_properties(tlsf_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;279;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(function_test "/root/repo/_test_build/tests/function_test")
+set_tests_properties(function_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;282;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(enum_type_test "/root/repo/_test_build/tests/enum_type_test")
+set_tests_properties(enum_type_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;285;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(enum_string_type_test "/root/repo/_test_build/tests/enum_string_type_test")
+set_tests_properties(enum_string_type_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;286;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(marshalling_test "/root/repo/_test_build/tests/marshalling_test")
+set_tests_properties(marshalling_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;287;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(property_loader_test "/root/repo/_test_build/tests/property_loader_test")
+set_tests_properties(property_loader_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;288;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(property_marsh_test "/root/repo/_test_build/tests/property_marsh_test")
+set_tests_properties(property_marsh_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;289;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(property_test "/root/repo/_test_build/tests/property_test")
+set_tests_properties(property_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;291;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(property_composition_test "/root/repo/_test_build/tests/property_composition_test")
+set_tests_properties(property_composition_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;292;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(type_discovery_test "/root/repo/_test_build/tests/type_discovery_test")
+set_tests_properties(type_discovery_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;293;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(type_discovery_struct_test "/root/repo/_test_build/tests/type_discovery_struct_test")
+set_tests_properties(type_discovery_struct_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;294;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(type_discovery_container_test "/root/repo/_test_build/tests/type_discovery_container_test")
+set_tests_properties(type_discovery_container_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;295;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(datasource_test "/root/repo/_test_build/tests/datasource_test")
+set_tests_properties(datasource_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;296;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(typekit_test "/root/repo/_test_build/tests/typekit_test")
+set_tests_properties(typekit_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;297;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+add_test(plugins_test "/root/repo/_test_build/tests/plugins_test")
+set_tests_properties(plugins_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/AddUnitTest.cmake;8;ADD_TEST;/root/repo/tests/CMakeLists.txt;299;ADD_UNIT_TEST;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("testproject/plugins")
+subdirs("testproject/types")
+subdirs("testtypes/types")
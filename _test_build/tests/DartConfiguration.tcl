@@ -0,0 +1 @@
+/root/repo/_test_build/DartConfiguration.tcl
\ No newline at end of file
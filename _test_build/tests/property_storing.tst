@@ -0,0 +1,27 @@
+<?xml version="1.0" encoding="UTF-8"?>
+<!DOCTYPE properties SYSTEM "cpf.dtd">
+<properties>
+  <simple name="pstring" type="string"><description>pstringd</description><value>Hello World</value></simple>
+  <simple name="pchar" type="char"><description>pchard</description><value>H</value></simple>
+  <simple name="pdouble" type="double"><description>pdoubled</description><value>1.23456000000000010174972</value></simple>
+  <struct name="pdoubles" type="array">
+     <description>pdoublesd</description>
+     <simple name="Element0" type="double"><description>Sequence Element</description><value>4.123000000000000220268248</value></simple>
+     <simple name="Element1" type="double"><description>Sequence Element</description><value>4.123000000000000220268248</value></simple>
+     <simple name="Element2" type="double"><description>Sequence Element</description><value>4.123000000000000220268248</value></simple>
+  </struct>
+  <struct name="newbag" type="PropertyBag">
+     <description>newbag doc</description>
+     <simple name="pdouble" type="double"><description>pdoubled</description><value>1.23456000000000010174972</value></simple>
+     <struct name="pdoubles" type="array">
+        <description>pdoublesd</description>
+        <simple name="Element0" type="double"><description>Sequence Element</description><value>4.123000000000000220268248</value></simple>
+        <simple name="Element1" type="double"><description>Sequence Element</description><value>4.123000000000000220268248</value></simple>
+        <simple name="Element2" type="double"><description>Sequence Element</description><value>4.123000000000000220268248</value></simple>
+     </struct>
+     <struct name="pbag" type="PropertyBag">
+        <description>pbagd</description>
+        <simple name="pchar" type="char"><description>pchard</description><value>H</value></simple>
+     </struct>
+  </struct>
+</properties>
@@ -0,0 +1,7 @@
+<?xml version="1.0" encoding="UTF-8"?>
+<!DOCTYPE properties SYSTEM "cpf.dtd">
+<properties>
+  <struct name="bag" type="PropertyBag">
+     <description>bag doc</description>
+  </struct>
+</properties>
@@ -0,0 +1,11 @@
+<?xml version="1.0" encoding="UTF-8"?>
+<!DOCTYPE properties SYSTEM "cpf.dtd">
+<properties>
+  <struct name="b1" type="PropertyBag">
+     <description>b1d</description>
+     <struct name="b2" type="PropertyBag">
+        <description>b2d</description>
+        <simple name="p1" type="long"><description>p1d</description><value>-1</value></simple>
+     </struct>
+  </struct>
+</properties>
@@ -0,0 +1,14 @@
+<?xml version="1.0" encoding="UTF-8"?>
+<!DOCTYPE properties SYSTEM "cpf.dtd">
+<properties>
+  <struct name="p1" type="array">
+     <description>p1d</description>
+     <simple name="Element0" type="double"><description>Sequence Element</description><value>1.233999999999999985789145</value></simple>
+     <simple name="Element1" type="double"><description>Sequence Element</description><value>1.233999999999999985789145</value></simple>
+     <simple name="Element2" type="double"><description>Sequence Element</description><value>1.233999999999999985789145</value></simple>
+     <simple name="Element3" type="double"><description>Sequence Element</description><value>1.233999999999999985789145</value></simple>
+     <simple name="Element4" type="double"><description>Sequence Element</description><value>1.233999999999999985789145</value></simple>
+     <simple name="Element5" type="double"><description>Sequence Element</description><value>1.233999999999999985789145</value></simple>
+     <simple name="Element6" type="double"><description>Sequence Element</description><value>1.233999999999999985789145</value></simple>
+  </struct>
+</properties>
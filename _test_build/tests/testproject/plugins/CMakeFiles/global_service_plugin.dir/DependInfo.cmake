@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/testproject/plugins/plugins_test_global_services.cpp" "tests/testproject/plugins/CMakeFiles/global_service_plugin.dir/plugins_test_global_services.cpp.o" "gcc" "tests/testproject/plugins/CMakeFiles/global_service_plugin.dir/plugins_test_global_services.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/tests/testproject/plugins/libglobal_service_plugin-gnulinux.so" "/root/repo/_test_build/tests/testproject/plugins/libglobal_service_plugin-gnulinux.so.2.8.99"
+  "/root/repo/_test_build/tests/testproject/plugins/libglobal_service_plugin-gnulinux.so.2.8" "/root/repo/_test_build/tests/testproject/plugins/libglobal_service_plugin-gnulinux.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/global_service_plugin.dir/plugins_test_global_services.cpp.o"
+  "CMakeFiles/global_service_plugin.dir/plugins_test_global_services.cpp.o.d"
+  "libglobal_service_plugin-gnulinux.pdb"
+  "libglobal_service_plugin-gnulinux.so"
+  "libglobal_service_plugin-gnulinux.so.2.8"
+  "libglobal_service_plugin-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/global_service_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/service_plugin.dir/plugins_test_services.cpp.o"
+  "CMakeFiles/service_plugin.dir/plugins_test_services.cpp.o.d"
+  "libservice_plugin-gnulinux.pdb"
+  "libservice_plugin-gnulinux.so"
+  "libservice_plugin-gnulinux.so.2.8"
+  "libservice_plugin-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/service_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
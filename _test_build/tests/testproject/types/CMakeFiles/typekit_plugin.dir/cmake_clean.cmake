@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/typekit_plugin.dir/plugins_test_types.cpp.o"
+  "CMakeFiles/typekit_plugin.dir/plugins_test_types.cpp.o.d"
+  "libtypekit_plugin-gnulinux.pdb"
+  "libtypekit_plugin-gnulinux.so"
+  "libtypekit_plugin-gnulinux.so.2.8"
+  "libtypekit_plugin-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/typekit_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/testtypes/types/array_types.cpp" "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/array_types.cpp.o" "gcc" "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/array_types.cpp.o.d"
+  "/root/repo/tests/testtypes/types/plugins_test_types.cpp" "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/plugins_test_types.cpp.o" "gcc" "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/plugins_test_types.cpp.o.d"
+  "/root/repo/tests/testtypes/types/sequence_types.cpp" "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/sequence_types.cpp.o" "gcc" "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/sequence_types.cpp.o.d"
+  "/root/repo/tests/testtypes/types/struct_types.cpp" "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/struct_types.cpp.o" "gcc" "tests/testtypes/types/CMakeFiles/testtypes_plugin.dir/struct_types.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/tests/testtypes/types/libtypekit_plugin-gnulinux.so" "/root/repo/_test_build/tests/testtypes/types/libtypekit_plugin-gnulinux.so.2.8.99"
+  "/root/repo/_test_build/tests/testtypes/types/libtypekit_plugin-gnulinux.so.2.8" "/root/repo/_test_build/tests/testtypes/types/libtypekit_plugin-gnulinux.so.2.8.99"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/rtt/CMakeFiles/orocos-rtt-gnulinux_dynamic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testtypes_plugin.dir/array_types.cpp.o"
+  "CMakeFiles/testtypes_plugin.dir/array_types.cpp.o.d"
+  "CMakeFiles/testtypes_plugin.dir/plugins_test_types.cpp.o"
+  "CMakeFiles/testtypes_plugin.dir/plugins_test_types.cpp.o.d"
+  "CMakeFiles/testtypes_plugin.dir/sequence_types.cpp.o"
+  "CMakeFiles/testtypes_plugin.dir/sequence_types.cpp.o.d"
+  "CMakeFiles/testtypes_plugin.dir/struct_types.cpp.o"
+  "CMakeFiles/testtypes_plugin.dir/struct_types.cpp.o.d"
+  "libtypekit_plugin-gnulinux.pdb"
+  "libtypekit_plugin-gnulinux.so"
+  "libtypekit_plugin-gnulinux.so.2.8"
+  "libtypekit_plugin-gnulinux.so.2.8.99"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testtypes_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
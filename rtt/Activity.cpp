@@ -102,6 +102,15 @@ namespace RTT
          Thread::setPeriod(0,0);
      }
 
+     Activity::Activity(int scheduler, int priority, Seconds period, const os::CpuSet& cpus, RunnableInterface* r, const std::string& name )
+     : ActivityInterface(r), os::Thread(scheduler, priority, period, 0, name ),
+       update_period(period), mtimeout(false), mstopRequested(false), mwaitpolicy(ORO_WAIT_ABS)
+     {
+         Thread::setPeriod(0,0);
+         if ( !Thread::setCpuSet(cpus) )
+             log(Error) << "Failed to set the cpus of " << name << " to " << cpus << endlog();
+     }
+
     Activity::~Activity()
     {
         stop();
@@ -172,6 +181,8 @@ namespace RTT
 
     void Activity::loop() {
         nsecs wakeup = 0;
+        // the wakeup time of a timed out period, for the statistics.
+        nsecs timer_mark = 0;
         int overruns = 0;
         while ( true ) {
             // since update_period may be changed at any time, we need to recheck it each time:
@@ -189,8 +200,14 @@ namespace RTT
             if (mtimeout) {
                 // was a timeout() call, or internally generated after wakeup
                 mtimeout = false;
+                nsecs start = ( mstats_enabled && timer_mark != 0 ) ? os::TimeService::Instance()->getNSecs() : 0;
                 this->step();
                 this->work(base::RunnableInterface::TimeOut);
+                if ( start != 0 ) {
+                    nsecs end = os::TimeService::Instance()->getNSecs();
+                    this->updateStatistics( start > timer_mark ? start - timer_mark : 0, end - start, end > wakeup );
+                }
+                timer_mark = 0;
             } else {
                 // was a trigger() call
                 if ( update_period > 0 ) {
@@ -223,6 +240,7 @@ namespace RTT
 
                     // calculate next wakeup point
                     nsecs nsperiod = Seconds_to_nsecs(update_period);
+                    timer_mark = wakeup;
                     wakeup = wakeup + nsperiod;
 
                     // detect overruns
@@ -347,6 +365,26 @@ namespace RTT
         return Thread::setCpuAffinity(cpu);
     }
 
+    os::CpuSet Activity::getCpuSet() const
+    {
+        return Thread::getCpuSet();
+    }
+
+    bool Activity::setCpuSet(const os::CpuSet& cpus)
+    {
+        return Thread::setCpuSet(cpus);
+    }
+
+    int Activity::getNumaNode() const
+    {
+        return Thread::getNumaNode();
+    }
+
+    bool Activity::setNumaNode(int node)
+    {
+        return Thread::setNumaNode(node);
+    }
+
     void Activity::setWaitPeriodPolicy(int p)
     {
         mwaitpolicy = p;
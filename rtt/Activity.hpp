@@ -160,6 +160,25 @@ namespace RTT
         Activity(int scheduler, int priority, Seconds period, unsigned cpu_affinity,
                  base::RunnableInterface* r = 0, const std::string& name ="Activity");
 
+        /**
+         * @brief Create an Activity with a given scheduler type, priority, period and set of cpus.
+         *
+         * @param scheduler
+         *        The scheduler in which the activity's thread must run. Use ORO_SCHED_OTHER or
+         *        ORO_SCHED_RT.
+         * @param priority
+         *        The priority of this activity.
+         * @param period
+         *        The periodicity of the Activity
+         * @param cpus
+         *        The cpus to run on, which may include cpus above 31.
+         * @param r
+         *        The optional base::RunnableInterface to run exclusively within this Activity
+         * @param name The name of the underlying thread.
+         */
+        Activity(int scheduler, int priority, Seconds period, const os::CpuSet& cpus,
+                 base::RunnableInterface* r = 0, const std::string& name ="Activity");
+
         /**
          * Stops and terminates a Activity
          */
@@ -189,6 +208,14 @@ namespace RTT
 
         virtual bool setCpuAffinity(unsigned cpu);
 
+        virtual os::CpuSet getCpuSet() const;
+
+        virtual bool setCpuSet(const os::CpuSet& cpus);
+
+        virtual int getNumaNode() const;
+
+        virtual bool setNumaNode(int node);
+
         void setWaitPeriodPolicy(int p);
 
         virtual os::ThreadInterface* thread();
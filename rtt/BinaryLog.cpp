@@ -0,0 +1,610 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "BinaryLog.hpp"
+#include "os/Atomic.hpp"
+#include "os/CAS.hpp"
+#include "os/Mutex.hpp"
+#include "os/MutexLock.hpp"
+#include "os/Semaphore.hpp"
+#include "os/Thread.hpp"
+#include "os/TimeService.hpp"
+#include <vector>
+#include <sstream>
+#include <cstdio>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#if defined(__GNUC__)
+#  define ORO_BINLOG_TLS __thread
+#elif defined(_MSC_VER)
+#  define ORO_BINLOG_TLS __declspec(thread)
+#endif
+
+namespace RTT
+{
+    using namespace std;
+    using os::TimeService;
+
+    namespace {
+        /**
+         * The layout of the files, which tools/scripts/rtt-binlog-decode.py
+         * reads. All numbers are in the byte order of the host.
+         */
+        struct FileHeader
+        {
+            char magic[8];              // "RTTBLOG1"
+            boost::uint32_t index;      // the number of the file since open()
+            boost::uint32_t size;       // the size of the mapped file
+            boost::int64_t origin;      // the nsecs of open(), the time origin of the messages
+            boost::int64_t reserved;
+        };
+
+        /**
+         * Precedes each record. The records are padded to eight bytes and
+         * a record with size zero ends the file.
+         */
+        struct RecordHeader
+        {
+            boost::uint32_t size;       // including this header and the padding
+            boost::uint16_t kind;       // one of RecordKind
+            boost::uint16_t thread;     // the id of the writing thread
+            boost::uint32_t id;         // the site or module id
+            boost::uint32_t module;     // the module id of a message, the level of a site
+            boost::int64_t stamp;       // nsecs since origin
+        };
+
+        /**
+         * Sites and modules are followed by a 32 bit length and their text,
+         * messages by their tagged arguments.
+         */
+        enum RecordKind { SiteRecord = 1, ModuleRecord = 2, MessageRecord = 3 };
+
+        /**
+         * A mapped file. Writers reserve a record by advancing offset
+         * with a compare and swap and count themselves in users until
+         * the record is filled in. A sealed file has file_size added to
+         * its offset, such that no record fits any more.
+         */
+        struct MappedFile
+        {
+            char* mapping;
+            int fd;
+            unsigned int index;
+            volatile int offset;
+            os::AtomicInt users;
+        };
+
+        /**
+         * The current file, the standby file which the rotator maps
+         * ahead of time and the previous file until it is unmapped.
+         */
+        enum { MappedCount = 3 };
+        MappedFile mapped[MappedCount];
+        MappedFile* volatile current = 0;
+        MappedFile* volatile standby = 0;
+
+        /**
+         * Serializes open() and close(), the registration of sites and
+         * modules and the publication of the standby file. Messages
+         * are written without it.
+         */
+        os::Mutex lock;
+        string basename;
+        unsigned int file_size = 0;
+        unsigned int file_count = 0;
+        unsigned int next_index = 0;
+        boost::int64_t origin = 0;
+        os::AtomicInt dropped;
+        volatile int threads = 0;
+
+        /**
+         * The registered sites, which are written again at the start of
+         * every file, protected by lock.
+         */
+        vector<BinaryLog::Site*> sites;
+
+        /**
+         * The interned module names. A name is looked up without locking
+         * by probing from its hash, and its id is its slot plus one. Id
+         * zero is the default module of the Logger. Slots are filled with
+         * the lock held and are never freed.
+         */
+        struct Module
+        {
+            os::AtomicInt ready;
+            unsigned int hash;
+            string name;
+        };
+        enum { ModuleCount = 256 };
+        Module modules[ModuleCount];
+        const char* default_module = "Logger";
+
+#ifdef ORO_BINLOG_TLS
+        ORO_BINLOG_TLS unsigned int thread_module = 0;
+        ORO_BINLOG_TLS unsigned int thread_id = 0;
+        ORO_BINLOG_TLS MappedFile* thread_file = 0;
+#else
+        unsigned int thread_module = 0;
+        unsigned int thread_id = 0;
+        MappedFile* thread_file = 0;
+#endif
+
+        unsigned int padded(unsigned int size)
+        {
+            return (size + 7) & ~7u;
+        }
+
+        unsigned int hashName(const string& name)
+        {
+            unsigned int h = 2166136261u;
+            for (string::const_iterator it = name.begin(); it != name.end(); ++it)
+                h = (h ^ (unsigned char)*it) * 16777619u;
+            return h;
+        }
+
+        string fileName(unsigned int index)
+        {
+            stringstream name;
+            name << basename << "." << index;
+            return name.str();
+        }
+
+        /**
+         * Returns the current file, which is not unmapped until
+         * release() is called, or null if the log is closed.
+         */
+        MappedFile* acquire()
+        {
+            for (;;) {
+                MappedFile* f = current;
+                if ( !f )
+                    return 0;
+                f->users.inc();
+                if ( f == current )
+                    return f;
+                f->users.dec();
+            }
+        }
+
+        void release(MappedFile* f)
+        {
+            f->users.dec();
+        }
+
+        /**
+         * Reserves a record with \a size bytes of payload in \a f and
+         * fills in its header. Returns where the payload goes, or null
+         * if \a f is full.
+         */
+        char* append(MappedFile* f, RecordKind kind, unsigned int id, unsigned int module, unsigned int size)
+        {
+            unsigned int total = padded( sizeof(RecordHeader) + size );
+            int o;
+            do {
+                o = f->offset;
+                if ( (unsigned int)o + total >= file_size )
+                    return 0;
+            } while ( !os::CAS( &f->offset, o, o + (int)total ) );
+
+            RecordHeader* h = reinterpret_cast<RecordHeader*>( f->mapping + o );
+            h->size = total;
+            h->kind = kind;
+            h->thread = thread_id;
+            h->id = id;
+            h->module = module;
+            h->stamp = TimeService::Instance()->getNSecs() - origin;
+            return reinterpret_cast<char*>(h + 1);
+        }
+
+        bool appendText(MappedFile* f, RecordKind kind, unsigned int id, unsigned int module, const string& text)
+        {
+            boost::uint32_t len = text.size();
+            char* p = append( f, kind, id, module, sizeof(len) + len );
+            if ( !p )
+                return false;
+            memcpy( p, &len, sizeof(len) );
+            memcpy( p + sizeof(len), text.data(), len );
+            return true;
+        }
+
+        /**
+         * Makes all further records go to the next file.
+         */
+        void seal(MappedFile* f)
+        {
+            int o;
+            do {
+                o = f->offset;
+                if ( (unsigned int)o >= file_size )
+                    return;
+            } while ( !os::CAS( &f->offset, o, o + (int)file_size ) );
+        }
+
+        /**
+         * Writes a site or module record into the current and the standby
+         * file. A current file which has no room for it is sealed, such
+         * that no message in it refers to an unknown site or module.
+         * Called with the lock held, which keeps the standby file mapped.
+         */
+        void appendDefinition(RecordKind kind, unsigned int id, unsigned int module, const string& text)
+        {
+            MappedFile* c = acquire();
+            if ( c ) {
+                if ( !appendText( c, kind, id, module, text ) )
+                    seal( c );
+                release( c );
+            }
+            MappedFile* s = standby;
+            if ( s && s != c )
+                appendText( s, kind, id, module, text );
+        }
+
+        /**
+         * Writes the known modules and sites at the start of \a f.
+         * Called with the lock held.
+         */
+        void appendDefinitions(MappedFile* f)
+        {
+            appendText( f, ModuleRecord, 0, 0, default_module );
+            for (unsigned int i = 0; i != ModuleCount; ++i)
+                if ( modules[i].ready.read() )
+                    appendText( f, ModuleRecord, i + 1, 0, modules[i].name );
+            for (unsigned int i = 0; i != sites.size(); ++i)
+                appendText( f, SiteRecord, sites[i]->id, sites[i]->level, sites[i]->format );
+        }
+
+        /**
+         * Creates and maps the file \a index into \a f.
+         */
+        bool mapFile(MappedFile* f, unsigned int index)
+        {
+#ifndef _WIN32
+            string name = fileName(index);
+            int fd = ::open( name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+            if ( fd == -1 ) {
+                log(Error) << "BinaryLog: could not create " << name << endlog();
+                return false;
+            }
+            // the file is zero filled, which terminates the records.
+            if ( ftruncate( fd, file_size ) == -1 ) {
+                log(Error) << "BinaryLog: could not resize " << name << " to " << file_size << " bytes." << endlog();
+                ::close( fd );
+                return false;
+            }
+            void* m = mmap( 0, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            if ( m == MAP_FAILED ) {
+                log(Error) << "BinaryLog: could not map " << name << endlog();
+                ::close( fd );
+                return false;
+            }
+
+            FileHeader* h = static_cast<FileHeader*>( m );
+            memcpy( h->magic, "RTTBLOG1", sizeof(h->magic) );
+            h->index = index;
+            h->size = file_size;
+            h->origin = origin;
+            h->reserved = 0;
+            f->mapping = static_cast<char*>(m);
+            f->fd = fd;
+            f->index = index;
+            f->offset = sizeof(FileHeader);
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * Waits until no writer uses \a f any more.
+         */
+        void waitUnused(MappedFile* f)
+        {
+#ifndef _WIN32
+            while ( f->users.read() != 0 )
+                sched_yield();
+#endif
+        }
+
+        /**
+         * Truncates the file of \a f to its records and unmaps it.
+         */
+        void unmapFile(MappedFile* f)
+        {
+#ifndef _WIN32
+            waitUnused( f );
+            unsigned int end = f->offset;
+            if ( end >= file_size )
+                end -= file_size;
+            munmap( f->mapping, file_size );
+            f->mapping = 0;
+            if ( ftruncate( f->fd, end ) == -1 )
+                log(Warning) << "BinaryLog: could not truncate " << fileName(f->index) << endlog();
+            ::close( f->fd );
+            f->fd = -1;
+#endif
+        }
+
+        void removeFile(unsigned int index)
+        {
+#ifndef _WIN32
+            unlink( fileName( index ).c_str() );
+#endif
+        }
+
+        /**
+         * Removes the file which is no longer kept now that \a index
+         * is the current file.
+         */
+        void removeOld(unsigned int index)
+        {
+            if ( index >= file_count )
+                removeFile( index - file_count );
+        }
+
+        /**
+         * Unmaps the previous file after a writer switched to the standby
+         * file and maps the next standby file, such that the writers
+         * never wait for the file system.
+         */
+        struct Rotator : public os::Thread
+        {
+            os::Semaphore sem;
+            volatile bool done;
+            MappedFile* active;
+
+            Rotator(MappedFile* first)
+                : os::Thread(ORO_SCHED_OTHER, os::LowestPriority, 0.0, 0, "BinaryLogRotator"),
+                  sem(0), done(false), active(first)
+            {}
+
+            void loop()
+            {
+                while ( !done ) {
+                    sem.wait();
+                    if ( !done )
+                        update();
+                }
+            }
+
+            bool breakLoop()
+            {
+                done = true;
+                sem.signal();
+                return true;
+            }
+
+            void update()
+            {
+                MappedFile* c = current;
+                if ( c && c != active ) {
+                    unmapFile( active );
+                    removeOld( c->index );
+                    active = c;
+                }
+                if ( !c || standby )
+                    return;
+                MappedFile* f = 0;
+                for (unsigned int i = 0; i != MappedCount && !f; ++i)
+                    if ( mapped[i].mapping == 0 )
+                        f = &mapped[i];
+                if ( f && mapFile( f, next_index ) ) {
+                    os::MutexLock locker( lock );
+                    appendDefinitions( f );
+                    ++next_index;
+                    standby = f;
+                }
+            }
+        };
+
+        Rotator* rotator = 0;
+
+        /**
+         * Switches from the full file \a f to the standby file. Returns
+         * false if no standby file is mapped, in which case the message
+         * is dropped. Called while using \a f.
+         */
+        bool next(MappedFile* f)
+        {
+            if ( current != f )
+                return true;
+            MappedFile* s = standby;
+            if ( !s || s == f )
+                return false;
+            if ( os::CAS( &current, f, s ) ) {
+                standby = 0;
+                rotator->sem.signal();
+            }
+            return true;
+        }
+
+        unsigned int registerModule(const string& module, unsigned int h)
+        {
+            os::MutexLock locker( lock );
+            for (unsigned int i = 0; i != ModuleCount; ++i) {
+                unsigned int slot = (h + i) % ModuleCount;
+                Module& m = modules[slot];
+                if ( m.ready.read() ) {
+                    if ( m.hash == h && m.name == module )
+                        return slot + 1;
+                    continue;
+                }
+                m.hash = h;
+                m.name = module;
+                if ( BinaryLog::isOpen() )
+                    appendDefinition( ModuleRecord, slot + 1, 0, module );
+                m.ready.inc();
+                return slot + 1;
+            }
+            // all slots are taken.
+            return 0;
+        }
+
+        bool registerSite(BinaryLog::Site& site)
+        {
+            os::MutexLock locker( lock );
+            if ( site.id != 0 )
+                return true;
+            if ( !BinaryLog::isOpen() )
+                return false;
+            sites.push_back( &site );
+            appendDefinition( SiteRecord, sites.size(), site.level, site.format );
+            site.id = sites.size();
+            return true;
+        }
+    }
+
+    bool BinaryLog::mopen = false;
+
+    bool BinaryLog::open(const std::string& name, unsigned int size, unsigned int files)
+    {
+        close();
+        os::MutexLock locker( lock );
+        basename = name;
+        file_size = size;
+        file_count = files ? files : 1;
+        origin = TimeService::Instance()->getNSecs();
+        for (vector<Site*>::iterator it = sites.begin(); it != sites.end(); ++it)
+            (*it)->id = 0;
+        sites.clear();
+        if ( size < sizeof(FileHeader) || !mapFile( &mapped[0], 0 ) )
+            return false;
+        appendDefinitions( &mapped[0] );
+        next_index = 1;
+        if ( mapFile( &mapped[1], next_index ) ) {
+            appendDefinitions( &mapped[1] );
+            standby = &mapped[1];
+            ++next_index;
+        }
+        rotator = new Rotator( &mapped[0] );
+        rotator->start();
+        current = &mapped[0];
+        mopen = true;
+        return true;
+    }
+
+    void BinaryLog::close()
+    {
+        if ( !rotator )
+            return;
+        mopen = false;
+        MappedFile* c;
+        do {
+            c = current;
+        } while ( !os::CAS( &current, c, (MappedFile*)0 ) );
+        // next() signals the rotator while it uses a file.
+        for (unsigned int i = 0; i != MappedCount; ++i)
+            waitUnused( &mapped[i] );
+        rotator->stop();
+        MappedFile* active = rotator->active;
+        delete rotator;
+        rotator = 0;
+
+        os::MutexLock locker( lock );
+        if ( c && c != active )
+            removeOld( c->index );
+        // the standby file never became current and holds no messages.
+        MappedFile* s = standby;
+        standby = 0;
+        for (unsigned int i = 0; i != MappedCount; ++i)
+            if ( mapped[i].mapping ) {
+                unmapFile( &mapped[i] );
+                if ( &mapped[i] == s )
+                    removeFile( s->index );
+            }
+    }
+
+    void BinaryLog::setModule(const std::string& module)
+    {
+        if ( module == default_module ) {
+            thread_module = 0;
+            return;
+        }
+        unsigned int h = hashName( module );
+        for (unsigned int i = 0; i != ModuleCount; ++i) {
+            unsigned int slot = (h + i) % ModuleCount;
+            if ( !modules[slot].ready.read() )
+                break;
+            if ( modules[slot].hash == h && modules[slot].name == module ) {
+                thread_module = slot + 1;
+                return;
+            }
+        }
+        thread_module = registerModule( module, h );
+    }
+
+    unsigned int BinaryLog::getDroppedMessages()
+    {
+        return dropped.read();
+    }
+
+    char* BinaryLog::begin(Site& site, unsigned int size)
+    {
+        if ( site.id == 0 && !registerSite( site ) )
+            return 0;
+        if ( thread_id == 0 ) {
+            int t;
+            do {
+                t = threads;
+            } while ( !os::CAS( &threads, t, t + 1 ) );
+            thread_id = t + 1;
+        }
+        unsigned int total = padded( sizeof(RecordHeader) + size );
+        for (;;) {
+            MappedFile* f = acquire();
+            if ( !f )
+                return 0;
+            char* p = append( f, MessageRecord, site.id, thread_module, size );
+            if ( p ) {
+                // a zero tag ends the arguments in the padding.
+                memset( p + size, 0, total - sizeof(RecordHeader) - size );
+                thread_file = f;
+                return p;
+            }
+            // a message which does not fit in an empty file is never written.
+            bool switched = sizeof(FileHeader) + total < file_size && next( f );
+            release( f );
+            if ( !switched ) {
+                dropped.inc();
+                return 0;
+            }
+        }
+    }
+
+    void BinaryLog::end()
+    {
+        release( thread_file );
+    }
+}
@@ -0,0 +1,265 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef ORO_BINARY_LOG_HPP
+#define ORO_BINARY_LOG_HPP
+
+#include "rtt-config.h"
+#include "Logger.hpp"
+#include <string>
+#include <cstring>
+#include <boost/cstdint.hpp>
+
+namespace RTT
+{
+    namespace internal {
+        /**
+         * Writes an argument of a BinaryLog message as a one character
+         * type tag followed by its raw bytes. Specialised for the
+         * arithmetic types and strings.
+         */
+        template<class T>
+        struct BinaryLogArg;
+
+        template<class T, char Tag, class Stored>
+        struct BinaryLogValue
+        {
+            static unsigned int size(const T&) { return 1 + sizeof(Stored); }
+            static char* write(char* p, const T& t) {
+                Stored s = t;
+                *p = Tag;
+                std::memcpy( p + 1, &s, sizeof(Stored) );
+                return p + 1 + sizeof(Stored);
+            }
+        };
+
+        struct BinaryLogString
+        {
+            static unsigned int size(const char* s, boost::uint32_t len) { return 1 + sizeof(len) + len; }
+            static char* write(char* p, const char* s, boost::uint32_t len) {
+                *p = 's';
+                std::memcpy( p + 1, &len, sizeof(len) );
+                std::memcpy( p + 1 + sizeof(len), s, len );
+                return p + 1 + sizeof(len) + len;
+            }
+        };
+
+        template<> struct BinaryLogArg<bool> : public BinaryLogValue<bool, 'b', boost::uint8_t> {};
+        template<> struct BinaryLogArg<char> : public BinaryLogValue<char, 'c', char> {};
+        template<> struct BinaryLogArg<short> : public BinaryLogValue<short, 'i', boost::int32_t> {};
+        template<> struct BinaryLogArg<unsigned short> : public BinaryLogValue<unsigned short, 'I', boost::uint32_t> {};
+        template<> struct BinaryLogArg<int> : public BinaryLogValue<int, 'i', boost::int32_t> {};
+        template<> struct BinaryLogArg<unsigned int> : public BinaryLogValue<unsigned int, 'I', boost::uint32_t> {};
+        template<> struct BinaryLogArg<long> : public BinaryLogValue<long, 'l', boost::int64_t> {};
+        template<> struct BinaryLogArg<unsigned long> : public BinaryLogValue<unsigned long, 'L', boost::uint64_t> {};
+        template<> struct BinaryLogArg<long long> : public BinaryLogValue<long long, 'l', boost::int64_t> {};
+        template<> struct BinaryLogArg<unsigned long long> : public BinaryLogValue<unsigned long long, 'L', boost::uint64_t> {};
+        template<> struct BinaryLogArg<float> : public BinaryLogValue<float, 'd', double> {};
+        template<> struct BinaryLogArg<double> : public BinaryLogValue<double, 'd', double> {};
+
+        template<>
+        struct BinaryLogArg<const char*>
+        {
+            static unsigned int size(const char* s) { return BinaryLogString::size( s, std::strlen(s) ); }
+            static char* write(char* p, const char* s) { return BinaryLogString::write( p, s, std::strlen(s) ); }
+        };
+
+        template<> struct BinaryLogArg<char*> : public BinaryLogArg<const char*> {};
+
+        template<std::size_t N>
+        struct BinaryLogArg<char[N]> : public BinaryLogArg<const char*> {};
+
+        template<>
+        struct BinaryLogArg<std::string>
+        {
+            static unsigned int size(const std::string& s) { return BinaryLogString::size( s.data(), s.size() ); }
+            static char* write(char* p, const std::string& s) { return BinaryLogString::write( p, s.data(), s.size() ); }
+        };
+    }
+
+    /**
+     * A binary sink for log messages in hot loops. Instead of formatting
+     * the message, write() copies a format site id, a time stamp, the id
+     * of the calling thread, the Logger::In module of that thread and the
+     * raw bytes of the arguments into a memory mapped file. The messages
+     * are rendered in the Logger text layout offline, with
+     * @verbatim tools/scripts/rtt-binlog-decode.py orocos.blog.* @endverbatim
+     *
+     * A format site is a static Site object with a printf() style format
+     * string, which is best declared with ORO_BINLOG_SITE:
+     * @verbatim
+     ORO_BINLOG_SITE(site, Logger::Debug, "cycle %d took %f s");
+     BinaryLog::write(site, cycle, duration);
+     * @endverbatim
+     * Messages with a level which the Logger would not write to its
+     * log file are discarded. Writing a message takes no lock: only the
+     * first message of a site and the first use of a module in
+     * Logger::In register them under a lock. When a file is full, the
+     * writers continue in the next file, which a low priority thread
+     * maps ahead of time, and only the last files are kept. Messages
+     * are dropped when that thread falls behind.
+     */
+    class RTT_API BinaryLog
+    {
+    public:
+        /**
+         * A format site. Its id is assigned on the first message.
+         */
+        struct Site
+        {
+            const char* format;
+            Logger::LogLevel level;
+            unsigned int id;
+        };
+
+        /**
+         * Starts writing to the files \a basename.0, \a basename.1, ...
+         * of \a file_size bytes each, keeping the last \a files of them.
+         * @return false if the first file could not be mapped.
+         */
+        static bool open(const std::string& basename, unsigned int file_size = 16*1024*1024, unsigned int files = 4);
+
+        /**
+         * Stops writing and truncates the current file to its contents.
+         * Do not call open() or close() from several threads at once.
+         */
+        static void close();
+
+        /**
+         * Returns true between open() and close().
+         */
+        static bool isOpen() { return mopen; }
+
+        /**
+         * Sets the module of the messages of the calling thread.
+         * Called by Logger::in() and Logger::out(). Only locks the
+         * first time a module is used.
+         */
+        static void setModule(const std::string& module);
+
+        /**
+         * Returns the number of messages which were discarded because
+         * they did not fit in a file or the next file was not mapped yet.
+         */
+        static unsigned int getDroppedMessages();
+
+        static void write(Site& site)
+        {
+            if ( !enabled(site) )
+                return;
+            if ( begin(site, 0) )
+                end();
+        }
+
+        template<class A1>
+        static void write(Site& site, const A1& a1)
+        {
+            if ( !enabled(site) )
+                return;
+            char* p = begin(site, internal::BinaryLogArg<A1>::size(a1));
+            if ( !p )
+                return;
+            internal::BinaryLogArg<A1>::write(p, a1);
+            end();
+        }
+
+        template<class A1, class A2>
+        static void write(Site& site, const A1& a1, const A2& a2)
+        {
+            if ( !enabled(site) )
+                return;
+            char* p = begin(site, internal::BinaryLogArg<A1>::size(a1) + internal::BinaryLogArg<A2>::size(a2));
+            if ( !p )
+                return;
+            p = internal::BinaryLogArg<A1>::write(p, a1);
+            internal::BinaryLogArg<A2>::write(p, a2);
+            end();
+        }
+
+        template<class A1, class A2, class A3>
+        static void write(Site& site, const A1& a1, const A2& a2, const A3& a3)
+        {
+            if ( !enabled(site) )
+                return;
+            char* p = begin(site, internal::BinaryLogArg<A1>::size(a1) + internal::BinaryLogArg<A2>::size(a2)
+                            + internal::BinaryLogArg<A3>::size(a3));
+            if ( !p )
+                return;
+            p = internal::BinaryLogArg<A1>::write(p, a1);
+            p = internal::BinaryLogArg<A2>::write(p, a2);
+            internal::BinaryLogArg<A3>::write(p, a3);
+            end();
+        }
+
+        template<class A1, class A2, class A3, class A4>
+        static void write(Site& site, const A1& a1, const A2& a2, const A3& a3, const A4& a4)
+        {
+            if ( !enabled(site) )
+                return;
+            char* p = begin(site, internal::BinaryLogArg<A1>::size(a1) + internal::BinaryLogArg<A2>::size(a2)
+                            + internal::BinaryLogArg<A3>::size(a3) + internal::BinaryLogArg<A4>::size(a4));
+            if ( !p )
+                return;
+            p = internal::BinaryLogArg<A1>::write(p, a1);
+            p = internal::BinaryLogArg<A2>::write(p, a2);
+            p = internal::BinaryLogArg<A3>::write(p, a3);
+            internal::BinaryLogArg<A4>::write(p, a4);
+            end();
+        }
+
+    private:
+        static bool enabled(const Site& site)
+        {
+            return mopen && ( site.level <= Logger::Info || site.level <= Logger::log().getLogLevel() );
+        }
+
+        /**
+         * Reserves a message with \a size bytes of arguments in the
+         * current file. Returns where the arguments go, or null, in
+         * which case end() must not be called.
+         */
+        static char* begin(Site& site, unsigned int size);
+
+        /**
+         * Releases the file after begin().
+         */
+        static void end();
+
+        static bool mopen;
+    };
+}
+
+/**
+ * Declares the static BinaryLog::Site \a name with level \a level
+ * and printf() style format \a format.
+ */
+#define ORO_BINLOG_SITE(name, level, format) \
+    static RTT::BinaryLog::Site name = { format, level, 0 }
+
+#endif
@@ -66,6 +66,10 @@ namespace RTT
         , mandatory(true)
         , transport(0)
         , data_size(0)
+        , zero_copy(false)
+        , statistics(false)
+        , batch_size(0)
+        , batch_period(0.0)
     {}
 
     ConnPolicy &ConnPolicy::Default()
@@ -117,6 +121,10 @@ namespace RTT
         , mandatory(Default().mandatory)
         , transport(Default().transport)
         , data_size(Default().data_size)
+        , zero_copy(Default().zero_copy)
+        , statistics(Default().statistics)
+        , batch_size(Default().batch_size)
+        , batch_period(Default().batch_period)
     {}
 
     ConnPolicy::ConnPolicy(int type)
@@ -130,6 +138,10 @@ namespace RTT
         , mandatory(Default().mandatory)
         , transport(Default().transport)
         , data_size(Default().data_size)
+        , zero_copy(Default().zero_copy)
+        , statistics(Default().statistics)
+        , batch_size(Default().batch_size)
+        , batch_period(Default().batch_period)
     {}
 
     ConnPolicy::ConnPolicy(int type, int lock_policy)
@@ -143,6 +155,10 @@ namespace RTT
         , mandatory(Default().mandatory)
         , transport(Default().transport)
         , data_size(Default().data_size)
+        , zero_copy(Default().zero_copy)
+        , statistics(Default().statistics)
+        , batch_size(Default().batch_size)
+        , batch_period(Default().batch_period)
     {}
 
     std::ostream &operator<<(std::ostream &os, const ConnPolicy &cp)
@@ -164,6 +180,8 @@ namespace RTT
             case ConnPolicy::UNSYNC:    lock_policy = "UNSYNC"; break;
             case ConnPolicy::LOCKED:    lock_policy = "LOCKED"; break;
             case ConnPolicy::LOCK_FREE: lock_policy = "LOCK_FREE"; break;
+            case ConnPolicy::SPSC:      lock_policy = "SPSC"; break;
+            case ConnPolicy::SEQLOCK:   lock_policy = "SEQLOCK"; break;
             default:                    lock_policy = "(unknown lock policy)"; break;
         }
 
@@ -180,6 +198,9 @@ namespace RTT
         os << type;
         if (!cp.name_id.empty()) os << " (name_id=" << cp.name_id << ")";
         if (cp.max_threads > 0) os << " (max_threads=" << cp.max_threads << ")";
+        if (cp.zero_copy) os << " (zero_copy)";
+        if (cp.statistics) os << " (statistics)";
+        if (cp.batch_size > 1) os << " (batch_size=" << cp.batch_size << ", batch_period=" << cp.batch_period << ")";
 
         return os;
     }
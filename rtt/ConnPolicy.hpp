@@ -58,11 +58,17 @@ namespace RTT {
      *       them. BUFFER drops newer samples on full, CIRCULAR_BUFFER drops older samples on full.
      *       UNBUFFERED is only valid for output streaming connections.
      *
-     *  <li> the locking policy: LOCKED, LOCK_FREE or UNSYNC. This defines how locking is done in the
-     *       connection. For now, only three policies are available. LOCKED uses
-     *       mutexes, LOCK_FREE uses a lock free method and UNSYNC means there's no
+     *  <li> the locking policy: LOCKED, LOCK_FREE, SPSC, SEQLOCK or UNSYNC. This defines how locking is done in the
+     *       connection. LOCKED uses mutexes, LOCK_FREE uses a lock free method and UNSYNC means there's no
      *       synchronisation at all (not thread safe). The latter should
      *       be used only when there is no contention (simultaneous write-read).
+     *       SPSC uses a wait-free single-producer/single-consumer buffer for
+     *       buffered connections with exactly one writer and one reader thread.
+     *       If the connection does not have a 1:1 topology, LOCK_FREE is used instead.
+     *       SEQLOCK uses a sequence lock for data connections, where readers never
+     *       write to shared memory while copying a sample. It is best suited for large
+     *       samples and many readers, and is only available for trivially copyable types.
+     *       For other types and for buffered connections, LOCK_FREE is used instead.
      *
      *  <li> if, upon connection, the last value that has been written on the
      *       writer end should be written on the connection as well to
@@ -101,6 +107,15 @@ namespace RTT {
      *       the name contains a port number or file descriptor to be opened.
      *       You only need to provide a name_id if you're using out-of-band transports
      *       without supervisor, for example, when using MQueues without Corba.
+     *
+     *  <li> if the connection passes samples by reference instead of copying them.
+     *       See \ref zero_copy.
+     *
+     *  <li> if statistics about the traffic on the connection are recorded.
+     *       See \ref statistics.
+     *
+     *  <li> if a transport packs several samples in one message.
+     *       See \ref batch_size and \ref batch_period.
      * </ul>
      * @ingroup Ports
      */
@@ -115,6 +130,8 @@ namespace RTT {
         static const int UNSYNC    = 0;
         static const int LOCKED    = 1;
         static const int LOCK_FREE = 2;
+        static const int SPSC      = 3;
+        static const int SEQLOCK   = 4;
 
         static const bool PUSH = false;
         static const bool PULL = true;
@@ -255,6 +272,43 @@ namespace RTT {
          */
         mutable std::string name_id;
 
+        /**
+         * If true, the connection stores references to samples instead of copies,
+         * such that samples published with OutputPort::publish() and read with
+         * InputPort::take() are passed on without copying them. Samples written
+         * with OutputPort::write() are still copied once into the connection.
+         * This only has an effect on in-process connections.
+         */
+        bool   zero_copy;
+
+        /**
+         * If true, the connection records the number of written, read and dropped
+         * samples, the fill level and the latency between writing and reading
+         * each sample. The statistics of all connections of a port can be retrieved
+         * with base::PortInterface::getConnectionStatistics() or with the
+         * \a statistics operation of the port's service. Recording statistics
+         * adds a small overhead to every write and read.
+         */
+        bool   statistics;
+
+        /**
+         * The maximum number of samples a transport may pack into one message.
+         * A value of 0 or 1 sends every sample in its own message, which is the
+         * default. Only transports which document it support batching, currently
+         * the mqueue transport. A batch is sent when it holds \a batch_size
+         * samples, when the next sample does not fit in it anymore or when it
+         * is older than \a batch_period.
+         */
+        int    batch_size;
+
+        /**
+         * The maximum time in seconds a sample may wait in an incomplete batch
+         * before the batch is sent. If zero, an incomplete batch is only sent
+         * when it is explicitly flushed or when a new initial sample is written.
+         * Only used if \a batch_size is larger than one.
+         */
+        double batch_period;
+
     private:
         struct ConnPolicyDefault;
         ConnPolicy(const ConnPolicyDefault &);
@@ -42,7 +42,11 @@
 #include "base/TaskCore.hpp"
 #include "rtt-fwd.hpp"
 #include "os/MutexLock.hpp"
-#include "internal/MWSRQueue.hpp"
+#include "os/Timer.hpp"
+#include "os/threads.hpp"
+#ifndef OROBLD_OS_NO_ASM
+#include "os/CAS.hpp"
+#endif
 #include "TaskContext.hpp"
 #include "internal/CatchConfig.hpp"
 #include "extras/SlaveActivity.hpp"
@@ -51,8 +55,6 @@
 #include <boost/bind.hpp>
 #include <algorithm>
 
-#define ORONUM_EE_MQUEUE_SIZE 100
-
 namespace RTT
 {
     /**
@@ -66,12 +68,40 @@ namespace RTT
     using namespace detail;
     using namespace boost;
 
+    /**
+     * Times out the activity of an engine when an update step which was
+     * deferred by the minimum trigger interval is due.
+     */
+    class ExecutionEngine::UpdateTimer : public os::Timer
+    {
+        ExecutionEngine* mengine;
+    public:
+        UpdateTimer(ExecutionEngine* engine, int scheduler, int priority)
+            : os::Timer(1, scheduler, priority, "UpdateTimer"), mengine(engine) {}
+
+        ~UpdateTimer()
+        {
+            // stop before timeout() becomes unavailable.
+            mThread->stop();
+        }
+
+        void timeout(TimerId)
+        {
+            ActivityInterface* activity = mengine->getActivity();
+            if (activity)
+                activity->timeout();
+        }
+    };
+
     ExecutionEngine::ExecutionEngine( TaskCore* owner )
         : taskc(owner),
-          mqueue(new MWSRQueue<DisposableInterface*>(ORONUM_EE_MQUEUE_SIZE) ),
-          port_queue(new MWSRQueue<PortInterface*>(ORONUM_EE_MQUEUE_SIZE) ),
-          f_queue( new MWSRQueue<ExecutableInterface*>(ORONUM_EE_MQUEUE_SIZE) ),
-          mmaster(0)
+          mqueue(new SegmentedMWSRQueue<DisposableInterface*>(DefaultQueueCapacity) ),
+          port_queue(new SegmentedMWSRQueue<PortInterface*>(DefaultQueueCapacity) ),
+          f_queue( new SegmentedMWSRQueue<ExecutableInterface*>(DefaultQueueCapacity) ),
+          mmaster(0),
+          mmin_trigger_interval(0),
+          mlast_update(0),
+          mupdate_timer(0)
     {
     }
 
@@ -79,6 +109,8 @@ namespace RTT
     {
         Logger::In in("~ExecutionEngine");
 
+        delete mupdate_timer;
+
         ExecutableInterface* foo;
         while ( f_queue->dequeue( foo ) )
             foo->unloaded();
@@ -106,7 +138,7 @@ namespace RTT
             assert(foo);
             if ( foo->execute() == false ){
                 foo->unloaded();
-                msg_cond.broadcast(); // required for waitForFunctions() (3rd party thread)
+                notifyWaiters(); // required for waitForFunctions() (3rd party thread)
             } else {
                 f_queue->enqueue( foo );
             }
@@ -219,7 +251,7 @@ namespace RTT
             MutexLock locker( msg_lock );
         }
         if ( com )
-            msg_cond.broadcast(); // required for waitForMessages() (3rd party thread)
+            notifyWaiters(); // required for waitForMessages() (3rd party thread)
     }
 
     void ExecutionEngine::processPortCallbacks()
@@ -234,6 +266,9 @@ namespace RTT
             {
                 while ( port_queue->dequeue(port) ) {
                     assert( port );
+                    // data arriving from now on requires a new callback.
+                    oro_atomic_set(&port->mcallback_pending, 0);
+                    oro_smp_mb();
                     tc->dataOnPortCallback(port);
                 }
             }
@@ -254,7 +289,7 @@ namespace RTT
         if ( c && this->getActivity() ) {
             bool result = mqueue->enqueue( c );
             this->getActivity()->trigger();
-            msg_cond.broadcast(); // required for waitAndProcessMessages() (EE thread)
+            notifyWaiters(); // required for waitAndProcessMessages() (EE thread)
             return result;
         }
         return false;
@@ -272,13 +307,42 @@ namespace RTT
         }
 
         if ( port && this->getActivity() ) {
+            // a port which is still queued will see the new data in its callback.
+            oro_smp_mb();
+#ifdef OROBLD_OS_NO_ASM
+            {
+                // without atomic instructions, the test-and-set is done under msg_lock.
+                MutexLock locker( msg_lock );
+                if ( oro_atomic_read(&port->mcallback_pending) )
+                    return true;
+                oro_atomic_set(&port->mcallback_pending, 1);
+            }
+#else
+            if ( !os::CAS(&port->mcallback_pending, 0, 1) )
+                return true;
+#endif
             bool result = port_queue->enqueue( port );
+            if ( !result )
+                oro_atomic_set(&port->mcallback_pending, 0);
             this->getActivity()->trigger();
             return result;
         }
         return false;
     }
 
+    void ExecutionEngine::notifyWaiters()
+    {
+        // pairs with the barrier in the waiters: either they see our
+        // message in the queue, or we see them waiting.
+        oro_smp_mb();
+        if ( mwaiters.read() == 0 )
+            return;
+        // a waiter may be between its last check and the wait(),
+        // taking the lock guarantees it is waiting when we broadcast.
+        MutexLock locker( msg_lock );
+        msg_cond.broadcast();
+    }
+
     void ExecutionEngine::waitForMessages(const boost::function<bool(void)>& pred)
     {
         // forward the call to the master ExecutionEngine which is processing messages for us...
@@ -330,9 +394,11 @@ namespace RTT
             return;
         // only to be called from the thread not executing step().
         os::MutexLock lock(msg_lock);
+        mwaiters.inc();
         while (!pred()) { // the mutex guards that processMessages can not run between !pred and the wait().
             msg_cond.wait(msg_lock); // now processMessages may run.
         }
+        mwaiters.dec();
     }
 
 
@@ -351,7 +417,12 @@ namespace RTT
                 // We must lock because the cond variable will unlock msg_lock.
                 os::MutexLock lock(msg_lock);
                 if (!pred()) {
-                    msg_cond.wait(msg_lock); // now processMessages may run.
+                    mwaiters.inc();
+                    oro_smp_mb();
+                    // messages which arrived after processMessages() do not wait for a broadcast.
+                    if ( mqueue->isEmpty() )
+                        msg_cond.wait(msg_lock); // now processMessages may run.
+                    mwaiters.dec();
                 } else {
                     return; // do not process messages when pred() == true;
                 }
@@ -359,6 +430,79 @@ namespace RTT
         }
     }
 
+    bool ExecutionEngine::setQueueCapacity(QueueType queue, unsigned int capacity) {
+        switch(queue) {
+        case MessageQueue:
+            mqueue->setCapacity(capacity);
+            return true;
+        case PortQueue:
+            port_queue->setCapacity(capacity);
+            return true;
+        case FunctionQueue:
+            f_queue->setCapacity(capacity);
+            return true;
+        }
+        return false;
+    }
+
+    unsigned int ExecutionEngine::getQueueCapacity(QueueType queue) const {
+        return getQueueStatistics(queue).capacity;
+    }
+
+    QueueStatistics ExecutionEngine::getQueueStatistics(QueueType queue) const {
+        switch(queue) {
+        case MessageQueue:
+            return mqueue->getStatistics();
+        case PortQueue:
+            return port_queue->getStatistics();
+        case FunctionQueue:
+            return f_queue->getStatistics();
+        }
+        return QueueStatistics();
+    }
+
+    void ExecutionEngine::resetQueueStatistics() {
+        mqueue->resetStatistics();
+        port_queue->resetStatistics();
+        f_queue->resetStatistics();
+    }
+
+    bool ExecutionEngine::setQueueNumaNode(int node) {
+        bool result = mqueue->setNumaNode(node);
+        result = port_queue->setNumaNode(node) && result;
+        result = f_queue->setNumaNode(node) && result;
+        return result;
+    }
+
+    void ExecutionEngine::setMinTriggerInterval(Seconds interval) {
+        if ( interval > 0 && !mupdate_timer ) {
+            // the timer wakes up our thread, so it runs at the same priority.
+            os::ThreadInterface* thread = this->getThread();
+            if (thread)
+                mupdate_timer = new UpdateTimer(this, thread->getScheduler(), thread->getPriority());
+            else
+                mupdate_timer = new UpdateTimer(this, ORO_SCHED_OTHER, os::LowestPriority);
+        }
+        mmin_trigger_interval = interval > 0 ? Seconds_to_nsecs(interval) : 0;
+    }
+
+    Seconds ExecutionEngine::getMinTriggerInterval() const {
+        return nsecs_to_Seconds(mmin_trigger_interval);
+    }
+
+    bool ExecutionEngine::deferUpdate() {
+        if ( mmin_trigger_interval == 0 || !mupdate_timer || !this->getActivity() || this->getActivity()->isPeriodic() )
+            return false;
+        os::TimeService::nsecs now = os::TimeService::Instance()->getNSecs();
+        os::TimeService::nsecs next_update = mlast_update + mmin_trigger_interval;
+        if ( now >= next_update )
+            return false;
+        // triggers which arrive in the meantime are served by the deferred update.
+        if ( !mupdate_timer->isArmed(0) )
+            mupdate_timer->arm(0, nsecs_to_Seconds(next_update - now));
+        return true;
+    }
+
     void ExecutionEngine::step() {
         // we use work() now
     }
@@ -389,6 +533,8 @@ namespace RTT
             /* Update step */
             processMessages();
             processPortCallbacks();
+            if (reason == RunnableInterface::TimeOut && deferUpdate())
+                return;
             processFunctions();
             processHooks();
         }
@@ -398,6 +544,8 @@ namespace RTT
         if ( taskc ) {
             // A trigger() in startHook() will be ignored, we trigger in TaskCore after startHook finishes.
             if ( taskc->mTaskState == TaskCore::Running && taskc->mTargetState == TaskCore::Running ) {
+                if ( mmin_trigger_interval != 0 )
+                    mlast_update = os::TimeService::Instance()->getNSecs();
                 TRY (
                     { tracepoint_context(orocos_rtt, TaskContext_updateHook, taskc->mName.c_str());
                         taskc->updateHook(); }
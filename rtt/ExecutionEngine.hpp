@@ -42,11 +42,13 @@
 #include "os/Mutex.hpp"
 #include "os/MutexLock.hpp"
 #include "os/Condition.hpp"
+#include "os/Atomic.hpp"
 #include "base/RunnableInterface.hpp"
 #include "base/ActivityInterface.hpp"
 #include "base/DisposableInterface.hpp"
 #include "base/ExecutableInterface.hpp"
 #include "internal/List.hpp"
+#include "internal/SegmentedMWSRQueue.hpp"
 #include <vector>
 #include <boost/function.hpp>
 
@@ -70,6 +72,21 @@ namespace RTT
         : public base::RunnableInterface
     {
     public:
+        /**
+         * The queues through which other threads hand over work
+         * to this execution engine.
+         */
+        enum QueueType {
+            MessageQueue,  //!< The messages passed to process(base::DisposableInterface*)
+            PortQueue,     //!< The port callbacks passed to process(base::PortInterface*)
+            FunctionQueue  //!< The functions passed to runFunction()
+        };
+
+        /**
+         * The capacity of each queue of a new execution engine.
+         */
+        static const unsigned int DefaultQueueCapacity = 100;
+
         /**
          * Create an execution engine with a internal::CommandProcessor, scripting::ProgramProcessor
          * and StateMachineProcessor.
@@ -197,6 +214,68 @@ namespace RTT
          */
         bool isSelf() const;
 
+        /**
+         * Changes the number of items a queue of this engine can hold.
+         * This may be done at any time, but raising the capacity allocates memory.
+         * @param queue The queue to resize.
+         * @param capacity The new capacity. If 0, the queue becomes unbounded.
+         * When it is full, it takes over a preallocated spare segment of items.
+         * Neither senders nor this engine's thread allocate, so senders fail
+         * once the spare segments are used up. Calling this function with 0
+         * again replaces the spare segments which were taken over.
+         * @return false if \a queue is not a valid QueueType.
+         */
+        bool setQueueCapacity(QueueType queue, unsigned int capacity);
+
+        /**
+         * Returns the capacity of a queue of this engine, or 0 if it is unbounded.
+         */
+        unsigned int getQueueCapacity(QueueType queue) const;
+
+        /**
+         * Returns the fill level, the highest fill level, the number of rejected
+         * items and the time items spent in a queue of this engine.
+         */
+        internal::QueueStatistics getQueueStatistics(QueueType queue) const;
+
+        /**
+         * Resets the statistics of all queues of this engine.
+         * @note The queued times are updated by the thread of this engine,
+         * so this function should be called from that thread, for example
+         * in a message.
+         */
+        void resetQueueStatistics();
+
+        /**
+         * Places the message, port and function queues of this engine in
+         * the memory of NUMA node \a node, which should be the node on which
+         * the thread of this engine runs.
+         * @param node The NUMA node, or -1 to stop placing new queue segments.
+         * @return false if the queues could not be placed, for example
+         * because the OS does not support NUMA.
+         * @see TaskCore::setNumaNode()
+         */
+        bool setQueueNumaNode(int node);
+
+        /**
+         * Sets the minimum time between two updateHook() executions of a
+         * non-periodic component that are caused by triggers, for example by
+         * data arriving on event ports. All triggers that arrive within this
+         * interval are served by a single updateHook(). The thread does not
+         * wait for the interval to pass: the update step is deferred to a
+         * timer, and messages and port callbacks are processed in the meantime.
+         * The first call with a non-zero interval creates the timer's thread,
+         * and is not real-time.
+         * @param interval The minimum interval in seconds, or 0 to execute
+         * updateHook() as soon as possible after every trigger (the default).
+         */
+        void setMinTriggerInterval(Seconds interval);
+
+        /**
+         * Returns the minimum time between two triggered updateHook() executions.
+         */
+        Seconds getMinTriggerInterval() const;
+
     protected:
         /**
          * Call this if you wish to block on a message arriving in the Execution Engine.
@@ -235,27 +314,61 @@ namespace RTT
         /**
          * Our Message queue
          */
-        internal::MWSRQueue<base::DisposableInterface*>* mqueue;
+        internal::SegmentedMWSRQueue<base::DisposableInterface*>* mqueue;
 
         /**
          * The port callback queue
          */
-        internal::MWSRQueue<base::PortInterface*>* port_queue;
+        internal::SegmentedMWSRQueue<base::PortInterface*>* port_queue;
 
         /**
          * Stores all functions we're executing.
          */
-        internal::MWSRQueue<base::ExecutableInterface*>* f_queue;
+        internal::SegmentedMWSRQueue<base::ExecutableInterface*>* f_queue;
 
         os::Mutex msg_lock;
         os::Condition msg_cond;
 
+        /**
+         * The number of threads which are waiting on msg_cond. Only
+         * modified while holding msg_lock, such that notifyWaiters()
+         * can skip the broadcast when nobody is waiting.
+         */
+        os::AtomicInt mwaiters;
+
+        /**
+         * Wakes up the threads waiting on msg_cond, if any.
+         */
+        void notifyWaiters();
+
         /**
          * A master ExecutionEngine which should process our messages.
          * This is used for ExecutionEngines running in a SlaveActivity which forward incoming messages to their master engine.
          */
         ExecutionEngine *mmaster;
 
+        /**
+         * The minimum interval between two triggered updateHook()s and
+         * the time the last one started, in nanoseconds.
+         */
+        os::TimeService::nsecs mmin_trigger_interval;
+        os::TimeService::nsecs mlast_update;
+
+        /**
+         * Times out our activity when a deferred update step is due.
+         * Only created once a minimum trigger interval is set.
+         */
+        class UpdateTimer;
+        UpdateTimer* mupdate_timer;
+
+        /**
+         * Checks if less than mmin_trigger_interval has passed since mlast_update.
+         * In that case, the update step is skipped and mupdate_timer is armed
+         * to run it when the interval has passed.
+         * @return true if the update step must be skipped.
+         */
+        bool deferUpdate();
+
         void processMessages();
         void processPortCallbacks();
         void processFunctions();
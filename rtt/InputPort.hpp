@@ -57,15 +57,27 @@ namespace RTT
      * Ideally, your algorithm should not assume a certain connection policy
      * being used from output to input. So it should work on data connections
      * and buffer connections.
+     *
+     * Samples published with OutputPort::publish() on connections with the
+     * ConnPolicy::zero_copy flag set can be read without copying them with take().
      * @ingroup Ports
      */
     template<typename T>
     class InputPort : public base::InputPortInterface
     {
+    public:
+        /**
+         * A read-only, reference counted sample returned by take().
+         */
+        typedef typename internal::SharedSample<T>::const_ptr SampleView;
+
     private:
         friend class internal::ConnOutputEndpoint<T>;
         typename internal::ConnOutputEndpoint<T>::shared_ptr endpoint;
 
+        /// Samples that take() copies into for connections without zero-copy support.
+        typename internal::SharedSamplePool<T>::shared_ptr take_pool;
+
         virtual bool connectionAdded( base::ChannelElementBase::shared_ptr channel_input, ConnPolicy const& policy ) { return true; }
 
         /**
@@ -149,6 +161,37 @@ namespace RTT
             return getEndpoint()->getReadEndpoint()->read(sample, copy_old_data);
         }
 
+        /** Reads a sample from the connection without copying it, if the
+         * connection has the ConnPolicy::zero_copy flag set. Other connections
+         * copy the sample into a sample owned by this port. \a sample is updated
+         * in the same cases as with read().
+         *
+         * The first call allocates a small pool of samples for the latter case,
+         * which is not real-time safe. The samples in that pool keep their memory,
+         * so dynamically sized samples only allocate during the first few calls.
+         */
+        FlowStatus take(SampleView& sample, bool copy_old_data = true)
+        {
+            if (!take_pool)
+                take_pool = new internal::SharedSamplePool<T>(4);
+
+            typename base::ChannelElement<T>::sample_ptr result = take_pool->allocate();
+            FlowStatus status = getEndpoint()->getReadEndpoint()->readShared(result, copy_old_data);
+            if (result && ((status == NewData) || (status == OldData && copy_old_data)))
+                sample = result;
+            return status;
+        }
+
+        /** \overload
+         * @return The new or old sample, or a null sample if there is no data.
+         */
+        SampleView take()
+        {
+            SampleView sample;
+            take(sample);
+            return sample;
+        }
+
         /** Read all new samples that are available on this port, and returns
          * the last one.
          *
@@ -43,7 +43,12 @@
 #include "os/TimeService.hpp"
 
 #include "Logger.hpp"
+#include "BinaryLog.hpp"
+#include "os/Atomic.hpp"
+#include "os/Thread.hpp"
+#include "rt_string.hpp"
 #include <iomanip>
+#include <vector>
 
 #ifdef OROSEM_PRINTF_LOGGING
 #  include <stdio.h>
@@ -122,6 +127,144 @@ namespace RTT
         return Instance()->operator<<( ll );
     }
 
+#if defined(__GNUC__)
+#  define ORO_LOGGER_TLS __thread
+#  if !defined(_WIN32)
+#    define ORO_LOGGER_THREAD_EXIT
+#    include <pthread.h>
+#  endif
+#elif defined(_MSC_VER)
+#  define ORO_LOGGER_TLS __declspec(thread)
+#endif
+
+    namespace {
+        /**
+         * A stream buffer which appends to an rt_string, such that
+         * a message is formatted directly in a ring slot.
+         */
+        class RtStringBuf : public std::streambuf
+        {
+            rt_string* mtarget;
+        public:
+            RtStringBuf() : mtarget(0) {}
+
+            void setTarget(rt_string* target) { mtarget = target; }
+        protected:
+            virtual int_type overflow(int_type c) {
+                if ( c != traits_type::eof() )
+                    mtarget->push_back( traits_type::to_char_type(c) );
+                return traits_type::not_eof(c);
+            }
+
+            virtual std::streamsize xsputn(const char* s, std::streamsize n) {
+                mtarget->append(s, n);
+                return n;
+            }
+        };
+
+        /**
+         * The messages of one thread in asynchronous mode. The thread
+         * formats each message in the slot after head and publishes it
+         * by incrementing head. The flusher reads the slots from tail
+         * to head. Only the thread writes head and only the flusher
+         * writes tail. When the thread exits, the flusher recycles the
+         * ring for the next thread that logs.
+         */
+        struct ThreadLog
+        {
+            struct Entry {
+                TimeService::ticks stamp;
+                Logger::LogLevel level;
+                bool tostd, tofile;
+                rt_string module;
+                rt_string text;
+            };
+
+            /**
+             * The number of slots, a power of two, and the initial
+             * capacity of the strings in a slot.
+             */
+            enum { RingSize = 64, LineSize = 256 };
+
+            std::vector<Entry> ring;
+            os::AtomicInt head, tail;
+            os::AtomicInt dropped;
+            os::AtomicInt exited;
+            int reported;
+            Logger::LogLevel inloglevel;
+            std::string module;
+            rt_string overflow;
+            rt_string* current;
+            RtStringBuf buf;
+            std::ostream stream;
+
+            ThreadLog()
+                : ring(RingSize), head(0), tail(0), dropped(0), exited(0), reported(0),
+                  inloglevel(Logger::Info), module("Logger"), current(0), stream(&buf)
+            {
+                for (unsigned int i = 0; i != ring.size(); ++i) {
+                    ring[i].module.reserve(32);
+                    ring[i].text.reserve(LineSize);
+                }
+                overflow.reserve(LineSize);
+                begin();
+            }
+
+            /**
+             * Selects the slot of the next message, or the overflow
+             * string if the ring is full.
+             */
+            void begin() {
+                unsigned int h = head.read();
+                if ( h - (unsigned int)tail.read() < RingSize )
+                    current = &ring[h % RingSize].text;
+                else
+                    current = &overflow;
+                current->clear();
+                buf.setTarget(current);
+            }
+
+            /**
+             * Hands the current message to the flusher.
+             */
+            void publish(bool tostd, bool tofile) {
+                if ( current == &overflow ) {
+                    dropped.inc();
+                } else if ( tostd || tofile ) {
+                    Entry& e = ring[(unsigned int)head.read() % RingSize];
+                    e.stamp = TimeService::Instance()->getTicks();
+                    e.level = inloglevel;
+                    e.tostd = tostd;
+                    e.tofile = tofile;
+                    e.module.assign( module.c_str() );
+                    head.inc();
+                }
+                begin();
+            }
+        };
+
+#ifdef ORO_LOGGER_TLS
+        /**
+         * The ring of the calling thread, valid if thread_log_generation
+         * equals the generation of the current Logger.
+         */
+        ORO_LOGGER_TLS ThreadLog* thread_log = 0;
+        ORO_LOGGER_TLS unsigned int thread_log_generation = 0;
+#endif
+        unsigned int logger_generation = 0;
+
+#ifdef ORO_LOGGER_THREAD_EXIT
+        /**
+         * Called when a thread that logged exits. The atomic increment
+         * orders it after the last message of the thread.
+         */
+        void threadLogExited(void* tl)
+        {
+            static_cast<ThreadLog*>(tl)->exited.inc();
+        }
+#endif
+    }
+
     /**
      * This hidden struct stores all data structures required for logging.
      */
@@ -147,10 +290,14 @@ namespace RTT
               timestamp(0),
               started(false), showtime(true), allowRT(false),
               mlogStdOut(true), mlogFile(true),
-              moduleptr("Logger")
+              moduleptr("Logger"),
+              async(false), flusher(0), retired_dropped(0), generation(++logger_generation)
         {
 #if defined(OROSEM_FILE_LOGGING) && !defined(OROSEM_LOG4CPP_LOGGING) && defined(OROSEM_PRINTF_LOGGING)
             logfile = fopen(logfile_name ? logfile_name : "orocos.log","w");
+#endif
+#ifdef ORO_LOGGER_THREAD_EXIT
+            pthread_key_create( &exit_key, &threadLogExited );
 #endif
         }
 
@@ -160,14 +307,36 @@ namespace RTT
             return true;
         }
 
+        ~D() {
+            if ( flusher ) {
+                flusher->stop();
+                delete flusher;
+            }
+#ifdef ORO_LOGGER_THREAD_EXIT
+            pthread_key_delete( exit_key );
+#endif
+            for (std::vector<ThreadLog*>::iterator it = threads.begin(); it != threads.end(); ++it)
+                delete *it;
+            for (std::vector<ThreadLog*>::iterator it = spares.begin(); it != spares.end(); ++it)
+                delete *it;
+        }
+
         bool maylogStdOut() const {
-            if ( inloglevel <= outloglevel && outloglevel != Never && inloglevel != Never && mlogStdOut)
+            return maylogStdOut( inloglevel );
+        }
+
+        bool maylogStdOut(LogLevel ll) const {
+            if ( ll <= outloglevel && outloglevel != Never && ll != Never && mlogStdOut)
                 return true;
             return false;
         }
 
         bool maylogFile() const {
-            if ( (inloglevel <= Info || inloglevel <= outloglevel)  && mlogFile)
+            return maylogFile( inloglevel );
+        }
+
+        bool maylogFile(LogLevel ll) const {
+            if ( (ll <= Info || ll <= outloglevel)  && mlogFile)
                 return true;
             return false;
         }
@@ -185,33 +354,171 @@ namespace RTT
 
             // do not log if not wanted.
             if ( maylogStdOut() ) {
-#ifndef OROSEM_PRINTF_LOGGING
-                *stdoutput << res << logline.str() << pf;
-#else
-                printf("%s%s\n", res.c_str(), logline.str().c_str() );
-#endif
+                writeStd( res, logline.str(), pf );
                 logline.str("");   // clear stringstream.
             }
 
             if ( maylogFile() ) {
+#if defined(OROSEM_FILE_LOGGING) || defined(OROSEM_REMOTE_LOGGING)
+                writeFile( res, fileline.str(), inloglevel, pf );
+                fileline.str("");
+#endif
+            }
+        }
+
+        /**
+         * Writes one line to the standard output. Must be called with inpguard locked.
+         */
+        void writeStd(std::string const& res, std::string const& line, std::ostream& (*pf)(std::ostream&))
+        {
+#ifndef OROSEM_PRINTF_LOGGING
+            *stdoutput << res << line << pf;
+#else
+            printf("%s%s\n", res.c_str(), line.c_str() );
+#endif
+        }
+
+        /**
+         * Writes one line to the log file. Must be called with inpguard locked.
+         */
+        void writeFile(std::string const& res, std::string const& line, LogLevel ll, std::ostream& (*pf)(std::ostream&))
+        {
 #ifdef OROSEM_FILE_LOGGING
 #if     defined(OROSEM_LOG4CPP_LOGGING)
-                category.log(level2Priority(inloglevel), fileline.str());
+            category.log(level2Priority(ll), line);
 #elif   !defined(OROSEM_PRINTF_LOGGING)
-                logfile << res << fileline.str() << pf;
+            logfile << res << line << pf;
 #else
-                fprintf( logfile, "%s%s\n", res.c_str(), fileline.str().c_str() );
+            fprintf( logfile, "%s%s\n", res.c_str(), line.c_str() );
+#endif
 #endif
 #ifdef OROSEM_REMOTE_LOGGING
-                remotestring.Push(res+fileline.str());  // TODO, handle failure.
+            remotestring.Push(res+line);  // TODO, handle failure.
+#endif
+        }
+
+        /**
+         * Returns the ring of the calling thread, which is taken from
+         * the rings of exited threads or created on its first message.
+         */
+        ThreadLog* threadLog()
+        {
+#ifdef ORO_LOGGER_TLS
+            if ( thread_log_generation == generation )
+                return thread_log;
+            ThreadLog* tl = 0;
+            {
+                os::MutexLock lock( inpguard );
+                if ( !spares.empty() ) {
+                    tl = spares.back();
+                    spares.pop_back();
+                    tl->dropped.set(0);
+                    tl->reported = 0;
+                    tl->exited.set(0);
+                } else
+                    tl = new ThreadLog();
+                tl->inloglevel = inloglevel;
+                tl->module = moduleptr;
+                threads.push_back( tl );
+            }
+#ifdef ORO_LOGGER_THREAD_EXIT
+            pthread_setspecific( exit_key, tl );
 #endif
+            thread_log = tl;
+            thread_log_generation = generation;
+            return tl;
+#else
+            return 0;
+#endif
+        }
+
+        /**
+         * Writes all published messages of all threads in time order
+         * and reports the messages that were dropped since the last call.
+         */
+        void drain()
+        {
+            os::MutexLock lock( inpguard );
+            bool written = false;
+            for (;;) {
+                ThreadLog* next = 0;
+                ThreadLog::Entry* first = 0;
+                for (std::vector<ThreadLog*>::iterator it = threads.begin(); it != threads.end(); ++it) {
+                    unsigned int t = (*it)->tail.read();
+                    if ( t == (unsigned int)(*it)->head.read() )
+                        continue;
+                    ThreadLog::Entry& e = (*it)->ring[t % ThreadLog::RingSize];
+                    if ( first == 0 || e.stamp < first->stamp ) {
+                        next = *it;
+                        first = &e;
+                    }
+                }
+                if ( next == 0 )
+                    break;
+                std::string res = showTime(first->stamp) +" " + showLevel(first->level) + "[" + first->module.c_str() + "] ";
+                std::string line( first->text.c_str() );
+                if ( first->tostd )
+                    writeStd( res, line, Logger::nl );
 #if defined(OROSEM_FILE_LOGGING) || defined(OROSEM_REMOTE_LOGGING)
-                fileline.str("");
+                if ( first->tofile )
+                    writeFile( res, line, first->level, Logger::nl );
+#endif
+                next->tail.inc();
+                written = true;
+            }
+
+            for (std::vector<ThreadLog*>::iterator it = threads.begin(); it != threads.end(); ++it) {
+                int dropped = (*it)->dropped.read();
+                if ( dropped == (*it)->reported )
+                    continue;
+                std::stringstream msg;
+                msg << "Dropped " << dropped - (*it)->reported << " log messages of thread " << it - threads.begin()
+                    << " because its ring buffer was full ( " << dropped << " in total ).";
+                std::string res = showTime() +" " + showLevel(Warning) + "[Logger] ";
+                if ( maylogStdOut(Warning) )
+                    writeStd( res, msg.str(), Logger::nl );
+#if defined(OROSEM_FILE_LOGGING) || defined(OROSEM_REMOTE_LOGGING)
+                if ( maylogFile(Warning) )
+                    writeFile( res, msg.str(), Warning, Logger::nl );
 #endif
+                (*it)->reported = dropped;
+                written = true;
+            }
+
+            // recycle the rings of exited threads once they are written.
+            for (std::vector<ThreadLog*>::iterator it = threads.begin(); it != threads.end(); ) {
+                if ( (*it)->exited.read() && (*it)->tail.read() == (*it)->head.read()
+                     && (*it)->dropped.read() == (*it)->reported ) {
+                    retired_dropped += (*it)->reported;
+                    spares.push_back( *it );
+                    it = threads.erase( it );
+                } else
+                    ++it;
+            }
+
+            if ( written ) {
+#ifndef OROSEM_PRINTF_LOGGING
+                stdoutput->flush();
+#endif
+#if defined(OROSEM_FILE_LOGGING) && !defined(OROSEM_PRINTF_LOGGING) && !defined(OROSEM_LOG4CPP_LOGGING)
+                logfile.flush();
 #endif
             }
         }
 
+        /**
+         * The low priority thread which drains the rings periodically.
+         */
+        struct Flusher : public os::Thread
+        {
+            D* md;
+            Flusher(D* d)
+                : os::Thread(ORO_SCHED_OTHER, os::LowestPriority, 0.01, 0, "LoggerFlusher"), md(d)
+            {}
+            void step() { md->drain(); }
+            void finalize() { md->drain(); }
+        };
+
 #ifndef OROSEM_PRINTF_LOGGING
         std::ostream* stdoutput;
 #endif
@@ -267,6 +574,14 @@ namespace RTT
             return time.str();
         }
 
+        std::string showTime(TimeService::ticks stamp) const
+        {
+            std::stringstream time;
+            if ( showtime )
+                time <<fixed<< showpoint << setprecision(3) << Seconds(TimeService::ticks2nsecs(stamp - timestamp))/NSECS_IN_SECS;
+            return time.str();
+        }
+
         /**
          * Convert a loglevel to a string representation.
          */
@@ -319,6 +634,42 @@ namespace RTT
 
         std::string moduleptr;
 
+        /**
+         * True in asynchronous mode.
+         */
+        bool async;
+
+        /**
+         * The rings of all threads that logged in asynchronous mode,
+         * protected by inpguard.
+         */
+        std::vector<ThreadLog*> threads;
+
+        /**
+         * The drained rings of exited threads, protected by inpguard.
+         */
+        std::vector<ThreadLog*> spares;
+
+        Flusher* flusher;
+
+        /**
+         * The messages dropped by the threads of the spare rings,
+         * protected by inpguard.
+         */
+        unsigned int retired_dropped;
+
+#ifdef ORO_LOGGER_THREAD_EXIT
+        /**
+         * Marks the ring of a thread as exited when the thread exits.
+         */
+        pthread_key_t exit_key;
+#endif
+
+        /**
+         * Identifies this object in thread_log_generation.
+         */
+        unsigned int generation;
+
         os::Mutex inpguard;
     };
 
@@ -413,8 +764,17 @@ namespace RTT
 
     Logger& Logger::in(const std::string& modname)
     {
+        if ( BinaryLog::isOpen() )
+            BinaryLog::setModule( modname );
         if ( !d->maylog() )
             return *this;
+        if ( d->async ) {
+            ThreadLog* tl = d->threadLog();
+            if ( tl ) {
+                tl->module = modname;
+                return *this;
+            }
+        }
         os::MutexLock lock( d->inpguard );
         d->moduleptr = modname.c_str();
         return *this;
@@ -422,8 +782,17 @@ namespace RTT
 
     Logger& Logger::out(const std::string& oldmod)
     {
+        if ( BinaryLog::isOpen() )
+            BinaryLog::setModule( oldmod );
         if ( !d->maylog() )
             return *this;
+        if ( d->async ) {
+            ThreadLog* tl = d->threadLog();
+            if ( tl ) {
+                tl->module = oldmod;
+                return *this;
+            }
+        }
         os::MutexLock lock( d->inpguard );
         d->moduleptr = oldmod.c_str();
         return *this;
@@ -432,6 +801,11 @@ namespace RTT
     std::string Logger::getLogModule() const {
         if ( !d->maylog() )
             return "";
+        if ( d->async ) {
+            ThreadLog* tl = d->threadLog();
+            if ( tl )
+                return tl->module;
+        }
         os::MutexLock lock( d->inpguard );
         std::string ret = d->moduleptr.c_str();
         return ret;
@@ -494,6 +868,7 @@ namespace RTT
     void Logger::shutdown() {
         if (!d->started)
             return;
+        this->setAsynchronous(false);
         *this<<Logger::Info<<"Orocos Logging Deactivated." << Logger::endl;
         this->logflush();
         d->started = false;
@@ -521,10 +896,58 @@ namespace RTT
 #endif
     }
 
+    bool Logger::setAsynchronous(bool async) {
+#ifdef ORO_LOGGER_TLS
+        if ( async == d->async )
+            return true;
+        if ( async ) {
+            // creating a thread logs, so the flusher is created before switching.
+            d->flusher = new D::Flusher( d );
+            d->flusher->start();
+            d->async = true;
+        } else {
+            d->async = false;
+            d->flusher->stop();
+            delete d->flusher;
+            d->flusher = 0;
+            d->drain();
+        }
+        return true;
+#else
+        return !async;
+#endif
+    }
+
+    bool Logger::isAsynchronous() const {
+        return d->async;
+    }
+
+    unsigned int Logger::getDroppedMessages() const {
+        os::MutexLock lock( d->inpguard );
+        unsigned int dropped = d->retired_dropped;
+        for (std::vector<ThreadLog*>::const_iterator it = d->threads.begin(); it != d->threads.end(); ++it)
+            dropped += (*it)->dropped.read();
+        return dropped;
+    }
+
+    std::ostream* Logger::threadStream() {
+        ThreadLog* tl = d->threadLog();
+        if ( tl && ( d->maylogStdOut(tl->inloglevel) || d->maylogFile(tl->inloglevel) ) )
+            return &tl->stream;
+        return 0;
+    }
+
     Logger& Logger::operator<<( const char* t ) {
         if ( !d->maylog() )
             return *this;
 
+        if ( d->async ) {
+            std::ostream* ts = threadStream();
+            if ( ts )
+                *ts << t;
+            return *this;
+        }
+
         os::MutexLock lock( d->inpguard );
         if ( d->maylogStdOut() )
             d->logline << t;
@@ -544,6 +967,13 @@ namespace RTT
     Logger& Logger::operator<<(LogLevel ll) {
         if ( !d->maylog() )
             return *this;
+        if ( d->async ) {
+            ThreadLog* tl = d->threadLog();
+            if ( tl ) {
+                tl->inloglevel = ll;
+                return *this;
+            }
+        }
         d->inloglevel = ll;
         return *this;
     }
@@ -552,6 +982,17 @@ namespace RTT
     {
         if ( !d->maylog() )
             return *this;
+        if ( d->async ) {
+            ThreadLog* tl = d->threadLog();
+            if ( tl ) {
+                // the flusher writes and flushes the published lines.
+                if ( pf == Logger::endl || pf == Logger::nl )
+                    tl->publish( d->maylogStdOut(tl->inloglevel), d->maylogFile(tl->inloglevel) );
+                else if ( pf != Logger::flush )
+                    tl->stream << pf;
+                return *this;
+            }
+        }
         if ( pf == Logger::endl )
             this->logendl();
         else if ( pf == Logger::nl )
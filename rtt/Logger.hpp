@@ -90,6 +90,11 @@ namespace RTT
      * is 6 or lower, these messages will not appear and do no harm to real-time performance.
      * You need to call @verbatim Logger::log().allowRealTime(); @endverbatim once in your program
      * to confirm this choice. AGAIN: THIS WILL BREAK REAL-TIME PERFORMANCE.
+     *
+     * By default, each message is formatted and written on the thread that
+     * logs it, under a global lock. With setAsynchronous(), each thread
+     * formats its messages in its own ring of pre-allocated strings
+     * instead, and a low priority thread writes them out in time order.
      * @ingroup CoreLib
      */
     class RTT_API Logger
@@ -246,6 +251,31 @@ namespace RTT
          */
         void setStdStream( std::ostream& stdos  );
 
+        /**
+         * Switch between writing each message on the thread that logs it
+         * (the default) and asynchronous logging. In asynchronous mode,
+         * each thread formats its messages in its own ring buffer without
+         * taking a lock, and a low priority flusher thread writes the rings
+         * to the console and the log file in time order. When a ring is
+         * full, new messages of that thread are dropped and counted.
+         * Switching back drains all rings. Switch before starting the
+         * threads that log, since a message that is being formatted while
+         * switching may be split.
+         * @return false if asynchronous logging is not supported on this platform.
+         */
+        bool setAsynchronous(bool async);
+
+        /**
+         * Returns true if messages are written by the flusher thread.
+         */
+        bool isAsynchronous() const;
+
+        /**
+         * Returns the number of messages which were dropped because
+         * the ring buffer of their thread was full.
+         */
+        unsigned int getDroppedMessages() const;
+
         /**
          * Send (user defined) data into this logger. All data with lower priority than
          * the current loglevel will be discarded. If any loglevel (thus in or out)
@@ -329,6 +359,13 @@ namespace RTT
         bool mayLogStdOut() const;
         bool mayLogFile() const;
 
+        /**
+         * Returns the stream which formats the current message of
+         * the calling thread in asynchronous mode, or null if that message
+         * is not logged.
+         */
+        std::ostream* threadStream();
+
         Logger(std::ostream& str=std::cerr);
         ~Logger();
 
@@ -55,6 +55,13 @@ namespace RTT
         if ( !mayLog() )
             return *this;
 
+        if ( isAsynchronous() ) {
+            std::ostream* ts = threadStream();
+            if ( ts )
+                *ts << t;
+            return *this;
+        }
+
         os::MutexLock lock( inpguard );
         if ( this->mayLogStdOut() )
             logline << t;
@@ -149,6 +156,18 @@ namespace RTT
     inline void Logger::setStdStream( std::ostream& ) {
     }
 
+    inline bool Logger::setAsynchronous(bool) {
+        return false;
+    }
+
+    inline bool Logger::isAsynchronous() const {
+        return false;
+    }
+
+    inline unsigned int Logger::getDroppedMessages() const {
+        return 0;
+    }
+
     inline Logger& Logger::operator<<( const std::string& ) {
         return *this;
     }
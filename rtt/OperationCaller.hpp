@@ -374,6 +374,28 @@ namespace RTT
         {
             this->impl.reset();
         }
+
+        /**
+         * Preallocates \a size clones of the implementation which send()
+         * reuses once their SendHandle is released. Copies of this object
+         * do not share the pool.
+         * @return false if not ready or if the implementation does not
+         * support a pool, which is the case for remote operations.
+         * @nrt
+         */
+        bool setSendPoolSize(unsigned int size)
+        {
+            return this->impl && this->impl->setSendPoolSize(size);
+        }
+
+        /**
+         * Returns how many sends reused a clone of the pool and
+         * how many needed to allocate one.
+         */
+        base::SendPoolStatistics getSendPoolStatistics() const
+        {
+            return this->impl ? this->impl->getSendPoolStatistics() : base::SendPoolStatistics();
+        }
     protected:
         /**
          * If no local implementation of an operation could be found,
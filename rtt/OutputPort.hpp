@@ -46,6 +46,8 @@
 #include "internal/ConnFactory.hpp"
 #include "Service.hpp"
 #include "OperationCaller.hpp"
+#include "os/Mutex.hpp"
+#include "os/MutexLock.hpp"
 
 #include "InputPort.hpp"
 
@@ -63,17 +65,31 @@ namespace RTT
      * to transport your data over the network, or use it in scripting, you need
      * to register your data class with the RTT type system.
      *
+     * Large samples can be passed on without copying them by using loan()
+     * and publish() instead of write() on connections with the
+     * ConnPolicy::zero_copy flag set.
+     *
      * @see RTT::types::TemplateTypeInfo for adding custom data classes to the RTT.
      * @ingroup Ports
      */
     template<typename T>
     class OutputPort : public base::OutputPortInterface
     {
+    public:
+        /**
+         * A writable sample obtained from loan().
+         */
+        typedef typename internal::SharedSample<T>::shared_ptr LoanedSample;
+
     private:
         friend class internal::ConnInputEndpoint<T>;
         typename internal::ConnInputEndpoint<T>::shared_ptr endpoint;
 
         virtual bool connectionAdded( base::ChannelElementBase::shared_ptr channel_input, ConnPolicy const& policy ) {
+            // A zero-copy connection keeps references to loaned samples
+            if (policy.zero_copy)
+                reserveLoans( internal::ChannelZeroCopyElement<T>::getCapacity(policy) );
+
             // Initialize the new channel with last written data if requested
             // (and available)
 
@@ -112,6 +128,21 @@ namespace RTT
         bool keeps_last_written_value;
         typename base::DataObjectInterface<T>::shared_ptr sample;
 
+        /// The pool from which loan() allocates samples and its guard.
+        typename internal::SharedSamplePool<T>::shared_ptr loan_pool;
+        os::Mutex loan_pool_lock;
+
+        void updateLastWrittenValue(const T& sample)
+        {
+            if (keeps_last_written_value || keeps_next_written_value)
+            {
+                keeps_next_written_value = false;
+                has_initial_sample = true;
+                this->sample->Set(sample);
+            }
+            has_last_written_value = keeps_last_written_value;
+        }
+
         /**
          * You are not allowed to copy ports.
          * In case you want to create a container of ports,
@@ -242,13 +273,7 @@ namespace RTT
          */
         WriteStatus write(const T& sample)
         {
-            if (keeps_last_written_value || keeps_next_written_value)
-            {
-                keeps_next_written_value = false;
-                has_initial_sample = true;
-                this->sample->Set(sample);
-            }
-            has_last_written_value = keeps_last_written_value;
+            updateLastWrittenValue(sample);
 
             WriteStatus result = NotConnected;
             if (connected()) {
@@ -262,6 +287,70 @@ namespace RTT
             return result;
         }
 
+        /**
+         * Borrows a sample from this port, which can be filled in and passed
+         * on with publish(). The sample contains the value it had when it was
+         * last released, which for dynamically sized types means that its
+         * memory is already allocated.
+         *
+         * The pool of samples is grown for every zero-copy connection that is
+         * created. If no such connection exists yet, the first call to loan()
+         * allocates a small pool, which is not real-time safe.
+         *
+         * @return A null sample if all samples are in use, or if the pool
+         * is being resized concurrently. Use write() in that case.
+         */
+        LoanedSample loan()
+        {
+            os::MutexTryLock locker(loan_pool_lock);
+            if (!locker.isSuccessful())
+                return LoanedSample();
+            if (!loan_pool)
+                loan_pool = new internal::SharedSamplePool<T>(2, has_initial_sample ? sample->Get() : T());
+            return loan_pool->allocate();
+        }
+
+        /**
+         * Grows the pool from which loan() allocates samples by \a size samples.
+         * You only need to call this if you hold on to more than one loaned sample
+         * at a time. This allocates memory and is not real-time safe. Samples which
+         * are currently loaned or published remain valid.
+         */
+        void reserveLoans(unsigned int size)
+        {
+            os::MutexLock locker(loan_pool_lock);
+            unsigned int capacity = size + (loan_pool ? loan_pool->capacity() : 2);
+            loan_pool = new internal::SharedSamplePool<T>(capacity, has_initial_sample ? sample->Get() : T());
+        }
+
+        /**
+         * Passes on a sample obtained from loan() to all receivers (if any).
+         * Zero-copy connections receive a reference to the sample, other
+         * connections a copy. The port gives up its reference to the sample,
+         * so \a loaned is reset and may no longer be modified.
+         * @note If this port keeps its last written value (see keepLastWrittenValue()),
+         * the sample is copied into it. Disable that to avoid any copy.
+         */
+        WriteStatus publish(LoanedSample& loaned)
+        {
+            if (!loaned)
+                return WriteFailure;
+
+            updateLastWrittenValue(loaned->value());
+
+            WriteStatus result = NotConnected;
+            if (connected()) {
+                traceWrite();
+                result = getEndpoint()->getWriteEndpoint()->writeShared(loaned);
+                if (result == NotConnected) {
+                    log(Error) << "A channel of port " << getName() << " has been invalidated during publish(), it will be removed" << endlog();
+                }
+            }
+
+            loaned.reset();
+            return result;
+        }
+
         WriteStatus write(base::DataSourceBase::shared_ptr source)
         {
             typename internal::AssignableDataSource<T>::shared_ptr ds =
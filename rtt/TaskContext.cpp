@@ -42,6 +42,7 @@
 #include "plugin/PluginLoader.hpp"
 
 #include <string>
+#include <sstream>
 #include <algorithm>
 #include <functional>
 #include <boost/bind.hpp>
@@ -95,6 +96,8 @@ namespace RTT
         this->addOperation("setPeriod", &TaskContext::setPeriod, this, ClientThread).doc("Set the execution period in seconds.").arg("s", "Period in seconds.");
         this->addOperation("getCpuAffinity", &TaskContext::getCpuAffinity, this, ClientThread).doc("Get the configured cpu affinity.");
         this->addOperation("setCpuAffinity", &TaskContext::setCpuAffinity, this, ClientThread).doc("Set the cpu affinity.").arg("cpu", "Cpu mask.");
+        this->addOperation("getNumaNode", &TaskContext::getNumaNode, this, ClientThread).doc("Get the NUMA node this TaskContext was placed on, or -1.");
+        this->addOperation("setNumaNode", &TaskContext::setNumaNode, this, ClientThread).doc("Run on the cpus of a NUMA node and place the thread's stack and the queues on its memory.").arg("node", "NUMA node, or -1 to allow all cpus.");
         this->addOperation("isActive", &TaskContext::isActive, this, ClientThread).doc("Is the Execution Engine of this TaskContext active ?");
         this->addOperation("inFatalError", &TaskContext::inFatalError, this, ClientThread).doc("Check if this TaskContext is in the FatalError state.");
         this->addOperation("error", &TaskContext::error, this, ClientThread).doc("Enter the RunTimeError state (= errorHook() ).");
@@ -104,6 +107,10 @@ namespace RTT
         this->addOperation("update", &TaskContext::update, this, ClientThread).doc("Execute (call) the update method directly.\n Only succeeds if the task isRunning() and allowed by the Activity executing this task.");
 
         this->addOperation("trigger", &TaskContext::trigger, this, ClientThread).doc("Trigger the update method for execution in the thread of this task.\n Only succeeds if the task isRunning() and allowed by the Activity executing this task.");
+        this->addOperation("setQueueCapacity", &TaskContext::setQueueCapacity, this, ClientThread).doc("Set the capacity of a queue of the Execution Engine.").arg("queue", "One of 'messages', 'ports' or 'functions'.").arg("capacity", "The number of queued items, or 0 for an unbounded queue.");
+        this->addOperation("getQueueStatistics", &TaskContext::getQueueStatistics, this, ClientThread).doc("Get the fill levels, enqueue failures and queued times of the queues of the Execution Engine.");
+        this->addOperation("setMinTriggerInterval", &ExecutionEngine::setMinTriggerInterval, this->engine(), ClientThread).doc("Set the minimum time between two triggered updateHook()s. Triggers arriving within this interval are served by one updateHook().").arg("s", "Interval in seconds, 0 to disable.");
+        this->addOperation("getMinTriggerInterval", &ExecutionEngine::getMinTriggerInterval, this->engine(), ClientThread).doc("Get the minimum time between two triggered updateHook()s.");
         this->addOperation("loadService", &TaskContext::loadService, this, ClientThread).doc("Loads a service known to RTT into this component.").arg("service_name","The name with which the service is registered by in the PluginLoader.");
 
         this->addAttribute("TriggerOnStart",mTriggerOnStart);
@@ -225,6 +232,25 @@ namespace RTT
          return tcservice->hasService(name) || plugin::PluginLoader::Instance()->loadService(name, this);
     }
 
+    bool TaskContext::setQueueCapacity(const std::string& queue, unsigned int capacity) {
+        if ( queue == "messages" )
+            return engine()->setQueueCapacity(ExecutionEngine::MessageQueue, capacity);
+        if ( queue == "ports" )
+            return engine()->setQueueCapacity(ExecutionEngine::PortQueue, capacity);
+        if ( queue == "functions" )
+            return engine()->setQueueCapacity(ExecutionEngine::FunctionQueue, capacity);
+        log(Error) << "setQueueCapacity: unknown queue '" << queue << "', use 'messages', 'ports' or 'functions'." << endlog();
+        return false;
+    }
+
+    std::string TaskContext::getQueueStatistics() const {
+        std::ostringstream report;
+        report << "messages: " << engine()->getQueueStatistics(ExecutionEngine::MessageQueue) << std::endl;
+        report << "ports: " << engine()->getQueueStatistics(ExecutionEngine::PortQueue) << std::endl;
+        report << "functions: " << engine()->getQueueStatistics(ExecutionEngine::FunctionQueue) << std::endl;
+        return report.str();
+    }
+
     bool TaskContext::loadService(const std::string& service_name) {
         if ( provides()->hasService(service_name))
             return true;
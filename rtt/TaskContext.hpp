@@ -182,6 +182,23 @@ namespace RTT
         virtual bool start();
         virtual bool stop();
 
+        /**
+         * Changes the capacity of one of the queues of this component's
+         * ExecutionEngine.
+         * @param queue One of "messages", "ports" or "functions".
+         * @param capacity The new capacity, or 0 to make the queue unbounded.
+         * @return false if \a queue is not a known queue name.
+         * @see ExecutionEngine::setQueueCapacity()
+         */
+        bool setQueueCapacity(const std::string& queue, unsigned int capacity);
+
+        /**
+         * Returns a human readable report of the fill levels, enqueue failures
+         * and queued times of the queues of this component's ExecutionEngine.
+         * @see ExecutionEngine::getQueueStatistics()
+         */
+        std::string getQueueStatistics() const;
+
         /**
          * These functions are used to setup and manage peer-to-peer networks
          * of TaskContext objects.
@@ -71,3 +71,23 @@ RunnableInterface* ActivityInterface::getRunner() const
 {
     return runner;
 }
+
+os::CpuSet ActivityInterface::getCpuSet() const
+{
+    return os::CpuSet( this->getCpuAffinity() );
+}
+
+bool ActivityInterface::setCpuSet(const os::CpuSet& cpus)
+{
+    return cpus.fitsMask() && this->setCpuAffinity( cpus.toMask() );
+}
+
+int ActivityInterface::getNumaNode() const
+{
+    return -1;
+}
+
+bool ActivityInterface::setNumaNode(int node)
+{
+    return false;
+}
@@ -175,6 +175,33 @@ namespace RTT
          */
         virtual bool setCpuAffinity(unsigned cpu)  = 0;
 
+        /**
+         * Get the cpus this activity may run on. By default, these
+         * are the cpus of getCpuAffinity().
+         */
+        virtual os::CpuSet getCpuSet() const;
+
+        /**
+         * Set the cpus this activity may run on, which may include
+         * cpus above 31. By default, only sets which fit in a cpu
+         * affinity mask are accepted.
+         * @return true if it could be updated, false otherwise.
+         */
+        virtual bool setCpuSet(const os::CpuSet& cpus);
+
+        /**
+         * Get the NUMA node set with setNumaNode(), or -1 if none.
+         */
+        virtual int getNumaNode() const;
+
+        /**
+         * Run this activity on the cpus of NUMA node \a node and place
+         * its stack on that node. By default, this is not supported.
+         * @param node The NUMA node, or -1 to allow all cpus again.
+         * @return true if it could be updated, false otherwise.
+         */
+        virtual bool setNumaNode(int node);
+
         /**
          * Execute this activity such that it \a executes a step or loop of the RunnableInterface.
          * When you invoke execute() you intend to call the step() or loop() methods.
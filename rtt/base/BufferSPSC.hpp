@@ -0,0 +1,326 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef ORO_BUFFER_SPSC_HPP
+#define ORO_BUFFER_SPSC_HPP
+
+#include "../os/oro_arch.h"
+#include "../os/Atomic.hpp"
+#include "BufferInterface.hpp"
+#include <vector>
+#include <cassert>
+
+#ifdef ORO_PRAGMA_INTERFACE
+#pragma interface
+#endif
+
+namespace RTT
+{ namespace base {
+
+
+    /**
+     * A wait-free Single-Producer/Single-Consumer buffer implementation to
+     * read and write data of type \a T in a FIFO way.
+     *
+     * In contrast to BufferLockFree, the samples are stored in-place in a
+     * ring of preallocated slots, such that no pointer queue and no memory pool
+     * are involved. The write and read indices live on separate cache lines
+     * and each side keeps a private copy of the index of the other side, which
+     * is only refreshed if the buffer looks full (writer) or empty (reader).
+     * Neither Push() nor Pop() contains a retry loop.
+     *
+     * Exactly one thread may write and exactly one thread may read this buffer.
+     * clear() must be called by the reader. The reader may hold on to at most
+     * two samples obtained by PopWithoutRelease() at a time, which is what
+     * internal::ChannelBufferElement does.
+     *
+     * No memory allocation is done during read or write.
+     * @note Circular buffers are not supported, because the writer can not
+     * drop the oldest sample without synchronizing with the reader. The
+     * internal::ConnFactory falls back to BufferLockFree in that case.
+     * @param T The value type to be stored in the Buffer.
+     * @ingroup PortBuffers
+     */
+    template<class T>
+    class BufferSPSC
+        : public BufferInterface<T>
+    {
+    public:
+        typedef typename BufferBase::Options Options;
+        typedef typename BufferInterface<T>::reference_t reference_t;
+        typedef typename BufferInterface<T>::param_t param_t;
+        typedef typename BufferInterface<T>::size_type size_type;
+        typedef T value_t;
+
+    private:
+        /**
+         * The maximum number of elements that can be pushed
+         * before the reader pops them.
+         */
+        const size_type mcapacity;
+
+        /**
+         * The number of slots. Two more than mcapacity, such that the writer
+         * never overwrites the samples the reader got from PopWithoutRelease().
+         */
+        const size_type mslots;
+
+        value_t* const mbuf;
+        value_t mdata_sample;
+        bool initialized;
+
+        RTT::os::AtomicInt droppedSamples;
+
+        char pad0[ORO_CACHE_LINE_SIZE];
+
+        /**
+         * Index of the next slot to write to. Only modified by the writer.
+         */
+        volatile size_type mwrite;
+
+        /**
+         * The writer's copy of mread.
+         */
+        size_type mread_cached;
+
+        char pad1[ORO_CACHE_LINE_SIZE - 2 * sizeof(size_type)];
+
+        /**
+         * Index of the next slot to read from. Only modified by the reader.
+         */
+        volatile size_type mread;
+
+        /**
+         * The reader's copy of mwrite.
+         */
+        size_type mwrite_cached;
+
+        char pad2[ORO_CACHE_LINE_SIZE - 2 * sizeof(size_type)];
+
+        size_type next(size_type index) const
+        {
+            return (index + 1 == mslots) ? 0 : index + 1;
+        }
+
+        size_type distance(size_type from, size_type to) const
+        {
+            return (to >= from) ? to - from : to - from + mslots;
+        }
+
+        /**
+         * Moves an index forward that is owned by the calling thread.
+         * The write barrier makes sure that the other side sees the new index
+         * only after all reads and writes of the slots it covers are done.
+         * It is a full barrier on all architectures except x86, which does
+         * not reorder stores with earlier loads or stores.
+         */
+        static void publish(volatile size_type* index, size_type new_value)
+        {
+            oro_smp_wmb();
+            *index = new_value;
+        }
+
+        // non-copyable !
+        BufferSPSC(const BufferSPSC<T>&);
+
+    public:
+        /**
+         * Create an uninitialized single-producer/single-consumer buffer which can store \a bufsize elements.
+         * @param bufsize the capacity of the buffer.
+         */
+        BufferSPSC( unsigned int bufsize, const Options &options = Options() )
+            : mcapacity(bufsize), mslots(bufsize + 2), mbuf(new value_t[bufsize + 2])
+            , mdata_sample(), initialized(false), droppedSamples(0)
+            , mwrite(0), mread_cached(0), mread(0), mwrite_cached(0)
+        {
+            assert(!options.circular() && "BufferSPSC does not support circular buffers");
+        }
+
+        /**
+         * Create a single-producer/single-consumer buffer which can store \a bufsize elements.
+         * @param bufsize the capacity of the buffer.
+         * @param initial_value A data sample with which each preallocated data element is initialized.
+         */
+        BufferSPSC( unsigned int bufsize, param_t initial_value, const Options &options = Options() )
+            : mcapacity(bufsize), mslots(bufsize + 2), mbuf(new value_t[bufsize + 2])
+            , mdata_sample(), initialized(false), droppedSamples(0)
+            , mwrite(0), mread_cached(0), mread(0), mwrite_cached(0)
+        {
+            assert(!options.circular() && "BufferSPSC does not support circular buffers");
+            data_sample( initial_value );
+        }
+
+        ~BufferSPSC() {
+            delete[] mbuf;
+        }
+
+        virtual bool data_sample( param_t sample, bool reset = true )
+        {
+            if (!initialized || reset) {
+                for (size_type i = 0; i != mslots; ++i)
+                    mbuf[i] = sample;
+                mdata_sample = sample;
+                mwrite = mread_cached = 0;
+                mread = mwrite_cached = 0;
+                initialized = true;
+                return true;
+            } else {
+                return initialized;
+            }
+        }
+
+        virtual value_t data_sample() const
+        {
+            return mdata_sample;
+        }
+
+        size_type capacity() const
+        {
+            return mcapacity;
+        }
+
+        size_type size() const
+        {
+            return distance(mread, mwrite);
+        }
+
+        bool empty() const
+        {
+            return mread == mwrite;
+        }
+
+        bool full() const
+        {
+            return size() >= mcapacity;
+        }
+
+        void clear()
+        {
+            mwrite_cached = mwrite;
+            publish(&mread, mwrite_cached);
+        }
+
+        virtual size_type dropped() const
+        {
+            return droppedSamples.read();
+        }
+
+        bool Push( param_t item )
+        {
+            size_type w = mwrite;
+            if ( distance(mread_cached, w) >= mcapacity ) {
+                mread_cached = mread;
+                if ( distance(mread_cached, w) >= mcapacity ) {
+                    droppedSamples.inc();
+                    return false;
+                }
+            }
+            mbuf[w] = item;
+            publish(&mwrite, next(w));
+            return true;
+        }
+
+        size_type Push( const std::vector<value_t>& items )
+        {
+            size_type w = mwrite;
+            size_type towrite = items.size();
+            if ( mcapacity - distance(mread_cached, w) < towrite )
+                mread_cached = mread;
+            size_type free = mcapacity - distance(mread_cached, w);
+            size_type written = (towrite < free) ? towrite : free;
+
+            size_type i = w;
+            typename std::vector<value_t>::const_iterator it = items.begin();
+            for ( size_type n = 0; n != written; ++n, ++it ) {
+                mbuf[i] = *it;
+                i = next(i);
+            }
+            if (written != 0)
+                publish(&mwrite, i);
+            droppedSamples.add(towrite - written);
+            return written;
+        }
+
+        FlowStatus Pop( reference_t item )
+        {
+            size_type r = mread;
+            if ( r == mwrite_cached ) {
+                mwrite_cached = mwrite;
+                if ( r == mwrite_cached )
+                    return NoData;
+                // don't read the slot before the index that covers it
+                oro_smp_rmb();
+            }
+            item = mbuf[r];
+            publish(&mread, next(r));
+            return NewData;
+        }
+
+        size_type Pop( std::vector<value_t>& items )
+        {
+            items.clear();
+            size_type r = mread;
+            mwrite_cached = mwrite;
+            if ( r == mwrite_cached )
+                return 0;
+            oro_smp_rmb();
+            size_type i = r;
+            while ( i != mwrite_cached ) {
+                items.push_back( mbuf[i] );
+                i = next(i);
+            }
+            publish(&mread, i);
+            return items.size();
+        }
+
+        value_t* PopWithoutRelease()
+        {
+            size_type r = mread;
+            if ( r == mwrite_cached ) {
+                mwrite_cached = mwrite;
+                if ( r == mwrite_cached )
+                    return 0;
+                oro_smp_rmb();
+            }
+            value_t* ipop = &mbuf[r];
+            publish(&mread, next(r));
+            return ipop;
+        }
+
+        void Release(value_t *item)
+        {
+            // the slot is reclaimed as soon as the reader pops further,
+            // there is nothing to give back, but we can check if the other side messed up.
+            assert(item >= mbuf && item < mbuf + mslots && "Wrong pointer given back to buffer");
+            (void) item;
+        }
+    };
+}}
+
+#endif
@@ -45,6 +45,7 @@
 #include "../ConnPolicy.hpp"
 #include "../FlowStatus.hpp"
 #include "../os/MutexLock.hpp"
+#include "../internal/SharedSample.hpp"
 
 #include <boost/bind.hpp>
 
@@ -62,6 +63,7 @@ namespace RTT { namespace base {
         typedef T value_t;
         typedef typename boost::call_traits<T>::param_type param_t;
         typedef typename boost::call_traits<T>::reference reference_t;
+        typedef typename internal::SharedSample<T>::shared_ptr sample_ptr;
 
         shared_ptr getOutput()
         {
@@ -123,6 +125,28 @@ namespace RTT { namespace base {
             else
                 return NoData;
         }
+
+        /** Writes a shared sample on this connection. Elements that can store
+         * or forward shared samples pass on a reference to \a sample. The
+         * default implementation copies the sample by calling write().
+         */
+        virtual WriteStatus writeShared(sample_ptr const& sample)
+        {
+            return this->write(sample->value());
+        }
+
+        /** Reads a shared sample from the connection. Elements that store
+         * shared samples replace \a sample by a reference to the stored sample.
+         * The default implementation copies the data into \a sample by calling
+         * read(). In that case, \a sample must point to a writable sample that is
+         * exclusively owned by the caller and NoData is returned if it is null.
+         */
+        virtual FlowStatus readShared(sample_ptr& sample, bool copy_old_data = true)
+        {
+            if (!sample)
+                return NoData;
+            return this->read(sample->value(), copy_old_data);
+        }
     };
 
     /** A typed version of MultipleInputsChannelElementBase.
@@ -135,6 +159,7 @@ namespace RTT { namespace base {
         typedef typename ChannelElement<T>::value_t value_t;
         typedef typename ChannelElement<T>::param_t param_t;
         typedef typename ChannelElement<T>::reference_t reference_t;
+        typedef typename ChannelElement<T>::sample_ptr sample_ptr;
 
         MultipleInputsChannelElement()
             : last()
@@ -168,6 +193,21 @@ namespace RTT { namespace base {
             return result;
         }
 
+        /** Reads a shared sample from the currently selected input, or from the
+         * first other input that has new data.
+         * @see ChannelElement<T>::readShared()
+         */
+        virtual FlowStatus readShared(sample_ptr& sample, bool copy_old_data = true)
+        {
+            FlowStatus result = NoData;
+            const sample_ptr scratch = sample;
+            RTT::os::SharedMutexLock lock(inputs_lock);
+
+            // read and iterate if necessary.
+            select_reader_channel( boost::bind( &MultipleInputsChannelElement<T>::do_readShared, this, boost::cref(scratch), boost::ref(sample), boost::ref(result), _1, _2), copy_old_data );
+            return result;
+        }
+
     private:
         typename ChannelElement<T>::shared_ptr currentInput() {
             typename ChannelElement<T>::shared_ptr last = this->last;
@@ -192,6 +232,29 @@ namespace RTT { namespace base {
             return false;
         }
 
+        bool do_readShared(sample_ptr const& scratch, sample_ptr& sample, FlowStatus& result, bool copy_old_data, typename ChannelElement<T>::shared_ptr& input)
+        {
+            assert( result != NewData );
+            if ( input ) {
+                // every input gets the caller's scratch sample, as inputs that store
+                // shared samples may have replaced sample by a read-only one.
+                sample_ptr candidate = scratch;
+                FlowStatus tresult = input->readShared(candidate, copy_old_data);
+                if (tresult == NewData) {
+                    sample = candidate;
+                    result = tresult;
+                    return true;
+                }
+                // stores OldData result
+                if (tresult > result) {
+                    if (copy_old_data)
+                        sample = candidate;
+                    result = tresult;
+                }
+            }
+            return false;
+        }
+
         /**
          * Selects a connection as the current channel
          * if pred(connection) is true. It will first check
@@ -257,6 +320,7 @@ namespace RTT { namespace base {
         typedef typename ChannelElement<T>::value_t value_t;
         typedef typename ChannelElement<T>::param_t param_t;
         typedef typename ChannelElement<T>::reference_t reference_t;
+        typedef typename ChannelElement<T>::sample_ptr sample_ptr;
 
         virtual WriteStatus data_sample(param_t sample, bool reset = true)
         {
@@ -324,6 +388,41 @@ namespace RTT { namespace base {
 
             return result;
         }
+
+        /** Writes a shared sample to all connected channels. All channels
+         * which support shared samples receive a reference to the same sample.
+         * @see ChannelElement<T>::writeShared()
+         */
+        virtual WriteStatus writeShared(sample_ptr const& sample)
+        {
+            WriteStatus result = WriteSuccess;
+            bool at_least_one_output_is_disconnected = false;
+            bool at_least_one_output_is_connected = false;
+
+            {
+                RTT::os::SharedMutexLock lock(outputs_lock);
+                if (outputs.empty()) return NotConnected;
+                for(Outputs::iterator it = outputs.begin(); it != outputs.end(); ++it)
+                {
+                    typename ChannelElement<T>::shared_ptr output = it->channel->narrow<T>();
+                    WriteStatus fs = output->writeShared(sample);
+                    if (it->mandatory && (result < fs)) result = fs;
+                    if (fs == NotConnected) {
+                        it->disconnected = true;
+                        at_least_one_output_is_disconnected = true;
+                    } else {
+                        at_least_one_output_is_connected = true;
+                    }
+                }
+            }
+
+            if (at_least_one_output_is_disconnected) {
+                removeDisconnectedOutputs();
+                if (!at_least_one_output_is_connected) result = NotConnected;
+            }
+
+            return result;
+        }
     };
 
     /** A typed version of MultipleInputsMultipleOutputsChannelElementBase.
@@ -0,0 +1,283 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_DATAOBJECT_SEQLOCK_HPP
+#define ORO_DATAOBJECT_SEQLOCK_HPP
+
+#include "../os/oro_arch.h"
+#include "../os/CAS.hpp"
+#include "DataObjectInterface.hpp"
+#include "../Logger.hpp"
+#include "../internal/DataSourceTypeInfo.hpp"
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/has_trivial_copy.hpp>
+
+namespace RTT
+{ namespace base {
+
+    /**
+     * @brief A DataObject implementation based on a sequence lock, meant for
+     * large samples of a trivially copyable type \a T.
+     *
+     * The data is stored in two slots, each guarded by a sequence
+     * number which is odd while a writer is modifying the slot. A writer
+     * always fills the slot which is not currently published, so that
+     * readers which start during a write read the previous sample. Readers
+     * never modify shared state while copying, they only retry if the slot
+     * they were copying from was overwritten in the meantime, which requires
+     * two writes to happen during one read. Hence the cost of Get() does not
+     * depend on the number of readers, and only two copies of \a T are kept,
+     * independent of the number of threads.
+     *
+     * Concurrent writers are serialized by a try-lock: a Set() which finds
+     * another write in progress returns false and drops its sample, like
+     * DataObjectLockFree does.
+     *
+     * @note A reader may copy a slot while it is being overwritten, and only
+     * afterwards detect this and discard the copy. That is only safe for
+     * types which can be copied with memcpy, hence this data object refuses
+     * to compile for types that do not have a trivial copy constructor.
+     * internal::ConnFactory falls back to DataObjectLockFree for such types.
+     * @ingroup PortBuffers
+     */
+    template<class T>
+    class DataObjectSeqLock
+        : public DataObjectInterface<T>
+    {
+        BOOST_STATIC_ASSERT_MSG( boost::has_trivial_copy<T>::value,
+                                 "DataObjectSeqLock requires a trivially copyable data type" );
+    public:
+        typedef typename DataObjectInterface<T>::value_t value_t;
+        typedef typename DataObjectInterface<T>::reference_t reference_t;
+        typedef typename DataObjectInterface<T>::param_t param_t;
+
+        typedef typename DataObjectBase::Options Options;
+
+    private:
+        /**
+         * A slot holding one sample. \a seq is odd while a writer
+         * modifies \a data.
+         */
+        struct Slot {
+            Slot() : seq(0), data() {}
+            volatile unsigned int seq;
+            value_t data;
+            char pad[ORO_CACHE_LINE_SIZE];
+        };
+
+        Slot slots[2];
+
+        // Written by the writers: the number of completed writes.
+        // The latest sample is in slots[mwrite_count & 1].
+        volatile unsigned int mwrite_count;
+        oro_atomic_t write_lock;
+        char pad0[ORO_CACHE_LINE_SIZE];
+
+        // Written by the readers: the write count of the sample that was
+        // last returned as NewData and the write count at the last clear().
+        mutable volatile unsigned int mread_count;
+        volatile unsigned int mclear_count;
+        char pad1[ORO_CACHE_LINE_SIZE];
+
+        bool initialized;
+
+    public:
+        /**
+         * Construct an uninitialized DataObjectSeqLock.
+         * @param options Only present for compatibility with the other data
+         * objects, the number of threads does not influence the memory footprint.
+         */
+        DataObjectSeqLock( const Options &options = Options() )
+            : mwrite_count(0), mread_count(0), mclear_count(0), initialized(false)
+        {
+            oro_atomic_set(&write_lock, 0);
+        }
+
+        /**
+         * Construct a DataObjectSeqLock.
+         * @param initial_value The initial value of this DataObject.
+         * @param options Only present for compatibility with the other data
+         * objects, the number of threads does not influence the memory footprint.
+         */
+        DataObjectSeqLock( param_t initial_value, const Options &options = Options() )
+            : mwrite_count(0), mread_count(0), mclear_count(0), initialized(false)
+        {
+            oro_atomic_set(&write_lock, 0);
+            data_sample(initial_value);
+        }
+
+        /**
+         * Get a copy of the data.
+         * @return A copy of the data.
+         */
+        virtual value_t Get() const {
+            value_t cache = value_t();
+            Get(cache);
+            return cache;
+        }
+
+        /**
+         * Get a copy of the Data (non allocating).
+         *
+         * @param pull A copy of the data.
+         * @param copy_old_data If true, also copy the data if the data object
+         *                      has not been updated since the last call.
+         * @param copy_sample   If true, copy the data unconditionally.
+         */
+        virtual FlowStatus Get( reference_t pull, bool copy_old_data, bool copy_sample ) const
+        {
+            if (!initialized && !copy_sample) {
+                return NoData;
+            }
+
+            FlowStatus result;
+            unsigned int count, read_count;
+            while ( true ) {
+                count = mwrite_count;
+                oro_smp_mb();
+                const Slot& slot = slots[count & 1];
+                const unsigned int seq = slot.seq;
+                if (seq & 1) {
+                    // a writer overtook us twice and is modifying this slot,
+                    // mwrite_count will point to the other slot.
+                    continue;
+                }
+                oro_smp_mb();
+
+                read_count = mread_count;
+                if (count == mclear_count)
+                    result = NoData;
+                else if (count == read_count)
+                    result = OldData;
+                else
+                    result = NewData;
+
+                if ((result == NewData) ||
+                    ((result == OldData) && copy_old_data) || copy_sample) {
+                    pull = slot.data;               // takes some time
+                }
+
+                oro_smp_mb();
+                if (slot.seq == seq)
+                    break;
+                // the slot was overwritten while we were copying it, try again.
+            }
+
+            // make sure that only one reader returns NewData for a given sample,
+            // and that mread_count never goes backwards.
+            while ((result == NewData) && !os::CAS(&mread_count, read_count, count)) {
+                read_count = mread_count;
+                if (int(count - read_count) <= 0)
+                    result = OldData;
+            }
+            return result;
+        }
+
+        /**
+         * Get a copy of the Data (non allocating).
+         *
+         * @param pull A copy of the data.
+         * @param copy_old_data If true, also copy the data if the data object
+         *                      has not been updated since the last call.
+         */
+        virtual FlowStatus Get( reference_t pull, bool copy_old_data = true ) const
+        {
+            return Get( pull, copy_old_data, /* copy_sample = */ false );
+        }
+
+        /**
+         * Set the data to a certain value (non blocking).
+         *
+         * @param push The data which must be set.
+         * @return false if another thread was writing at the same time, in
+         * which case \a push is dropped.
+         */
+        virtual bool Set( param_t push )
+        {
+            if (!initialized) {
+                log(Error) << "You set a lock-free data object of type " << internal::DataSourceTypeInfo<T>::getType() << " without initializing it with a data sample. "
+                           << "This might not be real-time safe." << endlog();
+                data_sample(value_t(), true);
+            }
+
+            if ( !os::CAS(&write_lock, 0, 1) ) {
+                // abort, another thread is writing
+                return false;
+            }
+
+            const unsigned int count = mwrite_count;
+            Slot& slot = slots[(count + 1) & 1];
+            slot.seq = slot.seq + 1;
+            oro_smp_mb();
+            slot.data = push;
+            oro_smp_mb();
+            slot.seq = slot.seq + 1;
+            // readers that see the new mwrite_count must also see the completed slot
+            oro_smp_wmb();
+            mwrite_count = count + 1;
+            oro_smp_mb();
+            oro_atomic_set(&write_lock, 0);
+            return true;
+        }
+
+        virtual bool data_sample( param_t sample, bool reset = true ) {
+            if (!initialized || reset) {
+                for (unsigned int i = 0; i < 2; ++i) {
+                    slots[i].data = sample;
+                    slots[i].seq = 0;
+                }
+                mwrite_count = 0;
+                mread_count = 0;
+                mclear_count = 0;
+                initialized = true;
+                return true;
+            } else {
+                return initialized;
+            }
+        }
+
+        /**
+         * Reads back a data sample.
+         */
+        virtual value_t data_sample() const {
+            value_t sample;
+            (void) Get(sample, /* copy_old_data = */ true, /* copy_sample = */ true);
+            return sample;
+        }
+
+        /**
+         * Subsequent Get() calls return NoData until a new sample has been written.
+         */
+        virtual void clear() {
+            if (!initialized) return;
+            mclear_count = mwrite_count;
+        }
+    };
+}}
+
+#endif
@@ -85,3 +85,10 @@ void OperationCallerInterface::reportError() {
         this->myengine->setExceptionTask();
 }
 
+bool OperationCallerInterface::setSendPoolSize(unsigned int) {
+    return false;
+}
+
+SendPoolStatistics OperationCallerInterface::getSendPoolStatistics() const {
+    return SendPoolStatistics();
+}
@@ -47,6 +47,23 @@ namespace RTT
 {
     namespace base
     {
+        /**
+         * The counters of the pool of clones which an operation caller
+         * reuses for send().
+         */
+        struct SendPoolStatistics
+        {
+            SendPoolStatistics() : size(0), hits(0), misses(0), available(0) {}
+            /** The number of clones in the pool. */
+            unsigned int size;
+            /** The number of sends that reused a clone of the pool. */
+            unsigned int hits;
+            /** The number of sends that allocated a clone because all clones were in use. */
+            unsigned int misses;
+            /** The number of clones which are ready for a send. */
+            unsigned int available;
+        };
+
         /**
          * The interface class for operation callers.
          */
@@ -118,6 +135,20 @@ namespace RTT
 
             ExecutionEngine* getMessageProcessor() const;
 
+            /**
+             * Preallocates \a size clones which send() reuses once their
+             * SendHandle is released, instead of allocating a clone for
+             * each send. A size of zero removes the pool.
+             * @return false if this caller does not support a pool.
+             * @nrt
+             */
+            virtual bool setSendPoolSize(unsigned int size);
+
+            /**
+             * Returns the counters of the pool of setSendPoolSize().
+             */
+            virtual SendPoolStatistics getSendPoolStatistics() const;
+
         protected:
             ExecutionEngine* myengine;
             ExecutionEngine* caller;
@@ -42,15 +42,23 @@
 #include "../internal/ConnFactory.hpp"
 #include "../TaskContext.hpp"
 #include <cstring>
+#include <sstream>
+#include <algorithm>
 
 using namespace RTT;
 using namespace RTT::detail;
 using namespace std;
 
 PortInterface::PortInterface(const std::string& name)
-    : name(name), fullName(name), iface(0), cmanager(this) {}
+    : name(name), fullName(name), iface(0), cmanager(this)
+{
+    ORO_ATOMIC_SETUP(&mcallback_pending, 0);
+}
 
-PortInterface::~PortInterface() {}
+PortInterface::~PortInterface()
+{
+    ORO_ATOMIC_CLEANUP(&mcallback_pending);
+}
 
 bool PortInterface::setName(const std::string& name) {
     if ( !connected() ) {
@@ -98,6 +106,8 @@ Service* PortInterface::createPortObject()
 
     typedef void (PortInterface::*disconnect_all)();
     to->addSynchronousOperation("disconnect", static_cast<disconnect_all>(&PortInterface::disconnect), this).doc("Disconnects this port from any connection it is part of.");
+    to->addSynchronousOperation("statistics", &PortInterface::reportConnectionStatistics, this).doc("Returns the statistics of all connections of this port that were created with the statistics flag set in their ConnPolicy.");
+    to->addSynchronousOperation("resetStatistics", &PortInterface::resetConnectionStatistics, this).doc("Resets the statistics of all connections of this port.");
     return to;
 #else
     return 0;
@@ -123,3 +133,56 @@ internal::SharedConnectionBase::shared_ptr PortInterface::getSharedConnection()
 {
     return cmanager.getSharedConnection();
 }
+
+static void addConnectionStatistics(ChannelElementBase::shared_ptr const& channel, std::vector<internal::ConnectionStatistics::shared_ptr>& result)
+{
+    internal::ChannelStatisticsElementBase* element = dynamic_cast<internal::ChannelStatisticsElementBase*>(channel.get());
+    if (!element) return;
+    internal::ConnectionStatistics::shared_ptr statistics = element->getStatistics();
+    if (std::find(result.begin(), result.end(), statistics) == result.end())
+        result.push_back(statistics);
+}
+
+std::vector<internal::ConnectionStatistics::shared_ptr> PortInterface::getConnectionStatistics() const
+{
+    std::vector<internal::ConnectionStatistics::shared_ptr> result;
+
+    // PerInputPort and PerOutputPort buffers are installed right next to the endpoint.
+    ChannelElementBase* endpoint = getEndpoint();
+    if (endpoint) {
+        addConnectionStatistics(endpoint->getInput(), result);
+        addConnectionStatistics(endpoint->getOutput(), result);
+    }
+
+    // Shared connections hold their buffer.
+    internal::SharedConnectionBase::shared_ptr shared_connection = getSharedConnection();
+    if (shared_connection)
+        addConnectionStatistics(shared_connection->getStorage(), result);
+
+    // PerConnection buffers are found by following each connection up to the next port.
+    internal::ConnectionManager::Connections connections = cmanager.getConnections();
+    for(internal::ConnectionManager::Connections::const_iterator it = connections.begin(); it != connections.end(); ++it) {
+        ChannelElementBase::shared_ptr channel = it->get<1>();
+        for(ChannelElementBase::shared_ptr element = channel; element && !element->getPort(); element = element->getOutput())
+            addConnectionStatistics(element, result);
+        for(ChannelElementBase::shared_ptr element = channel; element && !element->getPort(); element = element->getInput())
+            addConnectionStatistics(element, result);
+    }
+    return result;
+}
+
+std::string PortInterface::reportConnectionStatistics() const
+{
+    std::vector<internal::ConnectionStatistics::shared_ptr> statistics = getConnectionStatistics();
+    std::ostringstream report;
+    for(std::vector<internal::ConnectionStatistics::shared_ptr>::const_iterator it = statistics.begin(); it != statistics.end(); ++it)
+        report << **it;
+    return report.str();
+}
+
+void PortInterface::resetConnectionStatistics()
+{
+    std::vector<internal::ConnectionStatistics::shared_ptr> statistics = getConnectionStatistics();
+    for(std::vector<internal::ConnectionStatistics::shared_ptr>::const_iterator it = statistics.begin(); it != statistics.end(); ++it)
+        (*it)->reset();
+}
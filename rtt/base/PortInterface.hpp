@@ -40,13 +40,16 @@
 #define ORO_EXECUTION_PORT_INTERFACE_HPP
 
 #include <string>
+#include <vector>
 #include "../internal/rtt-internal-fwd.hpp"
 #include "../ConnPolicy.hpp"
 #include "../internal/ConnectionManager.hpp"
 #include "../internal/ConnID.hpp"
+#include "../internal/ConnectionStatistics.hpp"
 #include "ChannelElementBase.hpp"
 #include "../types/rtt-types-fwd.hpp"
 #include "../os/Mutex.hpp"
+#include "../os/Atomic.hpp"
 #include "../rtt-fwd.hpp"
 
 namespace RTT
@@ -64,6 +67,13 @@ namespace RTT
 
         void updateFullName();
 
+        /**
+         * Non-zero while this port is queued for a callback in an
+         * ExecutionEngine, such that a burst of samples queues it only once.
+         */
+        oro_atomic_t mcallback_pending;
+        friend class RTT::ExecutionEngine;
+
     protected:
         DataFlowInterface* iface;
         internal::ConnectionManager cmanager;
@@ -245,6 +255,23 @@ namespace RTT
          * Returns a pointer to the shared connection element this port may be connected to.
          */
         virtual internal::SharedConnectionBase::shared_ptr getSharedConnection() const;
+
+        /**
+         * Returns the statistics of all connections of this port which were
+         * created with the ConnPolicy::statistics flag set. Connections which
+         * share a buffer with other connections also share its statistics.
+         */
+        std::vector<internal::ConnectionStatistics::shared_ptr> getConnectionStatistics() const;
+
+        /**
+         * Returns a human readable report of getConnectionStatistics().
+         */
+        std::string reportConnectionStatistics() const;
+
+        /**
+         * Resets the statistics of all connections of this port.
+         */
+        void resetConnectionStatistics();
     };
 
 }}
@@ -308,6 +308,30 @@ namespace RTT {
         return this->engine()->getActivity() && this->engine()->getActivity()->setCpuAffinity(cpu);
     }
 
+    os::CpuSet TaskCore::getCpuSet() const
+    {
+        return this->engine()->getActivity() ? this->engine()->getActivity()->getCpuSet() : os::CpuSet();
+    }
+
+    bool TaskCore::setCpuSet(const os::CpuSet& cpus)
+    {
+        return this->engine()->getActivity() && this->engine()->getActivity()->setCpuSet(cpus);
+    }
+
+    int TaskCore::getNumaNode() const
+    {
+        return this->engine()->getActivity() ? this->engine()->getActivity()->getNumaNode() : -1;
+    }
+
+    bool TaskCore::setNumaNode(int node)
+    {
+        if ( !this->engine()->getActivity() || !this->engine()->getActivity()->setNumaNode(node) )
+            return false;
+        if ( !this->engine()->setQueueNumaNode(node) )
+            log(Debug) << "Could not place the queues of the ExecutionEngine on NUMA node " << node << endlog();
+        return true;
+    }
+
     bool TaskCore::configureHook() {
         return true;
     }
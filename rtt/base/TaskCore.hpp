@@ -43,6 +43,7 @@
 #include "../rtt-fwd.hpp"
 #include "../rtt-config.h"
 #include "../Time.hpp"
+#include "../os/CpuSet.hpp"
 
 namespace RTT
 { namespace base {
@@ -246,6 +247,37 @@ namespace RTT
          */
         virtual bool setCpuAffinity(unsigned cpu);
 
+        /**
+         * Get the cpus this component may run on.
+         * @see ActivityInterface::getCpuSet()
+         */
+        virtual os::CpuSet getCpuSet() const;
+
+        /**
+         * Sets the cpus this component may run on, which may include
+         * cpus above 31.
+         * @return false if not allowed by the component's activity.
+         * @see ActivityInterface::setCpuSet()
+         */
+        virtual bool setCpuSet(const os::CpuSet& cpus);
+
+        /**
+         * Get the NUMA node this component was placed on, or -1 if none.
+         * @see ActivityInterface::getNumaNode()
+         */
+        virtual int getNumaNode() const;
+
+        /**
+         * Runs this component on the cpus of NUMA node \a node and places
+         * the stack of its thread and the queues of its ExecutionEngine in
+         * the memory of that node. Placing the memory is done on a best
+         * effort basis.
+         * @param node The NUMA node, or -1 to allow all cpus again.
+         * @return false if not allowed by the component's activity.
+         * @see ActivityInterface::setNumaNode()
+         */
+        virtual bool setNumaNode(int node);
+
         /**
          * Inspect if the component is in the FatalError state.
          * There is no possibility to recover from this state.
@@ -49,6 +49,7 @@
 #include "SlaveActivity.hpp"
 #include "SequentialActivity.hpp"
 #include "PeriodicActivity.hpp"
+#include "ThreadPoolActivity.hpp"
 #include "../Activity.hpp"
 #include "../base/RunnableInterface.hpp"
 
@@ -70,6 +70,13 @@ namespace RTT {
         this->init();
     }
 
+    PeriodicActivity::PeriodicActivity(int scheduler, int priority, Seconds period, const os::CpuSet& cpus, RunnableInterface* r )
+        : ActivityInterface(r), running(false), active(false),
+          thread_( TimerThread::Instance(scheduler, priority, period, cpus) )
+    {
+        this->init();
+    }
+
     PeriodicActivity::PeriodicActivity(TimerThreadPtr thread, RunnableInterface* r )
         : ActivityInterface(r), running(false), active(false),
           thread_( thread )
@@ -82,6 +89,7 @@ namespace RTT {
           thread_(thread)
     {
         this->init();
+        mperiod = Seconds_to_nsecs(period);
     }
 
     PeriodicActivity::PeriodicActivity(secs s, nsecs ns, TimerThreadPtr thread, RunnableInterface* r )
@@ -90,6 +98,7 @@ namespace RTT {
           thread_(thread)
     {
         this->init();
+        mperiod = secs_to_nsecs(s) + ns;
     }
 
     PeriodicActivity::~PeriodicActivity()
@@ -98,6 +107,12 @@ namespace RTT {
     }
 
     void PeriodicActivity::init() {
+        mperiod = 0;
+        mticks = 1;
+        mlast_step = 0;
+        mmax_jitter = 0;
+        mjitter_sum = 0;
+        mjitter_count = 0;
     }
 
     bool PeriodicActivity::start()
@@ -158,9 +173,22 @@ namespace RTT {
 
     Seconds PeriodicActivity::getPeriod() const
     {
+        if ( mperiod )
+            return nsecs_to_Seconds(mperiod);
         return thread_->getPeriod();
     }
 
+    nsecs PeriodicActivity::getMaxJitter() const
+    {
+        return mmax_jitter;
+    }
+
+    nsecs PeriodicActivity::getMeanJitter() const
+    {
+        unsigned long count = mjitter_count;
+        return count ? mjitter_sum / nsecs(count) : 0;
+    }
+
     bool PeriodicActivity::setPeriod(Seconds s) {
         return false;
     }
@@ -175,6 +203,26 @@ namespace RTT {
       return thread_->setCpuAffinity(cpu);
     }
 
+    os::CpuSet PeriodicActivity::getCpuSet() const
+    {
+      return thread_->getCpuSet();
+    }
+
+    bool PeriodicActivity::setCpuSet(const os::CpuSet& cpus)
+    {
+      return thread_->setCpuSet(cpus);
+    }
+
+    int PeriodicActivity::getNumaNode() const
+    {
+      return thread_->getNumaNode();
+    }
+
+    bool PeriodicActivity::setNumaNode(int node)
+    {
+      return thread_->setNumaNode(node);
+    }
+
     bool PeriodicActivity::initialize() {
         if (runner != 0)
             return runner->initialize();
@@ -123,6 +123,24 @@ namespace RTT
          */
         PeriodicActivity(int scheduler, int priority, Seconds period, unsigned cpu_affinity, base::RunnableInterface* r=0 );
 
+        /**
+         * @brief Create a Periodic Activity with a given scheduler type, priority and set of cpus.
+         *
+         * @param scheduler
+         *        The scheduler in which the activitie's thread must run. Use ORO_SCHED_OTHER or
+         *        ORO_SCHED_RT.
+         * @param priority
+         *        The priority of this activity.
+         * @param period
+         *        The periodicity of the PeriodicActivity
+         * @param cpus
+         *        The cpus to run on, which may include cpus above 31.
+         *        A TimerThread with the same cpus is shared.
+         * @param r
+         *        The optional base::RunnableInterface to run exclusively within this Activity
+         */
+        PeriodicActivity(int scheduler, int priority, Seconds period, const os::CpuSet& cpus, base::RunnableInterface* r=0 );
+
 
         /**
          * @brief Create a Periodic Activity executing in a given thread.
@@ -188,10 +206,30 @@ namespace RTT
 
         virtual bool setPeriod(Seconds s);
 
+        /**
+         * The largest deviation from the period between two consecutive
+         * steps of this activity since it was started.
+         */
+        nsecs getMaxJitter() const;
+
+        /**
+         * The mean deviation from the period between two consecutive
+         * steps of this activity since it was started.
+         */
+        nsecs getMeanJitter() const;
+
         virtual unsigned getCpuAffinity() const;
 
         virtual bool setCpuAffinity(unsigned cpu);
 
+        virtual os::CpuSet getCpuSet() const;
+
+        virtual bool setCpuSet(const os::CpuSet& cpus);
+
+        virtual int getNumaNode() const;
+
+        virtual bool setNumaNode(int node);
+
         virtual os::ThreadInterface* thread();
 
         /**
@@ -215,6 +253,8 @@ namespace RTT
         virtual void finalize();
 
     protected:
+        friend class TimerThread;
+
         void init();
 
         /**
@@ -231,6 +271,21 @@ namespace RTT
          * The thread which runs this activity.
          */
         TimerThreadPtr thread_;
+
+        /**
+         * The period given at construction, or zero for the period of \a thread_.
+         */
+        nsecs mperiod;
+
+        /**
+         * Bookkeeping of \a thread_: the period in ticks of \a thread_,
+         * the time of the last step and the jitter statistics.
+         */
+        unsigned long long mticks;
+        nsecs mlast_step;
+        nsecs mmax_jitter;
+        nsecs mjitter_sum;
+        unsigned long mjitter_count;
     };
 
 }}
@@ -0,0 +1,377 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PoolScheduler.hpp"
+#include "ThreadPoolActivity.hpp"
+
+#include "../os/Thread.hpp"
+#include "../os/MutexLock.hpp"
+#include "../os/Semaphore.hpp"
+#ifndef OROBLD_OS_NO_ASM
+#include "../os/CAS.hpp"
+#endif
+#include "../os/MainThread.hpp"
+#include "../Logger.hpp"
+
+#include <sstream>
+
+namespace RTT {
+    using namespace extras;
+    using os::MutexLock;
+
+    /**
+     * A worker thread of the pool with its queue of triggered activities.
+     * The queue is a stack which is only ever pushed to or taken as a whole,
+     * so a compare-and-swap never mistakes a reused head for the one it read.
+     */
+    class PoolScheduler::Worker
+        : public os::Thread
+    {
+    public:
+        PoolScheduler* pool;
+        unsigned int index;
+        volatile bool stopping;
+        /**
+         * The most recently queued activity, linked to the ones queued before.
+         */
+        ThreadPoolActivity* volatile queue;
+        /**
+         * 1 while this worker waits on wakeup.
+         */
+        oro_atomic_t sleeping;
+        os::Semaphore wakeup;
+
+        Worker(PoolScheduler* pool, unsigned int index, int scheduler, int priority,
+               unsigned cpu_affinity, const std::string& name)
+            : os::Thread(scheduler, priority, 0.0, cpu_affinity, name),
+              pool(pool), index(index), stopping(false), queue(0), wakeup(0)
+        {
+            ORO_ATOMIC_SETUP(&sleeping, 0);
+        }
+
+        ~Worker()
+        {
+            this->stop();
+            ORO_ATOMIC_CLEANUP(&sleeping);
+        }
+
+        /**
+         * Pushes the chain of activities from \a first to \a last.
+         */
+        void push(ThreadPoolActivity* first, ThreadPoolActivity* last)
+        {
+#ifdef OROBLD_OS_NO_ASM
+            MutexLock locker(pool->mlock);
+            last->mnext = queue;
+            queue = first;
+#else
+            ThreadPoolActivity* head;
+            do {
+                head = queue;
+                last->mnext = head;
+            } while ( !os::CAS(&queue, head, first) );
+#endif
+        }
+
+        /**
+         * Takes all queued activities, most recently queued first.
+         */
+        ThreadPoolActivity* takeAll()
+        {
+            ThreadPoolActivity* head;
+#ifdef OROBLD_OS_NO_ASM
+            MutexLock locker(pool->mlock);
+            head = queue;
+            queue = 0;
+#else
+            do {
+                head = queue;
+            } while ( head && !os::CAS(&queue, head, (ThreadPoolActivity*)0) );
+#endif
+            return head;
+        }
+
+        /**
+         * Clears the sleeping flag. Only the caller which cleared it
+         * may signal wakeup.
+         */
+        bool claim()
+        {
+#ifdef OROBLD_OS_NO_ASM
+            MutexLock locker(pool->mlock);
+            if ( oro_atomic_read(&sleeping) == 0 )
+                return false;
+            oro_atomic_set(&sleeping, 0);
+            return true;
+#else
+            return os::CAS(&sleeping, 1, 0);
+#endif
+        }
+
+        /**
+         * Wakes up this worker if it sleeps.
+         */
+        bool wake()
+        {
+            if ( !claim() )
+                return false;
+            wakeup.signal();
+            return true;
+        }
+
+        /**
+         * Waits until an activity is queued or this worker is stopped.
+         */
+        void sleep()
+        {
+            oro_atomic_set(&sleeping, 1);
+            // pairs with the barrier in schedule(): either we see the
+            // queued activity, or the scheduler sees us sleeping.
+            oro_smp_mb();
+            if ( (pool->mqueued.read() != 0 || stopping) && claim() )
+                return;
+            // no work, or somebody claimed us and signals wakeup.
+            wakeup.wait();
+        }
+
+        virtual bool initialize()
+        {
+            stopping = false;
+            return true;
+        }
+
+        virtual void loop()
+        {
+            while ( true ) {
+                ThreadPoolActivity* a = pool->take(index);
+                if (a) {
+                    pool->execute(index, a);
+                    continue;
+                }
+                if (stopping)
+                    return;
+                sleep();
+            }
+        }
+
+        virtual bool breakLoop()
+        {
+            stopping = true;
+            oro_smp_mb();
+            wake();
+            return true;
+        }
+    };
+
+    PoolScheduler::PoolList PoolScheduler::Pools;
+    os::Mutex PoolScheduler::PoolsLock;
+
+    PoolSchedulerPtr PoolScheduler::Instance(int scheduler, int priority)
+    {
+        return Instance(scheduler, priority, DefaultWorkers);
+    }
+
+    PoolSchedulerPtr PoolScheduler::Instance(int scheduler, int priority, unsigned int workers)
+    {
+        os::CheckPriority(scheduler, priority);
+        if (workers == 0)
+            workers = 1;
+        MutexLock locker(PoolsLock);
+        PoolList::iterator it = Pools.begin();
+        while ( it != Pools.end() ) {
+            PoolSchedulerPtr pptr = it->lock();
+            // detect old pointer.
+            if ( !pptr ) {
+                Pools.erase(it);
+                it = Pools.begin();
+                continue;
+            }
+            if ( pptr->getScheduler() == scheduler &&
+                 pptr->getPriority() == priority &&
+                 pptr->getWorkerCount() == workers ) {
+                return pptr;
+            }
+            ++it;
+        }
+        PoolSchedulerPtr ret( new PoolScheduler(scheduler, priority, workers, "PoolSchedulerInstance") );
+        Pools.push_back( ret );
+        return ret;
+    }
+
+    PoolScheduler::PoolScheduler(int scheduler, int priority, unsigned int workers,
+                                 const std::string& name, unsigned cpu_affinity)
+    {
+        ORO_ATOMIC_SETUP(&mnext, 0);
+        if (workers == 0)
+            workers = 1;
+        mworkers.reserve(workers);
+        for (unsigned int i = 0; i != workers; ++i) {
+            std::stringstream worker_name;
+            worker_name << name << "." << i;
+            mworkers.push_back( new Worker(this, i, scheduler, priority, cpu_affinity, worker_name.str()) );
+        }
+    }
+
+    PoolScheduler::~PoolScheduler()
+    {
+        this->stop();
+        for (unsigned int i = 0; i != mworkers.size(); ++i)
+            delete mworkers[i];
+        ORO_ATOMIC_CLEANUP(&mnext);
+    }
+
+    bool PoolScheduler::start()
+    {
+        MutexLock locker(mstart_lock);
+        for (unsigned int i = 0; i != mworkers.size(); ++i) {
+            if ( !mworkers[i]->isActive() && !mworkers[i]->start() ) {
+                log(Error) << "PoolScheduler: failed to start worker " << mworkers[i]->getName() << endlog();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool PoolScheduler::stop()
+    {
+        MutexLock locker(mstart_lock);
+        bool result = true;
+        for (unsigned int i = 0; i != mworkers.size(); ++i) {
+            if ( mworkers[i]->isActive() && !mworkers[i]->stop() )
+                result = false;
+        }
+        return result;
+    }
+
+    int PoolScheduler::currentWorker() const
+    {
+        for (unsigned int i = 0; i != mworkers.size(); ++i)
+            if ( mworkers[i]->isSelf() )
+                return i;
+        return -1;
+    }
+
+    void PoolScheduler::schedule(ThreadPoolActivity* activity)
+    {
+        unsigned int n = mworkers.size();
+        int self = currentWorker();
+        unsigned int target = self < 0 ? unsigned(oro_atomic_inc_return(&mnext)) % n : self;
+        mqueued.inc();
+        mworkers[target]->push(activity, activity);
+        wakeOne(target);
+    }
+
+    void PoolScheduler::wakeOne(unsigned int first)
+    {
+        // pairs with the barrier in Worker::sleep().
+        oro_smp_mb();
+        unsigned int n = mworkers.size();
+        for (unsigned int i = 0; i != n; ++i)
+            if ( mworkers[(first + i) % n]->wake() )
+                return;
+    }
+
+    ThreadPoolActivity* PoolScheduler::take(unsigned int self)
+    {
+        unsigned int n = mworkers.size();
+        ThreadPoolActivity* chain = mworkers[self]->takeAll();
+        for (unsigned int i = 1; chain == 0 && i < n; ++i) {
+            chain = mworkers[(self + i) % n]->takeAll();
+            if (chain)
+                mstolen.inc();
+        }
+        if (chain == 0)
+            return 0;
+        // the oldest activity is the last one, the others are queued again
+        // where idle workers can steal them.
+        ThreadPoolActivity* last = 0;
+        ThreadPoolActivity* a = chain;
+        while (a->mnext) {
+            last = a;
+            a = a->mnext;
+        }
+        mqueued.dec();
+        if (last) {
+            mworkers[self]->push(chain, last);
+            wakeOne(self + 1);
+        }
+        return a;
+    }
+
+    void PoolScheduler::execute(unsigned int self, ThreadPoolActivity* activity)
+    {
+        bool timeout = false;
+        if ( activity->beginExecution(mworkers[self], timeout) ) {
+            activity->step();
+            activity->work(timeout ? base::RunnableInterface::TimeOut : base::RunnableInterface::Trigger);
+        }
+        // triggered again while executing: the activities queued before get a turn first.
+        if ( activity->endExecution() ) {
+            mqueued.inc();
+            mworkers[self]->push(activity, activity);
+        }
+    }
+
+    int PoolScheduler::getScheduler() const
+    {
+        return mworkers[0]->getScheduler();
+    }
+
+    int PoolScheduler::getPriority() const
+    {
+        return mworkers[0]->getPriority();
+    }
+
+    unsigned PoolScheduler::getCpuAffinity() const
+    {
+        return mworkers[0]->getCpuAffinity();
+    }
+
+    unsigned int PoolScheduler::getWorkerCount() const
+    {
+        return mworkers.size();
+    }
+
+    os::ThreadInterface* PoolScheduler::getWorker(unsigned int i) const
+    {
+        if ( i >= mworkers.size() )
+            return 0;
+        return mworkers[i];
+    }
+
+    os::ThreadInterface* PoolScheduler::getCurrentWorker() const
+    {
+        int self = currentWorker();
+        return self < 0 ? 0 : mworkers[self];
+    }
+
+    int PoolScheduler::getStolenCount() const
+    {
+        return mstolen.read();
+    }
+}
@@ -0,0 +1,233 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_POOL_SCHEDULER_HPP
+#define ORO_POOL_SCHEDULER_HPP
+
+#include <vector>
+#include <string>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include "../os/Mutex.hpp"
+#include "../os/Atomic.hpp"
+#include "../os/ThreadInterface.hpp"
+#include "rtt-extras-fwd.hpp"
+
+namespace RTT
+{ namespace extras {
+
+    /**
+     * PoolScheduler objects are reference counted such that
+     * when the last ThreadPoolActivity which uses it is deleted,
+     * the worker threads are deleted as well.
+     */
+    typedef boost::shared_ptr<PoolScheduler> PoolSchedulerPtr;
+
+    /**
+     * A fixed set of non periodic worker threads which execute triggered
+     * ThreadPoolActivity objects.
+     *
+     * Each worker has its own queue of triggered activities. A worker
+     * executes the oldest activity of its own queue and, when that queue
+     * is empty, steals the queue of another worker. An activity is queued
+     * at most once, such that it is never executed by two workers at the
+     * same time.
+     *
+     * The queues are intrusive lock-free stacks: schedule() pushes an
+     * activity with a compare-and-swap, and a worker takes a whole stack
+     * at once, such that triggering an activity neither allocates memory
+     * nor takes a lock. Idle workers sleep on a semaphore of their own,
+     * and schedule() wakes up a single one of them.
+     *
+     * @warning A blocking call() in the step() of an activity keeps its
+     * worker busy until the call returns. If the called operation is
+     * executed by another activity of the same pool, that activity needs
+     * a free worker. When all workers block in such calls, the pool
+     * deadlocks. Create the pool with more workers than the number of calls
+     * which can block at the same time, or send() operations to
+     * components in the same pool.
+     *
+     * @see ThreadPoolActivity
+     */
+    class RTT_API PoolScheduler
+    {
+    public:
+        /**
+         * The number of workers of the pools created by Instance().
+         */
+        static const unsigned int DefaultWorkers = 4;
+
+        /**
+         * Create a pool of worker threads. The workers are started
+         * when the first activity of this pool is started.
+         *
+         * @param scheduler
+         *        The scheduler in which the workers run
+         * @param priority
+         *        The priority of the workers within \a scheduler
+         * @param workers
+         *        The number of worker threads, at least one.
+         * @param name
+         *        The name of the pool, the workers are named after it.
+         * @param cpu_affinity
+         *        The prefered cpus of the workers (a mask)
+         */
+        PoolScheduler(int scheduler, int priority, unsigned int workers,
+                      const std::string& name = "PoolScheduler", unsigned cpu_affinity = ~0);
+
+        /**
+         * Stops and deletes the worker threads.
+         */
+        ~PoolScheduler();
+
+        /**
+         * Returns a pool with a given scheduler, priority and
+         * DefaultWorkers workers, which is shared with the other
+         * users of this function.
+         */
+        static PoolSchedulerPtr Instance(int scheduler, int priority);
+
+        /**
+         * Returns a pool with a given scheduler, priority and number
+         * of workers, which is shared with the other users of this function.
+         */
+        static PoolSchedulerPtr Instance(int scheduler, int priority, unsigned int workers);
+
+        /**
+         * Starts the worker threads if they are not running yet.
+         */
+        bool start();
+
+        /**
+         * Stops the worker threads. The activities of this pool
+         * must be stopped before.
+         */
+        bool stop();
+
+        /**
+         * Queues a triggered activity for execution and wakes up an
+         * idle worker. If called from a worker, the activity is queued
+         * in the queue of that worker, otherwise the workers take turns.
+         */
+        void schedule(ThreadPoolActivity* activity);
+
+        int getScheduler() const;
+
+        int getPriority() const;
+
+        unsigned getCpuAffinity() const;
+
+        /**
+         * The number of worker threads.
+         */
+        unsigned int getWorkerCount() const;
+
+        /**
+         * Returns worker thread \a i, or null if \a i is out of range.
+         */
+        os::ThreadInterface* getWorker(unsigned int i) const;
+
+        /**
+         * Returns the worker thread which calls this function, or
+         * null if the caller is not a worker of this pool.
+         */
+        os::ThreadInterface* getCurrentWorker() const;
+
+        /**
+         * The number of activities a worker took from the queue of
+         * another worker.
+         */
+        int getStolenCount() const;
+
+    private:
+        class Worker;
+        friend class Worker;
+
+        PoolScheduler(const PoolScheduler&);
+        PoolScheduler& operator=(const PoolScheduler&);
+
+        /**
+         * Returns the index of the calling worker or -1.
+         */
+        int currentWorker() const;
+
+        /**
+         * Takes the oldest activity from the queue of worker \a self, or
+         * steals the queue of another worker. Returns null if all queues
+         * are empty.
+         */
+        ThreadPoolActivity* take(unsigned int self);
+
+        /**
+         * Wakes up the first sleeping worker, starting at worker \a first.
+         */
+        void wakeOne(unsigned int first);
+
+        /**
+         * Executes \a activity in worker \a self.
+         */
+        void execute(unsigned int self, ThreadPoolActivity* activity);
+
+        std::vector<Worker*> mworkers;
+
+        /**
+         * Protects the start and stop of the workers.
+         */
+        os::Mutex mstart_lock;
+
+        /**
+         * Protects the queues and the sleeping flags of the workers on
+         * targets without atomic instructions.
+         */
+        os::Mutex mlock;
+
+        /**
+         * The total number of queued activities. Workers only sleep
+         * when it is zero.
+         */
+        os::AtomicInt mqueued;
+
+        /**
+         * Counts the activities triggered from outside the pool, such
+         * that the workers take turns in receiving them.
+         */
+        oro_atomic_t mnext;
+        os::AtomicInt mstolen;
+
+        typedef std::vector< boost::weak_ptr<PoolScheduler> > PoolList;
+
+        /**
+         * All pools created by Instance().
+         */
+        static PoolList Pools;
+        static os::Mutex PoolsLock;
+    };
+}}
+
+#endif
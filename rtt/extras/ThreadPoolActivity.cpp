@@ -0,0 +1,277 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ThreadPoolActivity.hpp"
+#include "../os/MutexLock.hpp"
+
+namespace RTT {
+    using namespace extras;
+    using namespace base;
+    using os::MutexLock;
+
+    /**
+     * The thread of a ThreadPoolActivity: the worker which is executing
+     * the activity, or no thread at all while the activity is not
+     * executing. The pool's workers can not be modified through it.
+     */
+    class ThreadPoolActivity::PoolThread
+        : public os::ThreadInterface
+    {
+        ThreadPoolActivity* mact;
+        // a task which is no thread, such that isSelf() is always false.
+        RTOS_TASK mno_task;
+
+        os::ThreadInterface* worker() const
+        {
+            os::ThreadInterface* w = mact->mworker;
+            return w ? w : mact->mpool->getWorker(0);
+        }
+    public:
+        PoolThread(ThreadPoolActivity* act)
+            : mact(act), mno_task()
+        {}
+
+        virtual bool start() { return false; }
+        virtual bool stop() { return false; }
+        virtual Seconds getPeriod() const { return 0.0; }
+        virtual bool setPeriod(Seconds s) { return s == 0.0; }
+        virtual nsecs getPeriodNS() const { return 0; }
+        virtual bool isRunning() const { return mact->isRunning(); }
+        virtual bool isActive() const { return mact->isActive(); }
+        virtual const char* getName() const { return mact->mname.c_str(); }
+        virtual RTOS_TASK * getTask() { return mact->mworker ? mact->mworker->getTask() : &mno_task; }
+        virtual const RTOS_TASK * getTask() const { return mact->mworker ? mact->mworker->getTask() : &mno_task; }
+        virtual bool setScheduler(int sched_type) { return sched_type == getScheduler(); }
+        virtual int getScheduler() const { return worker()->getScheduler(); }
+        virtual bool setPriority(int priority) { return priority == getPriority(); }
+        virtual int getPriority() const { return worker()->getPriority(); }
+        virtual unsigned int getPid() const { return mact->mworker ? mact->mworker->getPid() : 0; }
+        virtual unsigned getCpuAffinity() const { return worker()->getCpuAffinity(); }
+        virtual void setMaxOverrun(int m) {}
+        virtual int getMaxOverrun() const { return -1; }
+        virtual void setWaitPeriodPolicy(int p) {}
+        virtual void yield() { if (mact->mworker) mact->mworker->yield(); }
+    };
+
+    ThreadPoolActivity::ThreadPoolActivity(int scheduler, int priority, RunnableInterface* r, const std::string& name )
+        : ActivityInterface(r), mpool( PoolScheduler::Instance(scheduler, priority) ), mthread(0), mname(name),
+          mstate(Idle), mtimeout(false), mactive(false), mrunning(false), mstopping(false), mworker(0),
+          mnext(0)
+    {
+        mthread = new PoolThread(this);
+    }
+
+    ThreadPoolActivity::ThreadPoolActivity(PoolSchedulerPtr pool, RunnableInterface* r, const std::string& name )
+        : ActivityInterface(r), mpool( pool ), mthread(0), mname(name),
+          mstate(Idle), mtimeout(false), mactive(false), mrunning(false), mstopping(false), mworker(0),
+          mnext(0)
+    {
+        mthread = new PoolThread(this);
+    }
+
+    ThreadPoolActivity::~ThreadPoolActivity()
+    {
+        stop();
+        delete mthread;
+    }
+
+    PoolSchedulerPtr ThreadPoolActivity::getPool() const
+    {
+        return mpool;
+    }
+
+    bool ThreadPoolActivity::start()
+    {
+        {
+            MutexLock lock(mlock);
+            if ( mactive || !mpool )
+                return false;
+            mactive = true;
+        }
+        if ( !mpool->start() || !this->initialize() ) {
+            MutexLock lock(mlock);
+            mactive = false;
+            return false;
+        }
+        MutexLock lock(mlock);
+        mrunning = true;
+        return true;
+    }
+
+    bool ThreadPoolActivity::stop()
+    {
+        {
+            MutexLock lock(mlock);
+            if ( !mactive || mstopping )
+                return false;
+            mstopping = true;
+            mrunning = false;
+            // wait until a worker removed us from its queue, unless we're
+            // stopped from our own step().
+            if ( !(mworker && mworker->isSelf()) ) {
+                while ( mstate != Idle )
+                    mcond.wait(mlock);
+            }
+        }
+        this->finalize();
+        MutexLock lock(mlock);
+        mactive = false;
+        mstopping = false;
+        return true;
+    }
+
+    bool ThreadPoolActivity::isRunning() const
+    {
+        return mrunning;
+    }
+
+    bool ThreadPoolActivity::isActive() const
+    {
+        return mactive;
+    }
+
+    bool ThreadPoolActivity::isPeriodic() const
+    {
+        return false;
+    }
+
+    Seconds ThreadPoolActivity::getPeriod() const
+    {
+        return 0.0;
+    }
+
+    bool ThreadPoolActivity::setPeriod(Seconds s)
+    {
+        return s == 0.0;
+    }
+
+    unsigned ThreadPoolActivity::getCpuAffinity() const
+    {
+        return mpool->getCpuAffinity();
+    }
+
+    bool ThreadPoolActivity::setCpuAffinity(unsigned cpu)
+    {
+        return false;
+    }
+
+    bool ThreadPoolActivity::execute()
+    {
+        return false;
+    }
+
+    bool ThreadPoolActivity::trigger()
+    {
+        return schedule(false);
+    }
+
+    bool ThreadPoolActivity::timeout()
+    {
+        return schedule(true);
+    }
+
+    bool ThreadPoolActivity::schedule(bool timeout)
+    {
+        {
+            MutexLock lock(mlock);
+            if ( !mactive || mstopping )
+                return false;
+            if (timeout)
+                mtimeout = true;
+            switch (mstate) {
+            case Idle:
+                mstate = Queued;
+                break;
+            case Executing:
+                mstate = Retriggered;
+                return true;
+            default:
+                // the coming execution will see the work.
+                return true;
+            }
+        }
+        mpool->schedule(this);
+        return true;
+    }
+
+    bool ThreadPoolActivity::beginExecution(os::ThreadInterface* worker, bool& timeout)
+    {
+        MutexLock lock(mlock);
+        if ( !mactive || mstopping )
+            return false;
+        mstate = Executing;
+        mworker = worker;
+        timeout = mtimeout;
+        mtimeout = false;
+        return true;
+    }
+
+    bool ThreadPoolActivity::endExecution()
+    {
+        MutexLock lock(mlock);
+        mworker = 0;
+        if ( mstate == Retriggered && mactive && !mstopping ) {
+            mstate = Queued;
+            return true;
+        }
+        mstate = Idle;
+        if ( mstopping )
+            mcond.broadcast();
+        return false;
+    }
+
+    os::ThreadInterface* ThreadPoolActivity::thread()
+    {
+        return mthread;
+    }
+
+    bool ThreadPoolActivity::initialize()
+    {
+        if ( runner )
+            return runner->initialize();
+        return true;
+    }
+
+    void ThreadPoolActivity::step()
+    {
+        if ( runner )
+            runner->step();
+    }
+
+    void ThreadPoolActivity::work(base::RunnableInterface::WorkReason reason)
+    {
+        if ( runner )
+            runner->work(reason);
+    }
+
+    void ThreadPoolActivity::finalize()
+    {
+        if ( runner )
+            runner->finalize();
+    }
+}
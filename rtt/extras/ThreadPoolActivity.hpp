@@ -0,0 +1,208 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_THREAD_POOL_ACTIVITY_HPP
+#define ORO_THREAD_POOL_ACTIVITY_HPP
+
+#include "../base/ActivityInterface.hpp"
+#include "../base/RunnableInterface.hpp"
+#include "../os/Mutex.hpp"
+#include "../os/Condition.hpp"
+#include "PoolScheduler.hpp"
+
+namespace RTT
+{ namespace extras {
+
+    /**
+     * @brief A non periodic activity which is executed by the worker
+     * threads of a PoolScheduler instead of by a thread of its own.
+     *
+     * Use this activity for the many event driven components of a large
+     * application which are idle most of the time: they share the
+     * workers of one pool instead of each owning a thread.
+     *
+     * \section TrigReact Reactions to trigger():
+     * The activity is queued in the pool and a worker executes step()
+     * and work(base::RunnableInterface::Trigger). Triggers which arrive
+     * while the activity is queued are merged, triggers which arrive
+     * while it is executing cause one more execution.
+     *
+     * \section TimeReact Reactions to timeout():
+     * Same as trigger(), but the worker executes
+     * work(base::RunnableInterface::TimeOut).
+     *
+     * \section ExecReact Reactions to execute():
+     * Always returns false.
+     *
+     * The activity never executes in two workers at the same time, and
+     * thread()->isSelf() is true in the worker which executes it. Since
+     * the workers execute step() and never loop(), a base::RunnableInterface
+     * which blocks in loop() can not be run by this activity. Blocking
+     * calls in step(), such as calling an operation of another component
+     * of the same pool, occupy a worker until they return, and deadlock
+     * the pool when they occupy all workers (see PoolScheduler).
+     *
+     * @ingroup CoreLibActivities
+     */
+    class RTT_API ThreadPoolActivity
+        : public base::ActivityInterface
+    {
+    public:
+        /**
+         * Create an activity which is executed by the shared pool with
+         * a given scheduler and priority.
+         * @param scheduler
+         *        The scheduler of the pool's workers.
+         * @param priority
+         *        The priority of the pool's workers.
+         * @param r
+         *        The optional base::RunnableInterface to run exclusively within this Activity
+         * @param name
+         *        The name of this activity.
+         */
+        ThreadPoolActivity(int scheduler, int priority, base::RunnableInterface* r = 0,
+                           const std::string& name = "ThreadPoolActivity");
+
+        /**
+         * Create an activity which is executed by the workers of \a pool.
+         * @param pool
+         *        The pool of worker threads.
+         * @param r
+         *        The optional base::RunnableInterface to run exclusively within this Activity
+         * @param name
+         *        The name of this activity.
+         */
+        ThreadPoolActivity(PoolSchedulerPtr pool, base::RunnableInterface* r = 0,
+                           const std::string& name = "ThreadPoolActivity");
+
+        /**
+         * Stops and terminates a ThreadPoolActivity.
+         */
+        virtual ~ThreadPoolActivity();
+
+        /**
+         * The pool which executes this activity.
+         */
+        PoolSchedulerPtr getPool() const;
+
+        virtual bool start();
+
+        virtual bool stop();
+
+        virtual bool isRunning() const;
+
+        virtual bool isActive() const;
+
+        virtual bool isPeriodic() const;
+
+        virtual Seconds getPeriod() const;
+
+        virtual bool setPeriod(Seconds s);
+
+        virtual unsigned getCpuAffinity() const;
+
+        virtual bool setCpuAffinity(unsigned cpu);
+
+        virtual bool execute();
+
+        virtual bool trigger();
+
+        virtual bool timeout();
+
+        virtual os::ThreadInterface* thread();
+
+        /**
+         * @see base::RunnableInterface::initialize()
+         */
+        virtual bool initialize();
+
+        /**
+         * @see base::RunnableInterface::step()
+         */
+        virtual void step();
+
+        /**
+         * @see base::RunnableInterface::work()
+         */
+        virtual void work(base::RunnableInterface::WorkReason reason);
+
+        /**
+         * @see base::RunnableInterface::finalize()
+         */
+        virtual void finalize();
+
+    private:
+        friend class PoolScheduler;
+        class PoolThread;
+
+        ThreadPoolActivity(const ThreadPoolActivity&);
+        ThreadPoolActivity& operator=(const ThreadPoolActivity&);
+
+        /**
+         * Queues this activity in the pool if it is not queued or executing yet.
+         */
+        bool schedule(bool timeout);
+
+        /**
+         * Called by the worker \a worker when it takes this activity from a queue.
+         * Returns false if this activity must not be executed.
+         */
+        bool beginExecution(os::ThreadInterface* worker, bool& timeout);
+
+        /**
+         * Called by the worker when it executed this activity.
+         * Returns true if it must be queued again.
+         */
+        bool endExecution();
+
+        enum State { Idle, Queued, Executing, Retriggered };
+
+        PoolSchedulerPtr mpool;
+        PoolThread* mthread;
+        std::string mname;
+
+        /**
+         * Protects all fields below.
+         */
+        os::Mutex mlock;
+        os::Condition mcond;
+        State mstate;
+        bool mtimeout;
+        bool mactive;
+        bool mrunning;
+        bool mstopping;
+        os::ThreadInterface* mworker;
+
+        /**
+         * The link to the activity queued before this one in the queue of a worker.
+         */
+        ThreadPoolActivity* mnext;
+    };
+}}
+
+#endif
@@ -45,6 +45,7 @@
 #include <algorithm>
 #include "../os/MutexLock.hpp"
 #include "../os/MainThread.hpp"
+#include "../os/TimeService.hpp"
 
 namespace RTT {
     using namespace extras;
@@ -52,6 +53,15 @@ namespace RTT {
     using os::MutexLock;
     using namespace std;
 
+    /**
+     * Orders the heap such that the earliest deadline is on top.
+     */
+    struct TimerThread::Later {
+        bool operator()(const Deadline& a, const Deadline& b) const {
+            return a.tick > b.tick || ( a.tick == b.tick && a.seq > b.seq );
+        }
+    };
+
     TimerThread::TimerThreadList TimerThread::TimerThreads;
 
     TimerThreadPtr TimerThread::Instance(int pri, double per)
@@ -70,6 +80,30 @@ namespace RTT {
         // to get a match.
         os::CheckPriority(scheduler, pri);
         if (cpu_affinity == 0) cpu_affinity = os::MainThread::Instance()->getCpuAffinity();
+        TimerThreadPtr ret = Find(scheduler, pri, per, os::CpuSet(cpu_affinity));
+        if ( ret )
+            return ret;
+        ret.reset( new TimerThread(scheduler, pri, "TimerThreadInstance", per, cpu_affinity) );
+        TimerThreads.push_back( ret );
+        return ret;
+    }
+
+    TimerThreadPtr TimerThread::Instance(int scheduler, int pri, double per, const os::CpuSet& cpus)
+    {
+        os::CheckPriority(scheduler, pri);
+        os::CpuSet cpu_set = cpus.none() ? os::MainThread::Instance()->getCpuSet() : cpus;
+        TimerThreadPtr ret = Find(scheduler, pri, per, cpu_set);
+        if ( ret )
+            return ret;
+        ret.reset( new TimerThread(scheduler, pri, "TimerThreadInstance", per, 0) );
+        if ( !ret->setCpuSet(cpu_set) )
+            log(Error) << "Failed to set the cpus of a TimerThread to " << cpu_set << endlog();
+        TimerThreads.push_back( ret );
+        return ret;
+    }
+
+    TimerThreadPtr TimerThread::Find(int scheduler, int pri, double per, const os::CpuSet& cpus)
+    {
         TimerThreadList::iterator it = TimerThreads.begin();
         while ( it != TimerThreads.end() ) {
             TimerThreadPtr tptr = it->lock();
@@ -82,26 +116,28 @@ namespace RTT {
             if ( tptr->getScheduler() == scheduler &&
                  tptr->getPriority() == pri &&
                  tptr->getPeriodNS() == Seconds_to_nsecs(per) &&
-                 tptr->getCpuAffinity() == cpu_affinity ) {
+                 tptr->getCpuSet() == cpus ) {
                 return tptr;
             }
             ++it;
         }
-        TimerThreadPtr ret( new TimerThread(scheduler, pri, "TimerThreadInstance", per, cpu_affinity) );
-        TimerThreads.push_back( ret );
-        return ret;
+        return TimerThreadPtr();
     }
 
     TimerThread::TimerThread(int priority, const std::string& name, double periodicity, unsigned cpu_affinity)
-        : Thread( ORO_SCHED_RT, priority, periodicity, cpu_affinity, name), cleanup(false)
+        : Thread( ORO_SCHED_RT, priority, periodicity, cpu_affinity, name),
+          added(MAX_ACTIVITIES), ticks(0), seq(0)
     {
-    	tasks.reserve(MAX_ACTIVITIES);
+        current.activity = 0;
+    	deadlines.reserve(MAX_ACTIVITIES);
     }
 
     TimerThread::TimerThread(int scheduler, int priority, const std::string& name, double periodicity, unsigned cpu_affinity)
-        : Thread(scheduler, priority, periodicity, cpu_affinity, name), cleanup(false)
+        : Thread(scheduler, priority, periodicity, cpu_affinity, name),
+          added(MAX_ACTIVITIES), ticks(0), seq(0)
     {
-    	tasks.reserve(MAX_ACTIVITIES);
+        current.activity = 0;
+    	deadlines.reserve(MAX_ACTIVITIES);
     }
 
     TimerThread::~TimerThread()
@@ -111,28 +147,61 @@ namespace RTT {
     }
 
     bool TimerThread::addActivity( PeriodicActivity* t ) {
+        // the activity is not stepped yet, so we can prepare it here.
+        nsecs tick = this->getPeriodNS();
+        nsecs period = t->mperiod ? t->mperiod : tick;
+        t->mticks = tick > 0 ? (period + tick / 2) / tick : 1;
+        if ( t->mticks == 0 )
+            t->mticks = 1;
+        t->mlast_step = 0;
+        t->mmax_jitter = 0;
+        t->mjitter_sum = 0;
+        t->mjitter_count = 0;
+
+        if ( added.enqueue( t ) )
+            return true;
+        // many activities added at once, insert them ourselves.
         MutexLock lock(mutex);
-        if ( tasks.size() == MAX_ACTIVITIES ) {
-//             Logger::log() << Logger:: << "TimerThread : tasks queue full, failed to add Activity : "<< t << Logger::endl;
-            return false;
-        }
-        tasks.push_back( t );
-//         Logger::log() << Logger::Debug << "TimerThread : successfully started Activity : "<< t  << Logger::endl;
+        this->insertAdded();
+        Deadline d = { ticks + 1, seq++, t };
+        deadlines.push_back( d );
+        push_heap( deadlines.begin(), deadlines.end(), Later() );
         return true;
     }
 
     bool TimerThread::removeActivity( PeriodicActivity* t ) {
+        // waits for a running step() of another thread.
         MutexLock lock(mutex);
-        ActivityList::iterator it = find(tasks.begin(), tasks.end(), t);
-        if ( it != tasks.end() ) {
-            *it = 0; // clear task away
-            cleanup = true;
+        this->insertAdded();
+        if ( current.activity == t ) {
+            current.activity = 0; // removed from its own step()
             return true;
         }
-//         Logger::log() << Logger::Debug << "TimerThread : failed to stop Activity : "<< t->getPeriod() << Logger::endl;
+        for ( DeadlineHeap::iterator it = deadlines.begin(); it != deadlines.end(); ++it ) {
+            if ( it->activity == t ) {
+                *it = deadlines.back();
+                deadlines.pop_back();
+                make_heap( deadlines.begin(), deadlines.end(), Later() );
+                return true;
+            }
+        }
         return false;
     }
 
+    unsigned int TimerThread::getActivityCount() const {
+        MutexLock lock(mutex);
+        return deadlines.size() + added.size() + (current.activity ? 1 : 0);
+    }
+
+    void TimerThread::insertAdded() {
+        PeriodicActivity* t = 0;
+        while ( added.dequeue( t ) ) {
+            Deadline d = { ticks + 1, seq++, t };
+            deadlines.push_back( d );
+            push_heap( deadlines.begin(), deadlines.end(), Later() );
+        }
+    }
+
     bool TimerThread::initialize() {
     	return true;
     }
@@ -140,61 +209,54 @@ namespace RTT {
     void TimerThread::finalize() {
         MutexLock lock(mutex);
 
-        for( ActivityList::iterator t_iter = tasks.begin(); t_iter != tasks.end(); ++t_iter)
-            if ( *t_iter )
-                (*t_iter)->stop(); // stop() calls us back to removeActivity (recursive mutex).
-        if ( cleanup )
-            this->reorderList();
+        this->insertAdded();
+        // an activity which threw from its step() is not in the heap.
+        if ( current.activity ) {
+            PeriodicActivity* t = current.activity;
+            t->stop();
+            current.activity = 0;
+        }
+        while ( !deadlines.empty() ) {
+            PeriodicActivity* t = deadlines.front().activity;
+            t->stop(); // stop() calls us back to removeActivity (recursive mutex).
+            this->removeActivity( t );
+        }
     }
 
     void TimerThread::step() {
         MutexLock lock(mutex);
 
-        // The size of the tasks vector does not change during add/remove, thus
-        // t_iter is never invalidated.
-        for( ActivityList::iterator t_iter = tasks.begin(); t_iter != tasks.end(); ++t_iter)
-		if ( *t_iter ) {
-        		(*t_iter)->step();
-			if (*t_iter)
-			    (*t_iter)->work(RunnableInterface::TimeOut);
-		}
-
-        if ( cleanup )
-            this->reorderList();
-    }
+        this->insertAdded();
+        ++ticks;
+        nsecs tick = this->getPeriodNS();
+        while ( !deadlines.empty() && deadlines.front().tick <= ticks ) {
+            pop_heap( deadlines.begin(), deadlines.end(), Later() );
+            current = deadlines.back();
+            deadlines.pop_back();
 
-    void TimerThread::reorderList() {
-        // reorder the list to remove clear'ed tasks
-        ActivityList::iterator begin = tasks.begin();
-        // first zero :
-        PeriodicActivity* nullActivity = 0;
-        ActivityList::iterator it = tasks.begin();
-
-        it = find( tasks.begin(), tasks.end(), nullActivity); // First zero
-        begin = it+1;
-        while ( it != tasks.end() ) {
-            // Look for first non-zero after 'it' :
-            while ( begin != tasks.end() &&  *begin == 0  )
-                ++begin;
-            if ( begin == tasks.end() )  { // if no task found after zero :
-//                 Logger::log() << Logger::Error << "beginBefore resize :"<< tasks.size() << Logger::endl;
-                tasks.resize( it - tasks.begin() ); // cut out the items after 'it'
-//                 Logger::log() << Logger::Error << "beginAfter resize :"<< tasks.size() << Logger::endl;
-                break; // This is our exit condition !
+            PeriodicActivity* t = current.activity;
+            nsecs now = os::TimeService::Instance()->getNSecs();
+            if ( t->mlast_step != 0 ) {
+                nsecs jitter = now - t->mlast_step - t->mticks * tick;
+                if ( jitter < 0 )
+                    jitter = -jitter;
+                if ( jitter > t->mmax_jitter )
+                    t->mmax_jitter = jitter;
+                t->mjitter_sum += jitter;
+                ++t->mjitter_count;
             }
-            // first zero after begin :
-            ActivityList::iterator end = find ( begin, tasks.end(), nullActivity);
-            // if end == tasks.end() ==> next while will copy all
-            // if end != tasks.end() ==> next while will copy first zero's
-            while ( begin != end ) {
-                *it = *begin; // copy operation
-                ++begin;
-                ++it; // go to next slot to inspect.
+            t->mlast_step = now;
+
+            t->step();
+            if ( current.activity )
+                t->work(RunnableInterface::TimeOut);
+            if ( current.activity ) {
+                current.tick += t->mticks;
+                deadlines.push_back( current );
+                push_heap( deadlines.begin(), deadlines.end(), Later() );
             }
         }
-
-        cleanup = false;
+        current.activity = 0;
     }
 
-
 }
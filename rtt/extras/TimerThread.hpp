@@ -48,6 +48,7 @@
 
 #include "../os/Thread.hpp"
 #include "../os/Mutex.hpp"
+#include "../internal/AtomicMWSRQueue.hpp"
 #include "rtt-extras-fwd.hpp"
 
 namespace RTT
@@ -64,15 +65,48 @@ namespace RTT
      * This Periodic Thread is meant for executing a PeriodicActivity
      * object periodically.
      *
+     * The period of each activity is a multiple of the period of this
+     * thread, called a tick. The activities are kept in a heap ordered
+     * by their next deadline, such that a tick only steps the activities
+     * which are due, in the order in which they were added. Adding an
+     * activity does not block this thread.
+     *
      * @see PeriodicActivity
      */
     class RTT_API TimerThread
         : public os::Thread
     {
-        typedef std::vector<PeriodicActivity*> ActivityList ;
-        ActivityList tasks;
-        bool cleanup;
+        /**
+         * An activity in the heap, due at tick \a tick.
+         * \a seq orders the activities which are due at the same tick.
+         */
+        struct Deadline {
+            unsigned long long tick;
+            unsigned long long seq;
+            PeriodicActivity* activity;
+        };
+        struct Later;
+        typedef std::vector<Deadline> DeadlineHeap;
+        DeadlineHeap deadlines;
+
+        /**
+         * Activities added by addActivity() which are not yet in the heap.
+         */
+        internal::AtomicMWSRQueue<PeriodicActivity*> added;
+
+        /**
+         * The activity being stepped, its \a activity is cleared when it
+         * is removed from its own step().
+         */
+        Deadline current;
+        unsigned long long ticks;
+        unsigned long long seq;
     public:
+        /**
+         * The number of activities for which a TimerThread reserves memory.
+         * More activities can be added, at the cost of a memory allocation
+         * in this thread when the reserved memory is exhausted.
+         */
     	static const unsigned int MAX_ACTIVITIES = 64;
         /**
          * Create a periodic Timer thread.
@@ -102,13 +136,26 @@ namespace RTT
         virtual ~TimerThread();
 
         /**
-         * Add an Timer that will be ticked every execution period
-         * Once added, a timer can not be removed.
+         * Add an activity that will be stepped every period of the
+         * activity, starting at the next tick. A period which is not a
+         * multiple of the period of this thread is rounded to the nearest
+         * multiple, with a minimum of one tick. This function does not
+         * wait for a running step() of this thread.
          */
         bool addActivity( PeriodicActivity* t );
 
+        /**
+         * Remove an activity. When this function returns, the activity
+         * is no longer stepped, unless it is called from the step() of
+         * an activity of this thread.
+         */
         bool removeActivity( PeriodicActivity* t );
 
+        /**
+         * The number of activities which are stepped by this thread.
+         */
+        unsigned int getActivityCount() const;
+
         /**
          * Create a TimerThread with a given priority and periodicity,
          * using the default scheduler, ORO_SCHED_RT.
@@ -122,11 +169,20 @@ namespace RTT
          * Create a TimerThread with a given scheduler, priority and periodicity.
          */
         static TimerThreadPtr Instance(int scheduler, int priority, double periodicity, unsigned cpu_affinity);
+
+        /**
+         * Create a TimerThread with a given scheduler, priority, periodicity
+         * and set of cpus. An empty set selects the cpus of the main thread.
+         */
+        static TimerThreadPtr Instance(int scheduler, int priority, double periodicity, const os::CpuSet& cpus);
     protected:
         virtual bool initialize();
         virtual void step();
         virtual void finalize();
-        void reorderList();
+        /**
+         * Moves the added activities to the heap. Requires \a mutex.
+         */
+        void insertAdded();
         /**
          * A Activity can not create a activity of same priority from step().
          * If so a deadlock will occur.
@@ -143,6 +199,12 @@ namespace RTT
          * All timer threads.
          */
         static TimerThreadList TimerThreads;
+
+        /**
+         * Returns the timer thread which runs with the given scheduler,
+         * priority, period and cpus, or null. Forgets destroyed threads.
+         */
+        static TimerThreadPtr Find(int scheduler, int priority, double periodicity, const os::CpuSet& cpus);
     };
 }} // namespace RTT
 
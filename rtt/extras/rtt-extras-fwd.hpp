@@ -44,10 +44,12 @@ namespace RTT {
         class FileDescriptorActivity;
         class IRQActivity;
         class PeriodicActivity;
+        class PoolScheduler;
         class SequentialActivity;
         class SimulationActivity;
         class SimulationThread;
         class SlaveActivity;
+        class ThreadPoolActivity;
         class TimerThread;
         struct Provider;
         struct RT_INTR;
@@ -0,0 +1,162 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_CHANNEL_STATISTICS_ELEMENT_HPP
+#define ORO_CHANNEL_STATISTICS_ELEMENT_HPP
+
+#include "../base/ChannelElement.hpp"
+#include "../ConnPolicy.hpp"
+#include "../os/TimeService.hpp"
+#include "ConnectionStatistics.hpp"
+
+namespace RTT { namespace internal {
+
+    class ChannelStatisticsElementBase
+    {
+    public:
+        virtual ~ChannelStatisticsElementBase() {};
+        virtual ConnectionStatistics::shared_ptr getStatistics() const = 0;
+    };
+
+    /** A connection element that measures the traffic on the data object or
+     * buffer of a connection, and forwards all writes and reads to it.
+     *
+     * The write time of every sample is stored in a second data object or
+     * buffer of the same policy, such that the latency can be measured when
+     * the sample is read. If writers and readers access the connection
+     * concurrently, the latency of a sample may be unknown, or be that of the
+     * preceding sample.
+     */
+    template<typename T>
+    class ChannelStatisticsElement : public base::ChannelElement<T>, public ChannelStatisticsElementBase
+    {
+    public:
+        typedef typename base::ChannelElement<T>::value_t value_t;
+        typedef typename base::ChannelElement<T>::param_t param_t;
+        typedef typename base::ChannelElement<T>::reference_t reference_t;
+        typedef typename base::ChannelElement<T>::sample_ptr sample_ptr;
+        typedef os::TimeService::nsecs nsecs;
+
+    private:
+        typename base::ChannelElement<T>::shared_ptr storage;
+        typename base::ChannelElement<nsecs>::shared_ptr timestamps;
+        ConnectionStatistics::shared_ptr statistics;
+        const ConnPolicy policy;
+
+        WriteStatus written(WriteStatus result)
+        {
+            // the storage never returns NotConnected, only signalling the reader does.
+            if (result == WriteSuccess && !this->signal())
+                result = NotConnected;
+            statistics->writeDone(result);
+            return result;
+        }
+
+        FlowStatus readDone(FlowStatus result)
+        {
+            nsecs write_time = 0;
+            if (result == NewData) {
+                if (timestamps->read(write_time, false) != NewData)
+                    write_time = 0;
+            } else {
+                // discard the timestamps of samples that were never stored
+                while (timestamps->read(write_time, false) == NewData) {}
+                write_time = 0;
+            }
+            statistics->readDone(result, write_time ? os::TimeService::Instance()->getNSecs() - write_time : 0);
+            return result;
+        }
+
+    public:
+        ChannelStatisticsElement(typename base::ChannelElement<T>::shared_ptr storage, typename base::ChannelElement<nsecs>::shared_ptr timestamps, const ConnPolicy& policy = ConnPolicy())
+            : storage(storage), timestamps(timestamps), statistics(new ConnectionStatistics(policy)), policy(policy) {}
+
+        virtual ConnectionStatistics::shared_ptr getStatistics() const
+        {
+            return statistics;
+        }
+
+        virtual WriteStatus write(param_t sample)
+        {
+            WriteStatus result = storage->write(sample);
+            if (result == WriteSuccess)
+                timestamps->write(os::TimeService::Instance()->getNSecs());
+            return written(result);
+        }
+
+        virtual WriteStatus writeShared(sample_ptr const& sample)
+        {
+            WriteStatus result = storage->writeShared(sample);
+            if (result == WriteSuccess)
+                timestamps->write(os::TimeService::Instance()->getNSecs());
+            return written(result);
+        }
+
+        virtual FlowStatus read(reference_t sample, bool copy_old_data)
+        {
+            return readDone(storage->read(sample, copy_old_data));
+        }
+
+        virtual FlowStatus readShared(sample_ptr& sample, bool copy_old_data = true)
+        {
+            return readDone(storage->readShared(sample, copy_old_data));
+        }
+
+        virtual void clear()
+        {
+            storage->clear();
+            timestamps->clear();
+            base::ChannelElement<T>::clear();
+        }
+
+        virtual WriteStatus data_sample(param_t sample, bool reset = true)
+        {
+            if (storage->data_sample(sample, reset) != WriteSuccess) return WriteFailure;
+            return base::ChannelElement<T>::data_sample(sample, reset);
+        }
+
+        virtual value_t data_sample()
+        {
+            return storage->data_sample();
+        }
+
+        /** Returns a pointer to the ConnPolicy that has been used to construct the underlying storage.
+        */
+        virtual const ConnPolicy* getConnPolicy() const
+        {
+            return &policy;
+        }
+
+        virtual std::string getElementName() const
+        {
+            return "ChannelStatisticsElement";
+        }
+    };
+}}
+
+#endif
@@ -0,0 +1,156 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_CHANNEL_ZERO_COPY_ELEMENT_HPP
+#define ORO_CHANNEL_ZERO_COPY_ELEMENT_HPP
+
+#include "../base/ChannelElement.hpp"
+#include "../base/BufferBase.hpp"
+#include "../base/DataObjectBase.hpp"
+#include "../ConnPolicy.hpp"
+#include "SharedSample.hpp"
+
+namespace RTT { namespace internal {
+
+    /** A connection element that stores references to shared samples instead
+     * of copies of the samples. The references are kept in a data object or
+     * buffer as specified by the ConnPolicy, which is built by the ConnFactory
+     * for the type SharedSample<T>::shared_ptr.
+     *
+     * Shared samples written with writeShared() are stored without copying them,
+     * and readShared() returns the stored sample itself. Samples written
+     * with write() are copied into a sample from a pool owned by this
+     * element, and read() copies the stored sample out again.
+     */
+    template<typename T>
+    class ChannelZeroCopyElement : public base::ChannelElement<T>
+    {
+    public:
+        typedef typename base::ChannelElement<T>::value_t value_t;
+        typedef typename base::ChannelElement<T>::param_t param_t;
+        typedef typename base::ChannelElement<T>::reference_t reference_t;
+        typedef typename base::ChannelElement<T>::sample_ptr sample_ptr;
+
+    private:
+        typename base::ChannelElement<sample_ptr>::shared_ptr storage;
+        typename SharedSamplePool<T>::shared_ptr pool;
+        const ConnPolicy policy;
+
+    public:
+        /**
+         * Returns the maximum number of references to shared samples that a
+         * connection built for \a policy keeps, including samples which are
+         * no longer readable but have not been overwritten yet, and two samples
+         * that may be held by the reader.
+         */
+        static unsigned int getCapacity(ConnPolicy const& policy)
+        {
+            if (policy.type == ConnPolicy::DATA)
+                return base::DataObjectBase::Options(policy).max_threads() + 4;
+            return policy.size + base::BufferBase::Options(policy).max_threads() + 2;
+        }
+
+        ChannelZeroCopyElement(typename base::ChannelElement<sample_ptr>::shared_ptr storage, const ConnPolicy& policy = ConnPolicy(), param_t initial_value = value_t())
+            : storage(storage), pool(new SharedSamplePool<T>(getCapacity(policy), initial_value)), policy(policy) {}
+
+        /** Copies \a sample into a pooled sample and stores a reference to it.
+         *
+         * @return WriteFailure if the pool is exhausted or the storage is full.
+         */
+        virtual WriteStatus write(param_t sample)
+        {
+            sample_ptr shared = pool->allocate();
+            if (!shared) return WriteFailure;
+            shared->value() = sample;
+            return writeShared(shared);
+        }
+
+        /** Stores a reference to \a sample, without copying it. */
+        virtual WriteStatus writeShared(sample_ptr const& sample)
+        {
+            if (storage->write(sample) != WriteSuccess) return WriteFailure;
+            return this->signal() ? WriteSuccess : NotConnected;
+        }
+
+        virtual FlowStatus read(reference_t sample, bool copy_old_data)
+        {
+            sample_ptr stored;
+            FlowStatus result = storage->read(stored, copy_old_data);
+            if (stored && ((result == NewData) || (result == OldData && copy_old_data)))
+                sample = stored->value();
+            return result;
+        }
+
+        /** Replaces \a sample by a reference to the stored sample. */
+        virtual FlowStatus readShared(sample_ptr& sample, bool copy_old_data = true)
+        {
+            sample_ptr stored;
+            FlowStatus result = storage->read(stored, copy_old_data);
+            if (stored && ((result == NewData) || (result == OldData && copy_old_data)))
+                sample = stored;
+            return result;
+        }
+
+        virtual void clear()
+        {
+            storage->clear();
+            base::ChannelElement<T>::clear();
+        }
+
+        /** Replaces the pool used by write() by one initialized with \a sample.
+         * Samples from the old pool that are still stored remain valid. */
+        virtual WriteStatus data_sample(param_t sample, bool reset = true)
+        {
+            if (reset)
+                pool = new SharedSamplePool<T>(getCapacity(policy), sample);
+            return base::ChannelElement<T>::data_sample(sample, reset);
+        }
+
+        virtual value_t data_sample()
+        {
+            sample_ptr shared = pool->allocate();
+            if (shared)
+                return shared->value();
+            return value_t();
+        }
+
+        /** Returns a pointer to the ConnPolicy that has been used to construct the underlying storage.
+        */
+        virtual const ConnPolicy* getConnPolicy() const
+        {
+            return &policy;
+        }
+
+        virtual std::string getElementName() const
+        {
+            return "ChannelZeroCopyElement";
+        }
+    };
+}}
+
+#endif
@@ -41,6 +41,8 @@
 
 #include "ChannelDataElement.hpp"
 #include "ChannelBufferElement.hpp"
+#include "ChannelZeroCopyElement.hpp"
+#include "ChannelStatisticsElement.hpp"
 
 #endif
 
@@ -70,6 +70,17 @@ ConnID* StreamConnID::clone() const {
     return new StreamConnID(this->name_id);
 }
 
+bool ConnFactory::isSingleProducerSingleConsumer(ConnPolicy const& policy)
+{
+    base::BufferBase::Options options(policy);
+    return (policy.type == ConnPolicy::BUFFER)
+        && (policy.buffer_policy == PerConnection)
+        && !options.circular()
+        && !options.multiple_writers()
+        && !options.multiple_readers()
+        && (options.max_threads() <= 2);
+}
+
 base::ChannelElementBase::shared_ptr RTT::internal::ConnFactory::buildRemoteChannelOutput(base::OutputPortInterface& output_port, base::InputPortInterface& input_port, const ConnPolicy& policy)
 {
     // Remote connection
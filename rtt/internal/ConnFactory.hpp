@@ -55,6 +55,7 @@
 #include "../base/Buffer.hpp"
 #include "../base/BufferUnSync.hpp"
 #include "../Logger.hpp"
+#include <boost/type_traits/has_trivial_copy.hpp>
 
 #include "../rtt-config.h"
 
@@ -147,6 +148,37 @@ namespace RTT
          */
         virtual internal::SharedConnectionBase::shared_ptr buildSharedConnection(base::OutputPortInterface *output_port, base::InputPortInterface *input_port, ConnPolicy const& policy) const = 0;
 
+        /**
+         * Checks if a buffer built for \a policy is guaranteed to have exactly
+         * one writer and one reader, such that a base::BufferSPSC can be used.
+         * This is the case for non-circular buffers with a PerConnection buffer policy
+         * and at most two threads accessing the connection.
+         */
+        static bool isSingleProducerSingleConsumer(ConnPolicy const& policy);
+
+#ifndef OROBLD_OS_NO_ASM
+        /**
+         * Builds the data object for a SEQLOCK data connection of a trivially
+         * copyable type \a T.
+         */
+        template<typename T>
+        static base::DataObjectInterface<T>* buildSeqLockDataObject(ConnPolicy const& policy, const T& initial_value, boost::true_type)
+        {
+            return new base::DataObjectSeqLock<T>(initial_value, policy);
+        }
+
+        /**
+         * A sequence lock can not be used for types which are not trivially
+         * copyable, so this overload falls back to a lock-free data object.
+         */
+        template<typename T>
+        static base::DataObjectInterface<T>* buildSeqLockDataObject(ConnPolicy const& policy, const T& initial_value, boost::false_type)
+        {
+            RTT::log(Debug) << "connection " << policy << " has a data type that is not trivially copyable, using a LOCK_FREE data object instead of SEQLOCK" << RTT::endlog();
+            return new base::DataObjectLockFree<T>(initial_value, policy);
+        }
+#endif
+
         /** This method creates the connection element that will store data
          * inside the connection, based on the given policy
          * @todo: shouldn't this belong in the template type info ? This allows the type lib to
@@ -156,6 +188,41 @@ namespace RTT
          */
         template<typename T>
         static base::ChannelElement<T>* buildDataStorage(ConnPolicy const& policy, const T& initial_value = T())
+        {
+            if (policy.statistics)
+            {
+                // measure the traffic on a data object or buffer built for the same policy,
+                // and keep the write times of the samples in a second one.
+                ConnPolicy storage_policy = policy;
+                storage_policy.statistics = false;
+                typename base::ChannelElement<T>::shared_ptr storage = buildDataStorage<T>(storage_policy, initial_value);
+                if (!storage) return NULL;
+                storage_policy.zero_copy = false;
+                base::ChannelElement<os::TimeService::nsecs>::shared_ptr timestamps = buildCopyingDataStorage<os::TimeService::nsecs>(storage_policy);
+                if (!timestamps) return NULL;
+                return new ChannelStatisticsElement<T>(storage, timestamps, policy);
+            }
+#ifndef OROBLD_OS_NO_ASM
+            if (policy.zero_copy)
+            {
+                // store references to shared samples in a data object or buffer built for the same policy
+                typedef typename base::ChannelElement<T>::sample_ptr sample_ptr;
+                ConnPolicy storage_policy = policy;
+                storage_policy.zero_copy = false;
+                typename base::ChannelElement<sample_ptr>::shared_ptr storage = buildCopyingDataStorage<sample_ptr>(storage_policy);
+                if (!storage) return NULL;
+                return new ChannelZeroCopyElement<T>(storage, policy, initial_value);
+            }
+#endif
+            return buildCopyingDataStorage<T>(policy, initial_value);
+        }
+
+        /** This method creates the connection element that stores copies of
+         * the data inside the connection, based on the given policy. The
+         * zero_copy and statistics flags of the policy are ignored.
+         */
+        template<typename T>
+        static base::ChannelElement<T>* buildCopyingDataStorage(ConnPolicy const& policy, const T& initial_value = T())
         {
             if (policy.type == ConnPolicy::DATA)
             {
@@ -163,10 +230,17 @@ namespace RTT
                 switch (policy.lock_policy)
                 {
 #ifndef OROBLD_OS_NO_ASM
+                case ConnPolicy::SEQLOCK:
+                    data_object.reset( buildSeqLockDataObject<T>(policy, initial_value, boost::has_trivial_copy<T>()) );
+                    break;
+                case ConnPolicy::SPSC:
+                    // there is no dedicated SPSC data object, use the lock-free one.
                 case ConnPolicy::LOCK_FREE:
                     data_object.reset( new base::DataObjectLockFree<T>(initial_value, policy) );
                     break;
 #else
+                case ConnPolicy::SEQLOCK:
+                case ConnPolicy::SPSC:
                 case ConnPolicy::LOCK_FREE:
                     RTT::log(Warning) << "lock free connection policy is unavailable on this system, defaulting to LOCKED" << RTT::endlog();
 #endif
@@ -185,10 +259,20 @@ namespace RTT
                 switch (policy.lock_policy)
                 {
 #ifndef OROBLD_OS_NO_ASM
+                case ConnPolicy::SPSC:
+                    if (isSingleProducerSingleConsumer(policy)) {
+                        buffer_object.reset(new base::BufferSPSC<T>(policy.size, initial_value, policy));
+                        break;
+                    }
+                    RTT::log(Debug) << "connection " << policy << " has no 1:1 topology, using a LOCK_FREE buffer instead of SPSC" << RTT::endlog();
+                case ConnPolicy::SEQLOCK:
+                    // there is no sequence lock based buffer, use the lock-free one.
                 case ConnPolicy::LOCK_FREE:
                     buffer_object.reset(new base::BufferLockFree<T>(policy.size, initial_value, policy));
                     break;
 #else
+                case ConnPolicy::SEQLOCK:
+                case ConnPolicy::SPSC:
                 case ConnPolicy::LOCK_FREE:
                     RTT::log(Warning) << "lock free connection policy is unavailable on this system, defaulting to LOCKED" << RTT::endlog();
 #endif
@@ -0,0 +1,205 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ConnectionStatistics.hpp"
+#include "../os/CAS.hpp"
+#include <ostream>
+
+#if defined(OROBLD_OS_NO_ASM)
+#include "../os/Mutex.hpp"
+#include "../os/MutexLock.hpp"
+#endif
+
+namespace RTT
+{ namespace internal {
+
+    namespace {
+#if defined(OROBLD_OS_NO_ASM)
+        // without atomic instructions, compare and swap is emulated with one lock.
+        os::Mutex cas_lock;
+
+        bool CAS(oro_atomic_t* value, int expected, int desired)
+        {
+            os::MutexLock locker(cas_lock);
+            if (oro_atomic_read(value) != expected)
+                return false;
+            oro_atomic_set(value, desired);
+            return true;
+        }
+#else
+        using os::CAS;
+#endif
+
+        /** Raises \a value to at least \a candidate. */
+        void storeMaximum(oro_atomic_t* value, int candidate)
+        {
+            int current;
+            do {
+                current = oro_atomic_read(value);
+                if (current >= candidate)
+                    return;
+            } while (!CAS(value, current, candidate));
+        }
+    }
+
+    ConnectionStatistics::ConnectionStatistics(ConnPolicy const& policy)
+        : policy(policy), capacity(policy.type == ConnPolicy::DATA ? 1 : policy.size)
+    {
+        ORO_ATOMIC_SETUP(&writes, 0);
+        ORO_ATOMIC_SETUP(&reads, 0);
+        ORO_ATOMIC_SETUP(&drops, 0);
+        ORO_ATOMIC_SETUP(&not_connected, 0);
+        ORO_ATOMIC_SETUP(&fill_level, 0);
+        ORO_ATOMIC_SETUP(&high_watermark, 0);
+        ORO_ATOMIC_SETUP(&max_latency, 0);
+        for (unsigned int i = 0; i < LatencyBuckets; ++i)
+            ORO_ATOMIC_SETUP(&latency_histogram[i], 0);
+        reset();
+    }
+
+    ConnectionStatistics::~ConnectionStatistics()
+    {
+        ORO_ATOMIC_CLEANUP(&writes);
+        ORO_ATOMIC_CLEANUP(&reads);
+        ORO_ATOMIC_CLEANUP(&drops);
+        ORO_ATOMIC_CLEANUP(&not_connected);
+        ORO_ATOMIC_CLEANUP(&fill_level);
+        ORO_ATOMIC_CLEANUP(&high_watermark);
+        ORO_ATOMIC_CLEANUP(&max_latency);
+        for (unsigned int i = 0; i < LatencyBuckets; ++i)
+            ORO_ATOMIC_CLEANUP(&latency_histogram[i]);
+    }
+
+    void ConnectionStatistics::writeDone(WriteStatus status)
+    {
+        oro_atomic_inc(&writes);
+        if (status == WriteFailure) {
+            oro_atomic_inc(&drops);
+            return;
+        }
+        if (status == NotConnected)
+            oro_atomic_inc(&not_connected);
+
+        // The sample has been stored, update the fill level up to the capacity.
+        int fill;
+        do {
+            fill = oro_atomic_read(&fill_level);
+            if (fill >= capacity) {
+                // a data object overwrites, a circular buffer drops its oldest sample.
+                if (policy.type == ConnPolicy::CIRCULAR_BUFFER)
+                    oro_atomic_inc(&drops);
+                return;
+            }
+        } while (!CAS(&fill_level, fill, fill + 1));
+        storeMaximum(&high_watermark, fill + 1);
+    }
+
+    void ConnectionStatistics::readDone(FlowStatus status, os::TimeService::nsecs latency)
+    {
+        if (status != NewData)
+            return;
+        oro_atomic_inc(&reads);
+
+        int fill;
+        do {
+            fill = oro_atomic_read(&fill_level);
+            if (fill <= 0)
+                break;
+        } while (!CAS(&fill_level, fill, fill - 1));
+
+        if (latency <= 0)
+            return;
+        os::TimeService::nsecs usecs = latency / 1000;
+        unsigned int bucket = 0;
+        while (bucket < LatencyBuckets - 1 && usecs >= (os::TimeService::nsecs(1) << bucket))
+            ++bucket;
+        oro_atomic_inc(&latency_histogram[bucket]);
+        storeMaximum(&max_latency, usecs > 0x7fffffff ? 0x7fffffff : int(usecs));
+    }
+
+    void ConnectionStatistics::reset()
+    {
+        start = os::TimeService::Instance()->getTicks();
+        oro_atomic_set(&writes, 0);
+        oro_atomic_set(&reads, 0);
+        oro_atomic_set(&drops, 0);
+        oro_atomic_set(&not_connected, 0);
+        oro_atomic_set(&fill_level, 0);
+        oro_atomic_set(&high_watermark, 0);
+        oro_atomic_set(&max_latency, 0);
+        for (unsigned int i = 0; i < LatencyBuckets; ++i)
+            oro_atomic_set(&latency_histogram[i], 0);
+    }
+
+    int ConnectionStatistics::getWrites() const { return oro_atomic_read(&writes); }
+    int ConnectionStatistics::getReads() const { return oro_atomic_read(&reads); }
+    int ConnectionStatistics::getDrops() const { return oro_atomic_read(&drops); }
+    int ConnectionStatistics::getNotConnected() const { return oro_atomic_read(&not_connected); }
+    int ConnectionStatistics::getFillLevel() const { return oro_atomic_read(&fill_level); }
+    int ConnectionStatistics::getHighWatermark() const { return oro_atomic_read(&high_watermark); }
+    int ConnectionStatistics::getMaxLatency() const { return oro_atomic_read(&max_latency); }
+
+    int ConnectionStatistics::getLatencyCount(unsigned int bucket) const
+    {
+        if (bucket >= LatencyBuckets)
+            return 0;
+        return oro_atomic_read(&latency_histogram[bucket]);
+    }
+
+    double ConnectionStatistics::getWriteRate() const
+    {
+        Seconds elapsed = os::TimeService::Instance()->secondsSince(start);
+        return elapsed > 0 ? getWrites() / elapsed : 0.0;
+    }
+
+    double ConnectionStatistics::getReadRate() const
+    {
+        Seconds elapsed = os::TimeService::Instance()->secondsSince(start);
+        return elapsed > 0 ? getReads() / elapsed : 0.0;
+    }
+
+    std::ostream& operator<<(std::ostream& os, ConnectionStatistics const& stats)
+    {
+        os << stats.getConnPolicy() << ":" << std::endl;
+        os << "  writes: " << stats.getWrites() << " (" << stats.getWriteRate() << "/s)"
+           << ", reads: " << stats.getReads() << " (" << stats.getReadRate() << "/s)"
+           << ", drops: " << stats.getDrops()
+           << ", not connected: " << stats.getNotConnected() << std::endl;
+        os << "  fill level: " << stats.getFillLevel()
+           << ", high watermark: " << stats.getHighWatermark() << std::endl;
+        os << "  max latency: " << stats.getMaxLatency() << "us, histogram:";
+        for (unsigned int i = 0; i < ConnectionStatistics::LatencyBuckets; ++i) {
+            if (i < ConnectionStatistics::LatencyBuckets - 1)
+                os << " <" << (1 << i) << "us: ";
+            else
+                os << " >=" << (1 << (i - 1)) << "us: ";
+            os << stats.getLatencyCount(i);
+        }
+        return os << std::endl;
+    }
+}}
@@ -0,0 +1,147 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_CONNECTION_STATISTICS_HPP
+#define ORO_CONNECTION_STATISTICS_HPP
+
+#include "../ConnPolicy.hpp"
+#include "../FlowStatus.hpp"
+#include "../os/oro_arch.h"
+#include "../os/TimeService.hpp"
+#include <boost/shared_ptr.hpp>
+#include <iosfwd>
+
+namespace RTT
+{ namespace internal {
+
+    /**
+     * Counters which describe the traffic on a single connection. They are
+     * updated by a ChannelStatisticsElement, which the ConnFactory installs
+     * in front of the connection's data object or buffer if the ConnPolicy
+     * has the \ref ConnPolicy::statistics flag set.
+     *
+     * Updating and reading the counters is lock-free and real-time safe.
+     * The counters wrap around after 2^31 events.
+     */
+    class RTT_API ConnectionStatistics
+    {
+    public:
+        typedef boost::shared_ptr<ConnectionStatistics> shared_ptr;
+
+        /**
+         * The number of buckets in the latency histogram. Bucket \a i counts the
+         * samples with a latency of less than 2^i microseconds that did not fit
+         * in a lower bucket. The last bucket counts all slower samples.
+         */
+        static const unsigned int LatencyBuckets = 16;
+
+        /**
+         * Creates the statistics for a connection built for \a policy.
+         */
+        ConnectionStatistics(ConnPolicy const& policy);
+
+        ~ConnectionStatistics();
+
+        /**
+         * Records a write of a sample. The write was dropped if
+         * \a status is WriteFailure, or if \a status is not NotConnected
+         * and a circular buffer was full and had to drop its oldest sample.
+         */
+        void writeDone(WriteStatus status);
+
+        /**
+         * Records a read of a sample. If \a status is NewData, the
+         * sample was written \a latency nanoseconds ago, or 0 if the
+         * write time of the sample is unknown.
+         */
+        void readDone(FlowStatus status, os::TimeService::nsecs latency);
+
+        /**
+         * Resets all counters to zero and restarts the measurement period.
+         * This method is not real-time safe when called concurrently
+         * with writes and reads, as it may lose events.
+         */
+        void reset();
+
+        /** The connection policy of the measured connection. */
+        ConnPolicy const& getConnPolicy() const { return policy; }
+
+        /** The number of write() calls, including failed ones. */
+        int getWrites() const;
+
+        /** The number of read() calls that returned NewData. */
+        int getReads() const;
+
+        /** The number of samples that were rejected or overwritten before they were read. */
+        int getDrops() const;
+
+        /** The number of write() calls that returned NotConnected. */
+        int getNotConnected() const;
+
+        /** The number of unread samples in the connection. */
+        int getFillLevel() const;
+
+        /** The highest number of unread samples that was ever in the connection. */
+        int getHighWatermark() const;
+
+        /** The number of samples in bucket \a bucket of the latency histogram. */
+        int getLatencyCount(unsigned int bucket) const;
+
+        /** The highest latency between a write and a read of a sample, in microseconds. */
+        int getMaxLatency() const;
+
+        /** The average number of writes per second since creation or the last reset(). */
+        double getWriteRate() const;
+
+        /** The average number of reads per second since creation or the last reset(). */
+        double getReadRate() const;
+
+    private:
+        ConnPolicy policy;
+        int capacity;
+        os::TimeService::ticks start;
+        oro_atomic_t writes;
+        oro_atomic_t reads;
+        oro_atomic_t drops;
+        oro_atomic_t not_connected;
+        oro_atomic_t fill_level;
+        oro_atomic_t high_watermark;
+        oro_atomic_t max_latency;
+        oro_atomic_t latency_histogram[LatencyBuckets];
+
+        ConnectionStatistics(ConnectionStatistics const&);
+        ConnectionStatistics& operator=(ConnectionStatistics const&);
+    };
+
+    /**
+     * Writes a human readable report of \a stats.
+     */
+    RTT_API std::ostream& operator<<(std::ostream& os, ConnectionStatistics const& stats);
+}}
+
+#endif
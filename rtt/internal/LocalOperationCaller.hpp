@@ -53,6 +53,13 @@
 #include "OperationCallerBinder.hpp"
 #include <boost/fusion/include/vector_tie.hpp>
 #include "../os/oro_allocator.hpp"
+#include "../os/Atomic.hpp"
+#if defined(OROBLD_OS_NO_ASM)
+#include "../os/Mutex.hpp"
+#include "../os/MutexLock.hpp"
+#else
+#include "../os/CAS.hpp"
+#endif
 
 #include <iostream>
 // For doing I/O
@@ -704,9 +711,148 @@ namespace RTT
 
             typename LocalOperationCallerImpl<Signature>::shared_ptr cloneRT() const
             {
-                // returns identical copy of this;
+                SendPool* pool = msendpool.pool.get();
+                if ( pool ) {
+                    shared_ptr clone = pool->take();
+                    if ( clone ) {
+                        clone->recycle( *this );
+                        pool->hits.inc();
+                        return clone;
+                    }
+                    pool->misses.inc();
+                }
+                return makeClone();
+            }
+
+            bool setSendPoolSize(unsigned int size)
+            {
+                if ( size == 0 ) {
+                    msendpool.pool.reset();
+                    return true;
+                }
+                boost::shared_ptr<SendPool> pool( new SendPool( size ) );
+                for (unsigned int i = 0; i != size; ++i)
+                    pool->slots[i].clone = makeClone();
+                msendpool.pool = pool;
+                return true;
+            }
+
+            base::SendPoolStatistics getSendPoolStatistics() const
+            {
+                base::SendPoolStatistics stats;
+                SendPool* pool = msendpool.pool.get();
+                if ( !pool )
+                    return stats;
+                stats.size = pool->size;
+                stats.hits = pool->hits.read();
+                stats.misses = pool->misses.read();
+                for (unsigned int i = 0; i != pool->size; ++i)
+                    if ( pool->slots[i].clone.use_count() == 1 )
+                        ++stats.available;
+                return stats;
+            }
+
+        private:
+            /**
+             * The clones which cloneRT() hands out. The pool keeps a
+             * reference to each of them, so a clone is free again when its
+             * last SendHandle and the engines released it and the pool's
+             * reference is the only one left. Handing out a copy of that
+             * reference neither allocates a new object nor a new control
+             * block. Clones which are still in use when the pool is
+             * released are deleted by their last user.
+             */
+            struct SendPool
+            {
+                struct Slot
+                {
+                    Slot() : clone(), claimed(0) {}
+                    shared_ptr clone;
+                    volatile int claimed;
+                };
+
+                SendPool(unsigned int size) : slots(new Slot[size]), size(size), next(0) {}
+
+                ~SendPool() { delete[] slots; }
+
+                /**
+                 * Returns a free clone, or null if all are in use. The
+                 * claim keeps two senders from taking the same clone;
+                 * once a sender holds the second reference, the clone is
+                 * no longer free for the others and the claim is dropped.
+                 */
+                shared_ptr take()
+                {
+                    unsigned int start = next;
+                    for (unsigned int i = 0; i != size; ++i) {
+                        Slot& slot = slots[(start + i) % size];
+#if defined(OROBLD_OS_NO_ASM)
+                        os::MutexLock lock(mlock);
+                        if ( slot.clone.use_count() != 1 )
+                            continue;
+                        shared_ptr clone = slot.clone;
+#else
+                        if ( slot.clone.use_count() != 1 || !os::CAS(&slot.claimed, 0, 1) )
+                            continue;
+                        shared_ptr clone;
+                        if ( slot.clone.use_count() == 1 )
+                            clone = slot.clone;
+                        slot.claimed = 0;
+#endif
+                        if ( clone ) {
+                            next = (start + i + 1) % size;
+                            return clone;
+                        }
+                    }
+                    return shared_ptr();
+                }
+
+                Slot* slots;
+                unsigned int size;
+                /** Where take() starts looking, only a hint. */
+                volatile unsigned int next;
+#if defined(OROBLD_OS_NO_ASM)
+                /** Replaces the claims on targets without compare-and-swap. */
+                os::Mutex mlock;
+#endif
+                os::AtomicInt hits, misses;
+            };
+
+            /**
+             * Holds the pool of this caller. Copies of a caller start
+             * without a pool, so copying a caller never touches the
+             * reference count of the pool.
+             */
+            struct SendPoolRef
+            {
+                SendPoolRef() {}
+                SendPoolRef(SendPoolRef const&) {}
+                SendPoolRef& operator=(SendPoolRef const&) { return *this; }
+
+                boost::shared_ptr<SendPool> pool;
+            };
+
+            shared_ptr makeClone() const
+            {
+                // returns identical copy of this, SendPoolRef does not copy the pool.
                 return boost::allocate_shared<LocalOperationCaller<Signature> >(os::rt_allocator<LocalOperationCaller<Signature> >(), *this);
             }
+
+            /**
+             * Prepares a pooled clone for a new send of \a orig. The
+             * function and the storage are kept, store() overwrites the
+             * arguments and the return value is marked as not executed.
+             */
+            void recycle(LocalOperationCaller const& orig)
+            {
+                this->myengine = orig.myengine;
+                this->caller = orig.caller;
+                this->met = orig.met;
+                this->retv.executed = false;
+                this->retv.error = false;
+            }
+
+            SendPoolRef msendpool;
         };
     }
 }
@@ -0,0 +1,87 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "SegmentedMWSRQueue.hpp"
+#include "../os/fosi_internal_interface.hpp"
+#include <ostream>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace RTT
+{ namespace internal {
+
+    bool placeOnNumaNode(void* addr, std::size_t size, int node)
+    {
+        return os::rtos_numa_bind_memory(addr, size, node) == 0;
+    }
+
+    SegmentPages::SegmentPages(std::size_t size)
+        : mmemory(0)
+    {
+#ifdef _WIN32
+        mmemory = _aligned_malloc(size, 4096);
+#else
+        if ( posix_memalign(&mmemory, sysconf(_SC_PAGESIZE), size) != 0 )
+            mmemory = 0;
+#endif
+        if ( mmemory == 0 )
+            throw std::bad_alloc();
+    }
+
+    SegmentPages::~SegmentPages()
+    {
+#ifdef _WIN32
+        _aligned_free(mmemory);
+#else
+        free(mmemory);
+#endif
+    }
+
+    std::ostream& operator<<(std::ostream& os, QueueStatistics const& stats)
+    {
+        os << "size: " << stats.size << "/";
+        if (stats.capacity)
+            os << stats.capacity;
+        else
+            os << "unbounded";
+        os << ", max size: " << stats.max_size
+           << ", enqueue failures: " << stats.enqueue_failures
+           << ", segments: " << stats.segments
+           << ", spares: " << stats.spares
+           << ", dequeued: " << stats.dequeued
+           << ", queued time max: " << stats.max_queued_time / 1000 << "us"
+           << " avg: " << (stats.dequeued ? stats.total_queued_time / stats.dequeued / 1000 : 0) << "us";
+        return os;
+    }
+}}
@@ -0,0 +1,680 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef ORO_SEGMENTED_MWSR_QUEUE_HPP
+#define ORO_SEGMENTED_MWSR_QUEUE_HPP
+
+#include "../rtt-config.h"
+#include "../os/oro_arch.h"
+#include "../os/TimeService.hpp"
+#include <iosfwd>
+#include <cstddef>
+#include <new>
+
+#if defined(OROBLD_OS_NO_ASM)
+#include "../os/Mutex.hpp"
+#include "../os/MutexLock.hpp"
+#else
+#include "../os/CAS.hpp"
+#include "TsPool.hpp"
+#endif
+
+namespace RTT
+{
+    namespace internal
+    {
+        /**
+         * A snapshot of the fill level and the backpressure counters of a
+         * SegmentedMWSRQueue.
+         */
+        struct RTT_API QueueStatistics
+        {
+            QueueStatistics()
+                : capacity(0), size(0), max_size(0), enqueue_failures(0), segments(0),
+                  spares(0), dequeued(0), max_queued_time(0), total_queued_time(0) {}
+
+            /** The maximum number of items, or 0 if the queue is unbounded. */
+            unsigned int capacity;
+            /** The number of items in the queue. */
+            unsigned int size;
+            /** The highest number of items that was ever in the queue. */
+            unsigned int max_size;
+            /** The number of enqueue() calls that failed because the queue was full. */
+            unsigned int enqueue_failures;
+            /** The number of segments of items which were allocated. */
+            unsigned int segments;
+            /** The number of preallocated segments an unbounded queue can still take over. */
+            unsigned int spares;
+            /** The number of items that were dequeued. */
+            unsigned int dequeued;
+            /** The longest time an item spent in the queue. */
+            os::TimeService::nsecs max_queued_time;
+            /** The sum of the times all dequeued items spent in the queue. */
+            os::TimeService::nsecs total_queued_time;
+        };
+
+        /**
+         * Writes a human readable report of \a stats.
+         */
+        RTT_API std::ostream& operator<<(std::ostream& os, QueueStatistics const& stats);
+
+        /**
+         * Prefers the memory of NUMA node \a node for the pages which hold
+         * \a size bytes at \a addr.
+         * @return false if the memory could not be placed.
+         * @see SegmentedMWSRQueue::setNumaNode()
+         */
+        RTT_API bool placeOnNumaNode(void* addr, std::size_t size, int node);
+
+        /**
+         * Page aligned memory for the nodes of a segment, such that
+         * placeOnNumaNode() moves no other data along with them.
+         */
+        class RTT_API SegmentPages
+        {
+        public:
+            explicit SegmentPages(std::size_t size);
+            ~SegmentPages();
+
+            void* memory() const { return mmemory; }
+        private:
+            void* mmemory;
+
+            // non-copyable !
+            SegmentPages(const SegmentPages&);
+            SegmentPages& operator=(const SegmentPages&);
+        };
+
+        /**
+         * A Multi-Writer Single-Reader FIFO for storing a pointer \a T by value,
+         * which can be resized while it is in use.
+         *
+         * The items are kept in nodes which are taken from segments of
+         * pre-allocated nodes. The capacity of a bounded queue can be
+         * raised or lowered at any time, in which case additional segments
+         * are allocated by setCapacity(). An unbounded queue keeps a list of
+         * preallocated spare segments, and an enqueue() that finds all nodes
+         * in use takes over one of them. Neither enqueue() nor dequeue()
+         * allocate: if the writers use up the spare segments, enqueue()
+         * fails like it does on a full queue until setCapacity() or
+         * reserveSpares() is called from a thread which may allocate.
+         * Segments are only released when the queue is destroyed.
+         *
+         * Writers push their node with a single compare-and-swap on a stack.
+         * The reader takes the whole stack at once and reverses it, which
+         * keeps the items in the order in which they were enqueued.
+         * Every node records the time it was enqueued, such that the time
+         * items spend in the queue can be reported in QueueStatistics.
+         *
+         * @warning You can not store null pointers.
+         * @param T The pointer type to be stored in the Queue.
+         * @ingroup CoreLibBuffers
+         */
+        template<class T>
+        class SegmentedMWSRQueue
+        {
+        public:
+            typedef unsigned int size_type;
+
+            /**
+             * The largest number of nodes in a single segment.
+             */
+            static const size_type MaxSegmentSize = 65534;
+
+        private:
+            struct Segment;
+
+            struct Node
+            {
+                T value;
+                Node* next;
+                Segment* segment;
+                os::TimeService::ticks stamp;
+
+                Node() : value(), next(0), segment(0), stamp(0) {}
+            };
+
+            struct Segment
+            {
+                SegmentPages pages;
+#if defined(OROBLD_OS_NO_ASM)
+                Node* nodes;
+                Node* free;
+
+                Segment(size_type size)
+                    : pages(size * sizeof(Node)), nodes(static_cast<Node*>(pages.memory())), free(0), size(size), next(0)
+                {
+                    for (size_type i = 0; i != size; ++i) {
+                        new (&nodes[i]) Node();
+                        nodes[i].next = free;
+                        free = &nodes[i];
+                    }
+                }
+                ~Segment()
+                {
+                    for (size_type i = 0; i != size; ++i)
+                        nodes[i].~Node();
+                }
+
+                Node* allocate()
+                {
+                    Node* node = free;
+                    if (node) free = node->next;
+                    return node;
+                }
+                void deallocate(Node* node)
+                {
+                    node->next = free;
+                    free = node;
+                }
+                void* storage() { return nodes; }
+                std::size_t storageSize() const { return size * sizeof(Node); }
+
+                size_type size;
+#else
+                TsPool<Node> pool;
+
+                Segment(size_type size)
+                    : pages(TsPool<Node>::requiredStorage(size)), pool(size, pages.memory()), size(size), next(0) {}
+
+                Node* allocate() { return pool.allocate(); }
+                void deallocate(Node* node) { pool.deallocate(node); }
+                void* storage() { return pool.storage(); }
+                std::size_t storageSize() const { return pool.storageSize(); }
+
+                size_type size;
+#endif
+                Segment* next;
+            };
+
+            /** The segments of nodes, only ever prepended to. */
+            Segment* volatile msegments;
+            /** The segments an unbounded queue adds when it runs out of nodes, linked by Segment::next. */
+            Segment* volatile mspares;
+            /** The last enqueued node, linked to the previously enqueued ones. */
+            Node* volatile mstack;
+            /** The nodes taken from mstack, in enqueue order. Only used by the reader. */
+            Node* mpending;
+
+            const size_type msegment_size;
+            oro_atomic_t mcapacity;
+            oro_atomic_t mallocated;
+            oro_atomic_t msize;
+            oro_atomic_t mmax_size;
+            oro_atomic_t mfailures;
+            oro_atomic_t mnsegments;
+            oro_atomic_t mnspares;
+            /** The number of spare segments setCapacity() preallocates. */
+            size_type mreserved_spares;
+            /** The NUMA node on which segments are placed, or -1. */
+            volatile int mnuma_node;
+
+            // only modified by the reader
+            size_type mdequeued;
+            os::TimeService::nsecs mmax_queued_time;
+            os::TimeService::nsecs mtotal_queued_time;
+
+#if defined(OROBLD_OS_NO_ASM)
+            mutable os::Mutex lock;
+#endif
+
+            // non-copyable !
+            SegmentedMWSRQueue(const SegmentedMWSRQueue<T>&);
+            SegmentedMWSRQueue& operator=(const SegmentedMWSRQueue<T>&);
+
+            /**
+             * Allocates a segment of \a size nodes, placed on the NUMA node.
+             */
+            Segment* newSegment(size_type size)
+            {
+                if (size > MaxSegmentSize)
+                    size = MaxSegmentSize;
+                Segment* segment = new Segment(size);
+                if (mnuma_node >= 0)
+                    placeOnNumaNode(segment->storage(), segment->storageSize(), mnuma_node);
+                return segment;
+            }
+
+            /**
+             * Prepends a new segment of \a size nodes, placed on the NUMA node.
+             */
+            Segment* addSegment(size_type size)
+            {
+                return linkSegment(newSegment(size));
+            }
+
+            Segment* linkSegment(Segment* segment)
+            {
+#if defined(OROBLD_OS_NO_ASM)
+                segment->next = msegments;
+                msegments = segment;
+#else
+                Segment* head;
+                do {
+                    head = msegments;
+                    segment->next = head;
+                } while (!os::CAS(&msegments, head, segment));
+#endif
+                oro_atomic_add(&mallocated, segment->size);
+                oro_atomic_inc(&mnsegments);
+                return segment;
+            }
+
+            /**
+             * Allocates spare segments until an unbounded queue has
+             * mreserved_spares of them. Not real-time.
+             */
+            void refillSpares()
+            {
+                if (oro_atomic_read(&mcapacity) != 0)
+                    return;
+                while (size_type(oro_atomic_read(&mnspares)) < mreserved_spares) {
+                    Segment* spare = newSegment(msegment_size);
+#if defined(OROBLD_OS_NO_ASM)
+                    spare->next = mspares;
+                    mspares = spare;
+#else
+                    Segment* head;
+                    do {
+                        head = mspares;
+                        spare->next = head;
+                    } while (!os::CAS(&mspares, head, spare));
+#endif
+                    oro_atomic_inc(&mnspares);
+                }
+            }
+
+            /**
+             * Pops a spare segment. A popped segment is linked into msegments
+             * and never pushed again, so the compare-and-swap can not
+             * mistake a reused head for the one it read.
+             */
+            Segment* takeSpare()
+            {
+                Segment* spare;
+#if defined(OROBLD_OS_NO_ASM)
+                spare = mspares;
+                if (spare)
+                    mspares = spare->next;
+#else
+                do {
+                    spare = mspares;
+                } while (spare && !os::CAS(&mspares, spare, spare->next));
+#endif
+                if (spare)
+                    oro_atomic_dec(&mnspares);
+                return spare;
+            }
+
+            Node* allocate()
+            {
+                for (Segment* segment = msegments; segment; segment = segment->next) {
+                    Node* node = segment->allocate();
+                    if (node) {
+                        node->segment = segment;
+                        return node;
+                    }
+                }
+                // only an unbounded queue runs out of nodes.
+                if (oro_atomic_read(&mcapacity) != 0)
+                    return 0;
+                Segment* segment = takeSpare();
+                if (segment == 0)
+                    return 0;
+                linkSegment(segment);
+                Node* node = segment->allocate();
+                if (node)
+                    node->segment = segment;
+                return node;
+            }
+
+            /**
+             * Increments the size of the queue if it is below the capacity.
+             * @return the new size, or 0 if the queue is full.
+             */
+            int reserve()
+            {
+                int size;
+#if defined(OROBLD_OS_NO_ASM)
+                size = oro_atomic_read(&msize);
+                int cap = oro_atomic_read(&mcapacity);
+                if (cap != 0 && size >= cap)
+                    return 0;
+                oro_atomic_set(&msize, size + 1);
+#else
+                do {
+                    size = oro_atomic_read(&msize);
+                    int cap = oro_atomic_read(&mcapacity);
+                    if (cap != 0 && size >= cap)
+                        return 0;
+                } while (!os::CAS(&msize, size, size + 1));
+#endif
+                return size + 1;
+            }
+
+            void storeMaximum(oro_atomic_t* value, int candidate)
+            {
+#if defined(OROBLD_OS_NO_ASM)
+                if (oro_atomic_read(value) < candidate)
+                    oro_atomic_set(value, candidate);
+#else
+                int current;
+                do {
+                    current = oro_atomic_read(value);
+                    if (current >= candidate)
+                        return;
+                } while (!os::CAS(value, current, candidate));
+#endif
+            }
+
+        public:
+            /**
+             * Create a queue which can hold \a capacity items.
+             * @param capacity The initial capacity. If 0, the queue is unbounded.
+             * @param segment_size The number of nodes allocated at once by an
+             * unbounded queue. If 0, segments of \a capacity nodes are allocated,
+             * or of 64 nodes if the queue is unbounded.
+             */
+            SegmentedMWSRQueue(size_type capacity, size_type segment_size = 0)
+                : msegments(0), mspares(0), mstack(0), mpending(0),
+                  msegment_size(segment_size ? segment_size : (capacity ? capacity : 64)),
+                  mreserved_spares(1),
+                  mnuma_node(-1), mdequeued(0), mmax_queued_time(0), mtotal_queued_time(0)
+            {
+                ORO_ATOMIC_SETUP(&mcapacity, capacity);
+                ORO_ATOMIC_SETUP(&mallocated, 0);
+                ORO_ATOMIC_SETUP(&msize, 0);
+                ORO_ATOMIC_SETUP(&mmax_size, 0);
+                ORO_ATOMIC_SETUP(&mfailures, 0);
+                ORO_ATOMIC_SETUP(&mnsegments, 0);
+                ORO_ATOMIC_SETUP(&mnspares, 0);
+                setCapacity(capacity ? capacity : msegment_size);
+                oro_atomic_set(&mcapacity, capacity);
+                refillSpares();
+            }
+
+            ~SegmentedMWSRQueue()
+            {
+                T item;
+                while (dequeue(item)) {}
+                while (msegments) {
+                    Segment* segment = msegments;
+                    msegments = segment->next;
+                    delete segment;
+                }
+                while (mspares) {
+                    Segment* segment = mspares;
+                    mspares = segment->next;
+                    delete segment;
+                }
+                ORO_ATOMIC_CLEANUP(&mcapacity);
+                ORO_ATOMIC_CLEANUP(&mallocated);
+                ORO_ATOMIC_CLEANUP(&msize);
+                ORO_ATOMIC_CLEANUP(&mmax_size);
+                ORO_ATOMIC_CLEANUP(&mfailures);
+                ORO_ATOMIC_CLEANUP(&mnsegments);
+                ORO_ATOMIC_CLEANUP(&mnspares);
+            }
+
+            /**
+             * Changes the maximum number of items in this queue. If the queue
+             * holds more items than the new capacity, no items are lost but
+             * further enqueue()s fail until the reader has caught up.
+             * This function allocates if the capacity is raised or if the
+             * queue becomes unbounded, and is not real-time. Calling it with 0
+             * on an unbounded queue replaces the spare segments which
+             * enqueue() took over.
+             * @param capacity The new capacity, or 0 to make the queue unbounded.
+             */
+            void setCapacity(size_type capacity)
+            {
+#if defined(OROBLD_OS_NO_ASM)
+                os::MutexLock locker(lock);
+#endif
+                size_type allocated = oro_atomic_read(&mallocated);
+                while (capacity > allocated) {
+                    addSegment(capacity - allocated);
+                    allocated = oro_atomic_read(&mallocated);
+                }
+                oro_atomic_set(&mcapacity, capacity);
+                refillSpares();
+            }
+
+            /**
+             * Sets the number of spare segments an unbounded queue keeps
+             * preallocated, and allocates the missing ones if the queue is
+             * unbounded. Surplus spares are kept. This function is not
+             * real-time.
+             * @param count The number of spare segments, 1 by default.
+             */
+            void reserveSpares(size_type count)
+            {
+#if defined(OROBLD_OS_NO_ASM)
+                os::MutexLock locker(lock);
+#endif
+                mreserved_spares = count;
+                refillSpares();
+            }
+
+            /**
+             * Places the nodes of this queue in the memory of NUMA node
+             * \a node, such that the reader finds them in its local memory
+             * when it runs on that node. Segments which setCapacity() or
+             * reserveSpares() allocate later are placed on \a node as well.
+             * Segments are page aligned, so no other data moves along.
+             * This function is not real-time.
+             * @param node The NUMA node, or -1 to stop placing new segments.
+             * @return false if a segment could not be placed.
+             */
+            bool setNumaNode(int node)
+            {
+                mnuma_node = node < 0 ? -1 : node;
+                if (mnuma_node < 0)
+                    return true;
+#if defined(OROBLD_OS_NO_ASM)
+                os::MutexLock locker(lock);
+#endif
+                bool result = true;
+                for (Segment* segment = msegments; segment; segment = segment->next)
+                    result = placeOnNumaNode(segment->storage(), segment->storageSize(), node) && result;
+                // a spare which enqueue() takes meanwhile is linked into
+                // msegments, so this walk may place segments twice.
+                for (Segment* segment = mspares; segment; segment = segment->next)
+                    result = placeOnNumaNode(segment->storage(), segment->storageSize(), node) && result;
+                return result;
+            }
+
+            /**
+             * Returns the NUMA node set with setNumaNode(), or -1.
+             */
+            int getNumaNode() const
+            {
+                return mnuma_node;
+            }
+
+            /**
+             * Return the maximum number of items this queue can contain,
+             * or 0 if the queue is unbounded.
+             */
+            size_type capacity() const
+            {
+                return oro_atomic_read(&mcapacity);
+            }
+
+            /**
+             * Return the number of elements in the queue.
+             */
+            size_type size() const
+            {
+                return oro_atomic_read(&msize);
+            }
+
+            /**
+             * Inspect if the Queue is empty.
+             * @return true if empty, false otherwise.
+             */
+            bool isEmpty() const
+            {
+                return size() == 0;
+            }
+
+            /**
+             * Inspect if the Queue is full.
+             * @return true if full, false otherwise.
+             */
+            bool isFull() const
+            {
+                size_type cap = capacity();
+                return cap != 0 && size() >= cap;
+            }
+
+            /**
+             * Enqueue an item.
+             * @param value The value to enqueue.
+             * @return false if queue is full, true if queued.
+             */
+            bool enqueue(const T& value)
+            {
+                if (value == 0)
+                    return false;
+#if defined(OROBLD_OS_NO_ASM)
+                os::MutexLock locker(lock);
+#endif
+                int size = reserve();
+                if (size == 0) {
+                    oro_atomic_inc(&mfailures);
+                    return false;
+                }
+                Node* node = allocate();
+                if (node == 0) {
+                    oro_atomic_dec(&msize);
+                    oro_atomic_inc(&mfailures);
+                    return false;
+                }
+                storeMaximum(&mmax_size, size);
+                node->value = value;
+                node->stamp = os::TimeService::Instance()->getTicks();
+#if defined(OROBLD_OS_NO_ASM)
+                node->next = mstack;
+                mstack = node;
+#else
+                Node* head;
+                do {
+                    head = mstack;
+                    node->next = head;
+                } while (!os::CAS(&mstack, head, node));
+#endif
+                return true;
+            }
+
+            /**
+             * Dequeue an item. Only one thread may call this function.
+             * @param result Stores the dequeued value. It is unchanged when
+             * dequeue returns false and contains the dequeued value
+             * when it returns true.
+             * @return false if queue is empty, true if result was written.
+             */
+            bool dequeue(T& result)
+            {
+#if defined(OROBLD_OS_NO_ASM)
+                os::MutexLock locker(lock);
+#endif
+                if (mpending == 0) {
+                    // take all enqueued nodes at once and restore their order.
+                    Node* head;
+#if defined(OROBLD_OS_NO_ASM)
+                    head = mstack;
+                    mstack = 0;
+#else
+                    do {
+                        head = mstack;
+                    } while (head && !os::CAS(&mstack, head, (Node*)0));
+#endif
+                    while (head) {
+                        Node* next = head->next;
+                        head->next = mpending;
+                        mpending = head;
+                        head = next;
+                    }
+                    if (mpending == 0)
+                        return false;
+                }
+
+                Node* node = mpending;
+                mpending = node->next;
+                result = node->value;
+
+                os::TimeService::nsecs queued = os::TimeService::ticks2nsecs(os::TimeService::Instance()->ticksSince(node->stamp));
+                ++mdequeued;
+                mtotal_queued_time += queued;
+                if (queued > mmax_queued_time)
+                    mmax_queued_time = queued;
+
+                node->value = 0;
+                node->segment->deallocate(node);
+                oro_atomic_dec(&msize);
+                return true;
+            }
+
+            /**
+             * Returns the current fill level and the counters of this queue.
+             * The queued times are only consistent if called by the reader.
+             */
+            QueueStatistics getStatistics() const
+            {
+                QueueStatistics stats;
+                stats.capacity = capacity();
+                stats.size = size();
+                stats.max_size = oro_atomic_read(&mmax_size);
+                stats.enqueue_failures = oro_atomic_read(&mfailures);
+                stats.segments = oro_atomic_read(&mnsegments);
+                stats.spares = oro_atomic_read(&mnspares);
+                stats.dequeued = mdequeued;
+                stats.max_queued_time = mmax_queued_time;
+                stats.total_queued_time = mtotal_queued_time;
+                return stats;
+            }
+
+            /**
+             * Resets the high watermark, the failure counter and the queued times.
+             * Only the reader may call this function.
+             */
+            void resetStatistics()
+            {
+                oro_atomic_set(&mmax_size, size());
+                oro_atomic_set(&mfailures, 0);
+                mdequeued = 0;
+                mmax_queued_time = 0;
+                mtotal_queued_time = 0;
+            }
+        };
+    }
+}
+
+#endif
@@ -112,6 +112,11 @@ const ConnPolicy *SharedConnectionBase::getConnPolicy() const
     return &policy;
 }
 
+base::ChannelElementBase::shared_ptr SharedConnectionBase::getStorage() const
+{
+    return base::ChannelElementBase::shared_ptr();
+}
+
 static SharedConnectionRepository::shared_ptr the_instance;
 SharedConnectionRepository::shared_ptr SharedConnectionRepository::Instance()
 {
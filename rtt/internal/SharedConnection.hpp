@@ -101,6 +101,12 @@ namespace internal {
         virtual const std::string &getName() const;
 
         virtual const ConnPolicy *getConnPolicy() const;
+
+        /**
+         * Returns the element which stores the data of this connection,
+         * or a null pointer if the data is stored in another process.
+         */
+        virtual base::ChannelElementBase::shared_ptr getStorage() const;
     };
 
     /**
@@ -214,6 +220,11 @@ namespace internal {
         {
             return mstorage->data_sample();
         }
+
+        virtual base::ChannelElementBase::shared_ptr getStorage() const
+        {
+            return mstorage;
+        }
     };
 
     template <typename T>
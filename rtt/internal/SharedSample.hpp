@@ -0,0 +1,258 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_SHARED_SAMPLE_HPP
+#define ORO_SHARED_SAMPLE_HPP
+
+#include "../os/oro_arch.h"
+#include <boost/intrusive_ptr.hpp>
+
+#if defined(OROBLD_OS_NO_ASM)
+#include "../os/Mutex.hpp"
+#include "../os/MutexLock.hpp"
+#include <vector>
+#else
+#include "TsPool.hpp"
+#endif
+
+namespace RTT
+{ namespace internal {
+
+    template<typename T> class SharedSample;
+    template<typename T> class SharedSamplePool;
+    template<typename T> void intrusive_ptr_add_ref(const SharedSample<T>* p);
+    template<typename T> void intrusive_ptr_release(const SharedSample<T>* p);
+    template<typename T> void intrusive_ptr_add_ref(SharedSamplePool<T>* p);
+    template<typename T> void intrusive_ptr_release(SharedSamplePool<T>* p);
+
+    /**
+     * A reference counted data sample, allocated from a SharedSamplePool.
+     * It is used to pass a sample from an OutputPort to one or more InputPorts
+     * without copying it. The sample returns to its pool as soon as the last
+     * reference to it is released.
+     *
+     * A sample may only be modified as long as only the writer holds a
+     * reference to it. Once it was published, it must be treated as read-only.
+     */
+    template<typename T>
+    class SharedSample
+    {
+    public:
+        typedef T value_t;
+        typedef boost::intrusive_ptr< SharedSample<T> > shared_ptr;
+        typedef boost::intrusive_ptr< const SharedSample<T> > const_ptr;
+
+        SharedSample(const T& sample = T(), SharedSamplePool<T>* pool = 0)
+            : data(sample), pool(pool)
+        {
+            ORO_ATOMIC_SETUP(&refcount, 0);
+        }
+
+        SharedSample(const SharedSample<T>& orig)
+            : data(orig.data), pool(orig.pool)
+        {
+            ORO_ATOMIC_SETUP(&refcount, 0);
+        }
+
+        ~SharedSample()
+        {
+            ORO_ATOMIC_CLEANUP(&refcount);
+        }
+
+        /**
+         * Copies the data and the owning pool, but not the reference count.
+         */
+        SharedSample<T>& operator=(const SharedSample<T>& orig)
+        {
+            data = orig.data;
+            pool = orig.pool;
+            return *this;
+        }
+
+        T& value() { return data; }
+        const T& value() const { return data; }
+
+        /**
+         * Returns true if the caller holds the only reference to this sample.
+         */
+        bool unique() const { return oro_atomic_read(&refcount) == 1; }
+
+    private:
+        friend void intrusive_ptr_add_ref<T>(const SharedSample<T>* p);
+        friend void intrusive_ptr_release<T>(const SharedSample<T>* p);
+
+        T data;
+        mutable oro_atomic_t refcount;
+        SharedSamplePool<T>* pool;
+    };
+
+    /**
+     * A fixed size, lock-free pool of SharedSample objects. Allocation and
+     * release of samples is real-time safe. Without atomic instructions
+     * (OROBLD_OS_NO_ASM), the free samples are kept in a locked list.
+     *
+     * The pool is reference counted itself, and every sample which is in use
+     * holds a reference to its pool. Hence a pool may be released by its owner
+     * while samples are still in use, for example when the owner replaces it
+     * by a bigger one.
+     */
+    template<typename T>
+    class SharedSamplePool
+    {
+#if defined(OROBLD_OS_NO_ASM)
+        std::vector< SharedSample<T> > samples;
+        std::vector< SharedSample<T>* > free_samples;
+        os::Mutex lock;
+#else
+        TsPool< SharedSample<T> > pool;
+#endif
+        oro_atomic_t refcount;
+
+        friend void intrusive_ptr_add_ref<T>(SharedSamplePool<T>* p);
+        friend void intrusive_ptr_release<T>(SharedSamplePool<T>* p);
+        friend void intrusive_ptr_release<T>(const SharedSample<T>* p);
+
+        void deallocate(SharedSample<T>* sample)
+        {
+#if defined(OROBLD_OS_NO_ASM)
+            {
+                os::MutexLock locker(lock);
+                free_samples.push_back(sample);
+            }
+#else
+            pool.deallocate(sample);
+#endif
+            intrusive_ptr_release(this);
+        }
+
+    public:
+        typedef boost::intrusive_ptr< SharedSamplePool<T> > shared_ptr;
+
+        /**
+         * Creates a pool of \a size samples, which are all initialized
+         * with \a sample.
+         */
+        SharedSamplePool(unsigned int size, const T& sample = T())
+#if defined(OROBLD_OS_NO_ASM)
+            : samples(size, SharedSample<T>(sample, this))
+        {
+            free_samples.reserve(size);
+            for (unsigned int i = 0; i != size; ++i)
+                free_samples.push_back(&samples[i]);
+#else
+            : pool(size, SharedSample<T>(sample, this))
+        {
+#endif
+            ORO_ATOMIC_SETUP(&refcount, 0);
+        }
+
+        ~SharedSamplePool()
+        {
+            ORO_ATOMIC_CLEANUP(&refcount);
+        }
+
+        /**
+         * Allocates a sample from this pool.
+         * The sample contains the value it had when it was last released,
+         * or the initial sample of the pool.
+         * @return A null pointer if all samples are in use.
+         */
+        typename SharedSample<T>::shared_ptr allocate()
+        {
+#if defined(OROBLD_OS_NO_ASM)
+            SharedSample<T>* sample = 0;
+            {
+                os::MutexLock locker(lock);
+                if (!free_samples.empty()) {
+                    sample = free_samples.back();
+                    free_samples.pop_back();
+                }
+            }
+#else
+            SharedSample<T>* sample = pool.allocate();
+#endif
+            if (!sample)
+                return typename SharedSample<T>::shared_ptr();
+            intrusive_ptr_add_ref(this);
+            return typename SharedSample<T>::shared_ptr(sample);
+        }
+
+        /**
+         * The total number of samples in this pool.
+         */
+        unsigned int capacity()
+        {
+#if defined(OROBLD_OS_NO_ASM)
+            return samples.size();
+#else
+            return pool.capacity();
+#endif
+        }
+
+        /**
+         * The number of samples that are available for allocation.
+         * This is not thread-safe.
+         */
+        unsigned int size()
+        {
+#if defined(OROBLD_OS_NO_ASM)
+            return free_samples.size();
+#else
+            return pool.size();
+#endif
+        }
+    };
+
+    template<typename T>
+    void intrusive_ptr_add_ref(const SharedSample<T>* p)
+    {
+        oro_atomic_inc(&p->refcount);
+    }
+
+    template<typename T>
+    void intrusive_ptr_release(const SharedSample<T>* p)
+    {
+        if (oro_atomic_dec_and_test(&p->refcount))
+            p->pool->deallocate(const_cast<SharedSample<T>*>(p));
+    }
+
+    template<typename T>
+    void intrusive_ptr_add_ref(SharedSamplePool<T>* p)
+    {
+        oro_atomic_inc(&p->refcount);
+    }
+
+    template<typename T>
+    void intrusive_ptr_release(SharedSamplePool<T>* p)
+    {
+        if (oro_atomic_dec_and_test(&p->refcount))
+            delete p;
+    }
+}}
+
+#endif
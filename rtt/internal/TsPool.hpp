@@ -48,6 +48,8 @@
 
 #include "../os/CAS.hpp"
 #include <assert.h>
+#include <cstddef>
+#include <new>
 
 namespace RTT
 {
@@ -95,6 +97,7 @@ namespace RTT
             Item head;
 
             unsigned int pool_size, pool_capacity;
+            bool owns_pool;
         public:
 
             typedef unsigned int size_type;
@@ -103,12 +106,34 @@ namespace RTT
              * blocks of memory that can hold an object of class \a T.
              */
             TsPool(unsigned int ssize, const T& sample = T()) :
-                pool_size(0), pool_capacity(ssize)
+                pool_size(0), pool_capacity(ssize), owns_pool(true)
             {
                 pool = new Item[ssize];
                 data_sample( sample );
             }
 
+            /**
+             * Creates a pool of \a ssize blocks in \a storage, which
+             * holds requiredStorage(\a ssize) bytes, is aligned for \a T
+             * and outlives the pool.
+             */
+            TsPool(unsigned int ssize, void* storage, const T& sample = T()) :
+                pool_size(0), pool_capacity(ssize), owns_pool(false)
+            {
+                pool = static_cast<Item*>(storage);
+                for (unsigned int i = 0; i < ssize; i++)
+                    new (&pool[i]) Item();
+                data_sample( sample );
+            }
+
+            /**
+             * The number of bytes of storage a pool of \a ssize blocks needs.
+             */
+            static std::size_t requiredStorage(unsigned int ssize)
+            {
+                return ssize * sizeof(Item);
+            }
+
             ~TsPool()
             {
 #ifndef NDEBUG
@@ -124,7 +149,12 @@ namespace RTT
                 assert( endseen == 1);
                 assert( size() == pool_capacity && "TsPool: not all pieces were deallocated !" );
 #endif
-                delete[] pool;
+                if ( owns_pool ) {
+                    delete[] pool;
+                    return;
+                }
+                for (unsigned int i = 0; i < pool_capacity; i++)
+                    pool[i].~Item();
             }
 
             /**
@@ -224,6 +254,23 @@ namespace RTT
                 return pool_capacity;
             }
 
+            /**
+             * The memory which holds the elements, for placing it
+             * on a NUMA node.
+             */
+            void* storage()
+            {
+                return pool;
+            }
+
+            /**
+             * The size in bytes of storage().
+             */
+            std::size_t storageSize() const
+            {
+                return pool_capacity * sizeof(Item);
+            }
+
         private:
 
         };
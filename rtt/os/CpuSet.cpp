@@ -0,0 +1,177 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "CpuSet.hpp"
+#include <cstdlib>
+#include <sstream>
+
+namespace RTT {
+    namespace os {
+
+        CpuSet::CpuSet()
+        {
+            this->clear();
+        }
+
+        CpuSet::CpuSet(unsigned mask)
+        {
+            this->clear();
+            for (unsigned int i = 0; i != 8 * sizeof(mask); ++i)
+                if ( mask & (1u << i) )
+                    this->set(i);
+        }
+
+        bool CpuSet::set(unsigned int cpu)
+        {
+            if ( cpu >= MaxCpus )
+                return false;
+            mbits[cpu / BitsPerWord] |= 1ul << (cpu % BitsPerWord);
+            return true;
+        }
+
+        void CpuSet::reset(unsigned int cpu)
+        {
+            if ( cpu < MaxCpus )
+                mbits[cpu / BitsPerWord] &= ~(1ul << (cpu % BitsPerWord));
+        }
+
+        void CpuSet::clear()
+        {
+            for (unsigned int i = 0; i != MaxCpus / BitsPerWord; ++i)
+                mbits[i] = 0;
+        }
+
+        bool CpuSet::test(unsigned int cpu) const
+        {
+            return cpu < MaxCpus && (mbits[cpu / BitsPerWord] & (1ul << (cpu % BitsPerWord)));
+        }
+
+        unsigned int CpuSet::count() const
+        {
+            unsigned int n = 0;
+            for (unsigned int i = 0; i != MaxCpus; ++i)
+                if ( this->test(i) )
+                    ++n;
+            return n;
+        }
+
+        bool CpuSet::none() const
+        {
+            for (unsigned int i = 0; i != MaxCpus / BitsPerWord; ++i)
+                if ( mbits[i] )
+                    return false;
+            return true;
+        }
+
+        bool CpuSet::fitsMask() const
+        {
+            for (unsigned int i = 8 * sizeof(unsigned); i != MaxCpus; ++i)
+                if ( this->test(i) )
+                    return false;
+            return true;
+        }
+
+        unsigned CpuSet::toMask() const
+        {
+            unsigned mask = 0;
+            for (unsigned int i = 0; i != 8 * sizeof(mask); ++i)
+                if ( this->test(i) )
+                    mask |= 1u << i;
+            return mask;
+        }
+
+        bool CpuSet::fromString(const std::string& list)
+        {
+            CpuSet result;
+            const char* p = list.c_str();
+            while ( *p == ' ' || *p == '\t' )
+                ++p;
+            while ( *p != '\0' && *p != '\n' ) {
+                char* end;
+                unsigned long first = std::strtoul(p, &end, 10);
+                if ( end == p )
+                    return false;
+                unsigned long last = first;
+                p = end;
+                if ( *p == '-' ) {
+                    ++p;
+                    last = std::strtoul(p, &end, 10);
+                    if ( end == p || last < first )
+                        return false;
+                    p = end;
+                }
+                if ( last >= MaxCpus )
+                    return false;
+                for (unsigned long cpu = first; cpu <= last; ++cpu)
+                    result.set(cpu);
+                if ( *p == ',' )
+                    ++p;
+                else if ( *p != '\0' && *p != '\n' )
+                    return false;
+            }
+            *this = result;
+            return true;
+        }
+
+        std::string CpuSet::toString() const
+        {
+            std::ostringstream os;
+            const char* separator = "";
+            unsigned int cpu = 0;
+            while ( cpu != MaxCpus ) {
+                if ( !this->test(cpu) ) {
+                    ++cpu;
+                    continue;
+                }
+                unsigned int last = cpu;
+                while ( last + 1 != MaxCpus && this->test(last + 1) )
+                    ++last;
+                os << separator << cpu;
+                separator = ",";
+                if ( last != cpu )
+                    os << '-' << last;
+                cpu = last + 1;
+            }
+            return os.str();
+        }
+
+        bool CpuSet::operator==(const CpuSet& other) const
+        {
+            for (unsigned int i = 0; i != MaxCpus / BitsPerWord; ++i)
+                if ( mbits[i] != other.mbits[i] )
+                    return false;
+            return true;
+        }
+
+        std::ostream& operator<<(std::ostream& os, const CpuSet& cpus)
+        {
+            return os << cpus.toString();
+        }
+    }
+}
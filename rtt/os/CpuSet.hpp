@@ -0,0 +1,133 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_OS_CPU_SET_HPP
+#define ORO_OS_CPU_SET_HPP
+
+#include <string>
+#include <ostream>
+#include "../rtt-config.h"
+
+namespace RTT
+{ namespace os {
+
+    /**
+     * A set of CPUs to which a thread may be bound, which is not limited
+     * to the 32 CPUs of the \a unsigned cpu affinity masks.
+     *
+     * The bits are kept in the layout of the Linux \a cpu_set_t. An empty
+     * set means 'all CPUs', just like an affinity mask of zero.
+     *
+     * @see ThreadInterface::setCpuSet()
+     */
+    class RTT_API CpuSet
+    {
+    public:
+        /**
+         * The number of CPUs which can be stored.
+         */
+        static const unsigned int MaxCpus = 1024;
+
+        /**
+         * Creates an empty set.
+         */
+        CpuSet();
+
+        /**
+         * Creates a set from a cpu affinity mask, in which bit i
+         * is CPU i.
+         */
+        explicit CpuSet(unsigned mask);
+
+        /**
+         * Adds \a cpu to this set.
+         * @return false if \a cpu is not below MaxCpus.
+         */
+        bool set(unsigned int cpu);
+
+        /**
+         * Removes \a cpu from this set.
+         */
+        void reset(unsigned int cpu);
+
+        /**
+         * Removes all CPUs from this set.
+         */
+        void clear();
+
+        /**
+         * @return true if \a cpu is in this set.
+         */
+        bool test(unsigned int cpu) const;
+
+        /**
+         * @return the number of CPUs in this set.
+         */
+        unsigned int count() const;
+
+        /**
+         * @return true if this set is empty.
+         */
+        bool none() const;
+
+        /**
+         * @return true if this set can be expressed as a cpu affinity
+         * mask, which is when it holds no CPU above 31.
+         */
+        bool fitsMask() const;
+
+        /**
+         * @return the CPUs below 32 as a cpu affinity mask.
+         */
+        unsigned toMask() const;
+
+        /**
+         * Reads a list of CPUs in the format of the Linux sysfs and
+         * \a taskset, for example "0-3,8,10-11".
+         * @return false if \a list could not be parsed, in which case
+         * this set is left unchanged.
+         */
+        bool fromString(const std::string& list);
+
+        /**
+         * Writes this set in the format read by fromString().
+         */
+        std::string toString() const;
+
+        bool operator==(const CpuSet& other) const;
+        bool operator!=(const CpuSet& other) const { return !(*this == other); }
+
+    private:
+        static const unsigned int BitsPerWord = 8 * sizeof(unsigned long);
+        unsigned long mbits[MaxCpus / BitsPerWord];
+    };
+
+    RTT_API std::ostream& operator<<(std::ostream& os, const CpuSet& cpus);
+}}
+
+#endif
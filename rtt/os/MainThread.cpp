@@ -116,6 +116,13 @@ namespace RTT
         return rtos_task_get_cpu_affinity(&main_task);
     }
 
+    CpuSet MainThread::getCpuSet() const
+    {
+        CpuSet cpus;
+        rtos_task_get_cpu_set(&main_task, cpus);
+        return cpus;
+    }
+
     bool MainThread::setPeriod(Seconds period)
     {
         return false;
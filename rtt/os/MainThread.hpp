@@ -130,6 +130,8 @@ namespace RTT
 
         virtual unsigned getCpuAffinity() const;
 
+        virtual CpuSet getCpuSet() const;
+
         virtual void setMaxOverrun(int m);
 
         virtual int getMaxOverrun() const;
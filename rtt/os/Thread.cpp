@@ -135,8 +135,12 @@ namespace RTT {
                             if (task->period != 0) // periodic
                             {
                                 MutexLock lock(task->breaker);
+                                // the time at which the next step() should start, if known.
+                                nsecs wake_mark = 0;
                                 while(task->running && !task->prepareForExit )
                                 {
+                                    bool measure = task->mstats_enabled;
+                                    nsecs wake_time = measure ? rtos_get_time_ns() : 0;
                                     TRY
                                     (
                                         SCOPE_ON
@@ -148,12 +152,14 @@ namespace RTT {
                                         SCOPE_OFF
                                         throw;
                                     )
+                                    nsecs step_duration = measure ? rtos_get_time_ns() - wake_time : 0;
 
                                     // Check changes in period
                                     if ( cur_period != task->period) {
                                         // reconfigure period before going to sleep
                                         rtos_task_set_period(task->getTask(), task->period);
                                         cur_period = task->period;
+                                        wake_mark = 0;
                                         if (cur_period == 0)
                                             break; // break while(task->running) if no longer periodic
                                     }
@@ -166,7 +172,20 @@ namespace RTT {
                                     // rtos_task_wait_period will return immediately if
                                     // the task is not periodic (ie period == 0)
                                     // return non-zero to indicate overrun.
-                                    if (rtos_task_wait_period(task->getTask()) != 0)
+                                    bool overrun = rtos_task_wait_period(task->getTask()) != 0;
+
+                                    if (measure) {
+                                        // the first cycle after enabling the statistics or changing the
+                                        // period has no wake-up time to measure its latency against.
+                                        if (wake_mark != 0)
+                                            task->updateStatistics(wake_time > wake_mark ? wake_time - wake_mark : 0, step_duration, overrun);
+                                        // the absolute policy keeps the period mark, the relative one
+                                        // restarts it from the last wake-up.
+                                        wake_mark = (task->mwait_policy == ORO_WAIT_REL || wake_mark == 0 ? wake_time : wake_mark) + cur_period;
+                                    } else
+                                        wake_mark = 0;
+
+                                    if (overrun)
                                     {
                                         ++overruns;
                                         if (overruns == task->maxOverRun)
@@ -244,14 +263,15 @@ namespace RTT {
 
         Thread::Thread(int scheduler, int _priority,
                 Seconds periods, unsigned cpu_affinity, const std::string & name) :
-                    msched_type(scheduler), active(false), prepareForExit(false),
+                    msched_type(scheduler), mnuma_node(-1), active(false), prepareForExit(false),
                     inloop(false),running(false),
                     maxOverRun(OROSEM_OS_PERIODIC_THREADS_MAX_OVERRUN),
                     period(Seconds_to_nsecs(periods)) // Do not call setPeriod(), since the semaphores are not yet used !
 #ifdef OROPKG_OS_THREAD_SCOPE
         ,d(NULL)
 #endif
-                    , stopTimeout(0)
+                    , stopTimeout(0), mwait_policy(ORO_WAIT_ABS),
+                    mstats_enabled(false), mstats_reset(false)
         {
             this->setup(_priority, cpu_affinity, name);
         }
@@ -615,6 +635,31 @@ namespace RTT {
             return rtos_task_get_cpu_affinity(&rtos_task);
         }
 
+        bool Thread::setCpuSet(const CpuSet& cpus)
+        {
+            return rtos_task_set_cpu_set(&rtos_task, cpus) == 0;
+        }
+
+        CpuSet Thread::getCpuSet() const
+        {
+            CpuSet cpus;
+            rtos_task_get_cpu_set(&rtos_task, cpus);
+            return cpus;
+        }
+
+        bool Thread::setNumaNode(int node)
+        {
+            if ( rtos_task_set_numa_node(&rtos_task, node) != 0 )
+                return false;
+            mnuma_node = node < 0 ? -1 : node;
+            return true;
+        }
+
+        int Thread::getNumaNode() const
+        {
+            return mnuma_node;
+        }
+
         unsigned int Thread::getPid() const
         {
         	return rtos_task_get_pid(&rtos_task);
@@ -659,9 +704,56 @@ namespace RTT {
 
         void Thread::setWaitPeriodPolicy(int p)
         {
+            mwait_policy = p;
             rtos_task_set_wait_period_policy(&rtos_task, p);  
         }
 
+        bool Thread::setStatisticsEnabled(bool enable)
+        {
+            mstats_enabled = enable;
+            return true;
+        }
+
+        bool Thread::isStatisticsEnabled() const
+        {
+            return mstats_enabled;
+        }
+
+        bool Thread::getStatistics(ThreadStatistics& stats) const
+        {
+            if ( mstats_reset ) {
+                stats.reset();
+                return true;
+            }
+            int seq;
+            do {
+                while ( (seq = mstats_seq.read()) & 1 )
+                    rtos_task_yield( const_cast<RTOS_TASK*>(&rtos_task) );
+                oro_smp_mb();
+                stats = mstats;
+                oro_smp_mb();
+            } while ( seq != mstats_seq.read() );
+            return true;
+        }
+
+        void Thread::resetStatistics()
+        {
+            mstats_reset = true;
+        }
+
+        void Thread::updateStatistics(nsecs wakeup_latency, nsecs step_duration, bool overrun)
+        {
+            mstats_seq.inc();
+            oro_smp_mb();
+            if ( mstats_reset ) {
+                mstats.reset();
+                mstats_reset = false;
+            }
+            mstats.add(wakeup_latency, step_duration, overrun);
+            oro_smp_mb();
+            mstats_seq.inc();
+        }
+
     }
 }
 
@@ -44,6 +44,8 @@
 
 #include "ThreadInterface.hpp"
 #include "Mutex.hpp"
+#include "Atomic.hpp"
+#include "ThreadStatistics.hpp"
 
 #include <string>
 
@@ -234,6 +236,23 @@ namespace RTT
              */
             virtual unsigned getCpuAffinity() const;
 
+            /**
+             * Set the cpus of this thread (@see rtos_task_set_cpu_set).
+             * @return true if the cpus have been applied
+             */
+            virtual bool setCpuSet(const CpuSet& cpus);
+
+            virtual CpuSet getCpuSet() const;
+
+            /**
+             * Bind this thread to the cpus of a NUMA node and place its
+             * stack on that node (@see rtos_task_set_numa_node).
+             * @return true if the thread was bound to the cpus of \a node
+             */
+            virtual bool setNumaNode(int node);
+
+            virtual int getNumaNode() const;
+
             virtual void yield();
 
             virtual void setMaxOverrun(int m);
@@ -242,6 +261,19 @@ namespace RTT
 
             virtual void setWaitPeriodPolicy(int p);
 
+            /**
+             * Enable or disable the cycle timing statistics. They are
+             * measured in periodic mode only, see ThreadStatistics.
+             * Measuring costs two clock reads per cycle and no allocations.
+             */
+            virtual bool setStatisticsEnabled(bool enable);
+
+            virtual bool isStatisticsEnabled() const;
+
+            virtual bool getStatistics(ThreadStatistics& stats) const;
+
+            virtual void resetStatistics();
+
         protected:
             /**
              * Exit and destroy the thread
@@ -252,6 +284,12 @@ namespace RTT
 
             void emergencyStop();
 
+            /**
+             * Adds the measurements of one cycle to the statistics.
+             * Only called by the thread itself.
+             */
+            void updateStatistics(nsecs wakeup_latency, nsecs step_duration, bool overrun);
+
             /**
              * @see base::RunnableInterface::step()
              */
@@ -304,6 +342,11 @@ namespace RTT
              */
             int msched_type;
 
+            /**
+             * The NUMA node set with setNumaNode(), or -1.
+             */
+            int mnuma_node;
+
             /**
              * When set to 1, the thread will run, when set to 0
              * the thread will stop ( isActive() )
@@ -356,6 +399,30 @@ namespace RTT
              */
             double stopTimeout;
 
+            /**
+             * The wait policy as it is passed to the operating system.
+             */
+            int mwait_policy;
+
+            /**
+             * True if the cycle timing statistics are measured.
+             */
+            bool mstats_enabled;
+
+            /**
+             * Set by resetStatistics(), the thread clears \a mstats
+             * before it adds the next cycle.
+             */
+            bool mstats_reset;
+
+            /**
+             * Written by the thread only. \a mstats_seq is odd while
+             * the thread updates \a mstats, such that readers can detect
+             * and retry a torn copy.
+             */
+            ThreadStatistics mstats;
+            AtomicInt mstats_seq;
+
 #ifdef OROPKG_OS_THREAD_SCOPE
             // Pointer to Threadscope device
             dev::DigitalOutInterface * d;
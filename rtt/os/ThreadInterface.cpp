@@ -55,6 +55,45 @@ ThreadInterface::~ThreadInterface()
     //threads.dec();
 }
 
+bool ThreadInterface::setCpuSet(const CpuSet& cpus)
+{
+    return false;
+}
+
+CpuSet ThreadInterface::getCpuSet() const
+{
+    return CpuSet( this->getCpuAffinity() );
+}
+
+bool ThreadInterface::setNumaNode(int node)
+{
+    return false;
+}
+
+int ThreadInterface::getNumaNode() const
+{
+    return -1;
+}
+
+bool ThreadInterface::setStatisticsEnabled(bool enable)
+{
+    return !enable;
+}
+
+bool ThreadInterface::isStatisticsEnabled() const
+{
+    return false;
+}
+
+bool ThreadInterface::getStatistics(ThreadStatistics& stats) const
+{
+    return false;
+}
+
+void ThreadInterface::resetStatistics()
+{
+}
+
 bool ThreadInterface::isSelf() const
 {
     return rtos_task_is_self( this->getTask() ) == 1;
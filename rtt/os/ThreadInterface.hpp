@@ -42,6 +42,8 @@
 #include "fosi.h"
 #include "threads.hpp"
 #include "Time.hpp"
+#include "ThreadStatistics.hpp"
+#include "CpuSet.hpp"
 #include "../rtt-config.h"
 
 namespace RTT
@@ -195,6 +197,33 @@ namespace RTT
              */
             virtual unsigned getCpuAffinity() const = 0;
 
+            /**
+             * Bind this thread to a set of cpus, which may hold cpus
+             * above 31.
+             * @param cpus The cpus to run on. An empty set allows all cpus.
+             * @return false if this thread can not be bound to \a cpus.
+             */
+            virtual bool setCpuSet(const CpuSet& cpus);
+
+            /**
+             * @return the cpus this thread may run on. By default, these
+             * are the cpus of getCpuAffinity().
+             */
+            virtual CpuSet getCpuSet() const;
+
+            /**
+             * Bind this thread to the cpus of NUMA node \a node and place
+             * its stack in the memory of that node.
+             * @param node The NUMA node, or -1 to allow all cpus again.
+             * @return false if this thread can not be placed on \a node.
+             */
+            virtual bool setNumaNode(int node);
+
+            /**
+             * @return the NUMA node set with setNumaNode(), or -1 if none.
+             */
+            virtual int getNumaNode() const;
+
             virtual void setMaxOverrun(int m) = 0;
 
             virtual int getMaxOverrun() const = 0;
@@ -206,6 +235,29 @@ namespace RTT
              */
             virtual void setWaitPeriodPolicy(int p) = 0;
 
+            /**
+             * Enable or disable the measurement of the cycle timing
+             * statistics of a periodic thread.
+             * @return false if this thread does not measure statistics.
+             */
+            virtual bool setStatisticsEnabled(bool enable);
+
+            /**
+             * @return true if the cycle timing statistics are measured.
+             */
+            virtual bool isStatisticsEnabled() const;
+
+            /**
+             * Copy the cycle timing statistics of this thread into \a stats.
+             * @return false if this thread does not measure statistics.
+             */
+            virtual bool getStatistics(ThreadStatistics& stats) const;
+
+            /**
+             * Clear the cycle timing statistics of this thread.
+             */
+            virtual void resetStatistics();
+
             /**
              * Yields (put to the back of the scheduler queue) the calling thread.
              */
@@ -0,0 +1,92 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ThreadStatistics.hpp"
+
+namespace RTT {
+    namespace os {
+
+        ThreadStatistics::ThreadStatistics()
+        {
+            this->reset();
+        }
+
+        void ThreadStatistics::reset()
+        {
+            cycles = 0;
+            overruns = 0;
+            last_wakeup_latency = 0;
+            max_wakeup_latency = 0;
+            total_wakeup_latency = 0;
+            last_step_duration = 0;
+            max_step_duration = 0;
+            total_step_duration = 0;
+            for (unsigned int i = 0; i != HistogramSize; ++i)
+                wakeup_histogram[i] = 0;
+        }
+
+        void ThreadStatistics::add(nsecs wakeup_latency, nsecs step_duration, bool overrun)
+        {
+            ++cycles;
+            if (overrun)
+                ++overruns;
+
+            last_wakeup_latency = wakeup_latency;
+            if (wakeup_latency > max_wakeup_latency)
+                max_wakeup_latency = wakeup_latency;
+            total_wakeup_latency += wakeup_latency;
+            ++wakeup_histogram[ histogramBucket(wakeup_latency) ];
+
+            last_step_duration = step_duration;
+            if (step_duration > max_step_duration)
+                max_step_duration = step_duration;
+            total_step_duration += step_duration;
+        }
+
+        unsigned int ThreadStatistics::histogramBucket(nsecs wakeup_latency)
+        {
+            nsecs us = wakeup_latency / NSECS_IN_USECS;
+            unsigned int bucket = 0;
+            while ( us > 0 && bucket != HistogramSize - 1 ) {
+                us >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        nsecs ThreadStatistics::getMeanWakeupLatency() const
+        {
+            return cycles ? total_wakeup_latency / nsecs(cycles) : 0;
+        }
+
+        nsecs ThreadStatistics::getMeanStepDuration() const
+        {
+            return cycles ? total_step_duration / nsecs(cycles) : 0;
+        }
+    }
+}
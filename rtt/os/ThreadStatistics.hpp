@@ -0,0 +1,111 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_OS_THREAD_STATISTICS_HPP
+#define ORO_OS_THREAD_STATISTICS_HPP
+
+#include "Time.hpp"
+#include "../rtt-config.h"
+
+namespace RTT
+{ namespace os {
+
+    /**
+     * Cycle timing statistics of a periodic thread.
+     *
+     * The wake-up latency of a cycle is the time between the moment
+     * step() should have started according to the period and the moment
+     * it actually started. All times are in nanoseconds.
+     *
+     * @see ThreadInterface::setStatisticsEnabled()
+     */
+    struct RTT_API ThreadStatistics
+    {
+        /**
+         * The number of buckets of the wake-up latency histogram.
+         */
+        static const unsigned int HistogramSize = 16;
+
+        ThreadStatistics();
+
+        /**
+         * Clears all statistics.
+         */
+        void reset();
+
+        /**
+         * Adds the measurements of one cycle.
+         */
+        void add(nsecs wakeup_latency, nsecs step_duration, bool overrun);
+
+        /**
+         * The histogram bucket of a wake-up latency. Bucket 0 counts the
+         * latencies below one microsecond, bucket i the latencies from
+         * 2^(i-1) up to 2^i microseconds and the last bucket all larger
+         * latencies.
+         */
+        static unsigned int histogramBucket(nsecs wakeup_latency);
+
+        /**
+         * The mean wake-up latency, or zero if no cycles were measured.
+         */
+        nsecs getMeanWakeupLatency() const;
+
+        /**
+         * The mean duration of step(), or zero if no cycles were measured.
+         */
+        nsecs getMeanStepDuration() const;
+
+        /**
+         * The number of measured cycles.
+         */
+        unsigned long cycles;
+
+        /**
+         * The number of cycles in which step() did not finish before
+         * the start of the next period.
+         */
+        unsigned long overruns;
+
+        nsecs last_wakeup_latency;
+        nsecs max_wakeup_latency;
+        nsecs total_wakeup_latency;
+
+        nsecs last_step_duration;
+        nsecs max_step_duration;
+        nsecs total_step_duration;
+
+        /**
+         * The number of cycles per wake-up latency bucket.
+         * @see histogramBucket()
+         */
+        unsigned long wakeup_histogram[HistogramSize];
+    };
+}}
+
+#endif
@@ -48,6 +48,7 @@
 #define OS_FOSI_INTERNAL_INTERFACE_HPP
 
 #include "ThreadInterface.hpp"
+#include "CpuSet.hpp"
 #include "fosi.h"
 
 namespace RTT {
@@ -241,6 +242,42 @@ namespace RTT {
              */
             unsigned rtos_task_get_cpu_affinity(const RTOS_TASK * task);
 
+            /**
+             * Set the cpus a thread may run on, without the limit of
+             * 32 cpus of rtos_task_set_cpu_affinity().
+             * @param task The thread to change the cpu affinity of
+             * @param cpus The cpus to bind to. An empty set allows all cpus.
+             * @return 0 if the cpu affinity could be set.
+             */
+            int rtos_task_set_cpu_set(RTOS_TASK * task, const CpuSet& cpus);
+
+            /**
+             * Return the cpus a thread may run on.
+             * @param task The thread to get the cpu affinity
+             * @param cpus Receives the cpus of \a task.
+             * @return 0 if the cpu affinity could be read.
+             */
+            int rtos_task_get_cpu_set(const RTOS_TASK * task, CpuSet& cpus);
+
+            /**
+             * Bind a thread to the cpus of a NUMA node and move its
+             * stack to the memory of that node, if the RTOS supports it.
+             * @param task The thread to place.
+             * @param node The NUMA node, or -1 to allow all cpus again.
+             * @return 0 if the thread was bound to the cpus of \a node.
+             * Placing the stack is done on a best effort basis.
+             */
+            int rtos_task_set_numa_node(RTOS_TASK * task, int node);
+
+            /**
+             * Prefer the memory of NUMA node \a node for the pages which
+             * hold \a size bytes at \a addr, and move these pages if they
+             * are elsewhere.
+             * @return 0 if the memory policy could be set, -1 if it could
+             * not or if NUMA is not supported.
+             */
+            int rtos_numa_bind_memory(void* addr, size_t size, int node);
+
             /**
              * Returns the name by which a task is known in the RTOS.
              * @param task The task to query.
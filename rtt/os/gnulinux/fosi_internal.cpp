@@ -50,6 +50,8 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <sys/syscall.h>
+#include <fstream>
+#include <sstream>
 
 using namespace std;
 
@@ -472,6 +474,102 @@ namespace RTT
         return ~0;
         }
 
+	INTERNAL_QUAL int rtos_task_set_cpu_set(RTOS_TASK * task, const CpuSet& cpus)
+	{
+        if( task && task->thread != 0 ) {
+            cpu_set_t cs;
+            CPU_ZERO(&cs);
+            for(unsigned i = 0; i < CpuSet::MaxCpus && i < CPU_SETSIZE; i++)
+                {
+                    // an empty set clears the mask.
+                    if( cpus.none() || cpus.test(i) ) { CPU_SET(i, &cs); }
+                }
+            return pthread_setaffinity_np(task->thread, sizeof(cs), &cs);
+        }
+        return -1;
+    }
+
+	INTERNAL_QUAL int rtos_task_get_cpu_set(const RTOS_TASK * task, CpuSet& cpus)
+	{
+        if( task && task->thread != 0 ) {
+            cpu_set_t cs;
+            if ( pthread_getaffinity_np(task->thread, sizeof(cs), &cs) != 0 )
+                return -1;
+            cpus.clear();
+            for(unsigned i = 0; i < CpuSet::MaxCpus && i < CPU_SETSIZE; i++)
+                {
+                    if( CPU_ISSET(i, &cs) ) { cpus.set(i); }
+                }
+            return 0;
+        }
+        return -1;
+    }
+
+    /**
+     * Reads the cpus of a NUMA node from sysfs.
+     */
+    static int rtos_numa_node_cpus(int node, CpuSet& cpus)
+    {
+        std::ostringstream path;
+        path << "/sys/devices/system/node/node" << node << "/cpulist";
+        std::ifstream cpulist( path.str().c_str() );
+        std::string line;
+        if ( !std::getline(cpulist, line) || !cpus.fromString(line) || cpus.none() )
+            return -1;
+        return 0;
+    }
+
+	INTERNAL_QUAL int rtos_task_set_numa_node(RTOS_TASK * task, int node)
+	{
+        if( task == 0 || task->thread == 0 )
+            return -1;
+        CpuSet cpus;
+        if ( node >= 0 && rtos_numa_node_cpus(node, cpus) != 0 ) {
+            log(Error) << "rtos_task_set_numa_node: NUMA node " << node << " does not exist or has no cpus." << endlog();
+            return -1;
+        }
+        if ( rtos_task_set_cpu_set(task, cpus) != 0 )
+            return -1;
+        if ( node < 0 )
+            return 0;
+
+        // the stack pages which were touched already are moved, the
+        // others are allocated on the node when they are touched.
+        pthread_attr_t attr;
+        void* stack = 0;
+        size_t stack_size = 0;
+        if ( pthread_getattr_np(task->thread, &attr) == 0 ) {
+            pthread_attr_getstack(&attr, &stack, &stack_size);
+            pthread_attr_destroy(&attr);
+        }
+        if ( stack == 0 || rtos_numa_bind_memory(stack, stack_size, node) != 0 )
+            log(Warning) << "rtos_task_set_numa_node: could not place the stack of " << task->name << " on NUMA node " << node << endlog();
+        return 0;
+    }
+
+	INTERNAL_QUAL int rtos_numa_bind_memory(void* addr, size_t size, int node)
+	{
+#if defined(SYS_mbind)
+        // values of <numaif.h>, we do not depend on libnuma.
+        const int mpol_preferred = 1;
+        const unsigned int mpol_mf_move = 1 << 1;
+        if ( addr == 0 || size == 0 || node < 0 || node >= int(8 * sizeof(unsigned long)) )
+            return -1;
+        // mbind() works on whole pages.
+        unsigned long page = sysconf(_SC_PAGESIZE);
+        unsigned long begin = (unsigned long)addr & ~(page - 1);
+        unsigned long end = ((unsigned long)addr + size + page - 1) & ~(page - 1);
+        unsigned long nodemask = 1ul << node;
+        // the kernel ignores the last bit of maxnode.
+        if ( syscall(SYS_mbind, begin, end - begin, mpol_preferred, &nodemask,
+                     8 * sizeof(nodemask) + 1, mpol_mf_move) != 0 )
+            return -1;
+        return 0;
+#else
+        return -1;
+#endif
+    }
+
 	INTERNAL_QUAL const char * rtos_task_get_name(const RTOS_TASK* task)
 	{
         return task->name ? task->name : "(destroyed)";
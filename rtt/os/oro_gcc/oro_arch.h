@@ -151,5 +151,21 @@ static __inline__ int oro_atomic_inc_and_test(oro_atomic_t *a_int)
 #define oro_cmpxchg(ptr,o,n)\
     ((__typeof__(*(ptr)))__sync_val_compare_and_swap((ptr),(o),(n)))
 
+/**
+ * Full memory barrier: no loads or stores are reordered across it,
+ * neither by the compiler nor by the CPU.
+ */
+#define oro_smp_mb() __sync_synchronize()
+
+/**
+ * Read memory barrier: loads are not reordered across it.
+ */
+#define oro_smp_rmb() __sync_synchronize()
+
+/**
+ * Write memory barrier: stores are not reordered across it.
+ */
+#define oro_smp_wmb() __sync_synchronize()
+
 
 #endif // __GCC_ORO_ARCH__
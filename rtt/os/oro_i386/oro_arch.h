@@ -174,6 +174,21 @@ static inline unsigned long __oro_cmpxchg(volatile void *ptr, unsigned long old,
     ((__typeof__(*(ptr)))__oro_cmpxchg((ptr),(unsigned long)(o),\
                     (unsigned long)(n),sizeof(*(ptr))))
 
+/**
+ * Full memory barrier: no loads or stores are reordered across it,
+ * neither by the compiler nor by the CPU. A locked add is used since
+ * not all i386 variants have mfence.
+ */
+#define oro_smp_mb() __asm__ __volatile__(ORO_LOCK "addl $0,0(%%esp)" : : : "memory")
+
+/**
+ * Read and write memory barriers. x86 does not reorder loads with
+ * other loads nor stores with other stores, so only the compiler
+ * needs to be stopped.
+ */
+#define oro_smp_rmb() __asm__ __volatile__("" : : : "memory")
+#define oro_smp_wmb() __asm__ __volatile__("" : : : "memory")
+
 #undef ORO_LOCK
 #undef ORO_LOCK_PREFIX
 #endif
@@ -124,6 +124,18 @@ static __forceinline int oro_atomic_set_mask(oro_atomic_t *a_int, int mask)
 	return _InterlockedOr((long *)a_int, mask);
 }
 
+/**
+ * Full memory barrier: no loads or stores are reordered across it,
+ * neither by the compiler nor by the CPU.
+ */
+#define oro_smp_mb() MemoryBarrier()
+
+/**
+ * Read and write memory barriers.
+ */
+#define oro_smp_rmb() MemoryBarrier()
+#define oro_smp_wmb() MemoryBarrier()
+
 #pragma warning(push)
 #pragma warning(disable : 4715) // Disable warning on "specified function can potentially not return a value"
 
@@ -144,4 +144,17 @@ static __inline__ int oro_atomic_inc_and_test(oro_atomic_t *a_int)
   return ret;
 }
 
+/**
+ * Memory barrier. Without assembly support, we can only prevent
+ * the compiler from reordering, which is sufficient for the mutex
+ * based atomics of this architecture.
+ */
+#if defined(__GNUC__)
+#define oro_smp_mb() __asm__ __volatile__("" : : : "memory")
+#else
+#define oro_smp_mb()
+#endif
+#define oro_smp_rmb() oro_smp_mb()
+#define oro_smp_wmb() oro_smp_mb()
+
 #endif
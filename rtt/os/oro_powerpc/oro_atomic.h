@@ -72,6 +72,18 @@ static inline void isync(void)
 	__asm__ __volatile__ ("isync" : : : "memory");
 }
 
+/**
+ * Full memory barrier: no loads or stores are reordered across it,
+ * neither by the compiler nor by the CPU.
+ */
+#define oro_smp_mb() __asm__ __volatile__ ("sync" : : : "memory")
+
+/**
+ * Read and write memory barriers.
+ */
+#define oro_smp_rmb() __asm__ __volatile__ ("sync" : : : "memory")
+#define oro_smp_wmb() __asm__ __volatile__ ("sync" : : : "memory")
+
 // ==================================================
 // asm/asm-compat.h
 
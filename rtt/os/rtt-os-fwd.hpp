@@ -56,6 +56,7 @@ namespace RTT {
         class StartStopManager;
         class Thread;
         class ThreadInterface;
+        struct ThreadStatistics;
         class TimeService;
         class Timer;
         struct CleanupFunction;
@@ -72,6 +72,10 @@
 #define	USE_MMAP 	(0)
 #endif
 
+#ifndef TLSF_THREAD_CACHE
+#define	TLSF_THREAD_CACHE 	(0)
+#endif
+
 #ifndef USE_SBRK
 #define	USE_SBRK 	(0)
 #endif
@@ -118,6 +122,10 @@
 #define ORO_MEMORY_POOL
 #include "tlsf.h"
 
+#if TLSF_THREAD_CACHE
+#include <pthread.h>
+#endif
+
 #if !defined(__GNUC__)
 #ifndef __inline__
 #define __inline__
@@ -150,7 +158,10 @@
 #define TLSF_SIGNATURE	(0x2A59FA59)
 
 #define	PTR_MASK	(sizeof(void *) - 1)
-#define BLOCK_SIZE	((intptr_t)~PTR_MASK)
+/* Block sizes are multiples of BLOCK_ALIGN, so the low bits up to BLOCK_ALIGN
+ * carry flags. This keeps bit 2 a flag on 32-bit targets, too. */
+#define FLAG_MASK	(BLOCK_ALIGN - 1)
+#define BLOCK_SIZE	((intptr_t)~FLAG_MASK)
 
 
 /* Dereferencing type-punned pointers will break strict aliasing.*/
@@ -473,6 +484,12 @@ static __inline__ bhdr_t *process_area(void *area, size_t size)
 
 static char *mp = NULL;         /* Default memory pool. */
 
+#if TLSF_THREAD_CACHE
+/* Changes when the default memory pool changes, which invalidates all
+ * blocks in the thread caches. */
+static unsigned int mp_generation = 0;
+#endif
+
 /******************************************************************/
 size_t init_memory_pool(size_t mem_pool_size, void *mem_pool)
 {
@@ -496,8 +513,12 @@ size_t init_memory_pool(size_t mem_pool_size, void *mem_pool)
         return b->size & BLOCK_SIZE;
     }
 
-    if(mp == 0)
+    if(mp == 0) {
         mp = mem_pool;
+#if TLSF_THREAD_CACHE
+        ++mp_generation;
+#endif
+    }
 
     /* Zeroing the memory pool */
     memset(mem_pool, 0, sizeof(tlsf_t));
@@ -651,6 +672,9 @@ void destroy_memory_pool(void *mem_pool)
 /******************************************************************/
     if((void*)mp == (void*)mem_pool){
         mp = 0;
+#if TLSF_THREAD_CACHE
+        ++mp_generation;
+#endif
     }
 
     tlsf_t *tlsf = (tlsf_t *) mem_pool;
@@ -661,7 +685,7 @@ void destroy_memory_pool(void *mem_pool)
 
 
 /******************************************************************/
-void *tlsf_malloc(size_t size)
+static void *mp_malloc(size_t size)
 {
 /******************************************************************/
     void *ret;
@@ -690,7 +714,7 @@ void *tlsf_malloc(size_t size)
 }
 
 /******************************************************************/
-void tlsf_free(void *ptr)
+static void mp_free(void *ptr)
 {
 /******************************************************************/
 
@@ -702,6 +726,306 @@ void tlsf_free(void *ptr)
 
 }
 
+#if TLSF_THREAD_CACHE
+
+/* Each thread keeps up to CACHE_DEPTH freed blocks of each size class in
+ * a magazine, which it reuses without taking the pool lock. Class c holds
+ * blocks of at least CACHE_MIN_SIZE << c bytes and less than twice that.
+ * A magazine that is full returns half of its blocks to the pool under one
+ * lock, so every call takes at most one lock and a bounded number of
+ * free_ex() calls. A block freed by another thread than the one which
+ * allocated it goes to the magazine of the freeing thread, which is
+ * bounded the same way. */
+#define CACHE_CLASSES	(5)
+#define CACHE_DEPTH	(32)
+#define CACHE_MIN_SIZE	(16)
+#define CACHE_MAX_SIZE	(CACHE_MIN_SIZE << (CACHE_CLASSES - 1))
+
+/* Marks a used block which is in a magazine. Bit 2 of the size lies inside
+ * FLAG_MASK, so BLOCK_SIZE never includes it. */
+#define CACHED_BLOCK	(0x4)
+
+typedef struct thread_cache_struct {
+    void *blocks[CACHE_CLASSES][CACHE_DEPTH];
+    int count[CACHE_CLASSES];
+    unsigned int generation;
+    int registered;
+    struct tlsf_thread_cache_statistics stats;
+    struct thread_cache_struct *prev;
+    struct thread_cache_struct *next;
+} thread_cache_t;
+
+static __thread thread_cache_t thread_cache;
+
+/* The caches of all threads, for the statistics. */
+static thread_cache_t *cache_list = NULL;
+static pthread_mutex_t cache_list_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t cache_key;
+static pthread_once_t cache_key_once = PTHREAD_ONCE_INIT;
+
+static __inline__ int cache_class(size_t size)
+{
+    int c;
+    if (size < CACHE_MIN_SIZE || size >= 2 * CACHE_MAX_SIZE)
+        return -1;
+    c = ms_bit((int) size) - ms_bit(CACHE_MIN_SIZE);
+    return c;
+}
+
+/* Drops the blocks of a previous default pool. */
+static __inline__ void cache_validate(thread_cache_t *tc)
+{
+    int c;
+    if (tc->generation == mp_generation)
+        return;
+    for (c = 0; c != CACHE_CLASSES; ++c)
+        tc->count[c] = 0;
+    tc->stats.cached = 0;
+    tc->generation = mp_generation;
+}
+
+/* Returns the blocks of class c above keep to the pool. */
+static void cache_release(thread_cache_t *tc, int c, int keep)
+{
+    bhdr_t *b;
+    if (tc->count[c] <= keep)
+        return;
+    TLSF_ACQUIRE_LOCK(&((tlsf_t *)mp)->lock);
+    while (tc->count[c] > keep) {
+        b = (bhdr_t *) ((char *) tc->blocks[c][--tc->count[c]] - BHDR_OVERHEAD);
+        tc->stats.cached -= b->size & BLOCK_SIZE;
+        b->size &= ~CACHED_BLOCK;
+        free_ex(b->ptr.buffer, mp);
+    }
+    TLSF_RELEASE_LOCK(&((tlsf_t *)mp)->lock);
+    ++tc->stats.flushes;
+}
+
+static void cache_destroy(void *arg)
+{
+    thread_cache_t *tc = (thread_cache_t *) arg;
+    int c;
+
+    if (mp) {
+        cache_validate(tc);
+        for (c = 0; c != CACHE_CLASSES; ++c)
+            cache_release(tc, c, 0);
+    }
+
+    pthread_mutex_lock(&cache_list_lock);
+    if (tc->prev)
+        tc->prev->next = tc->next;
+    else
+        cache_list = tc->next;
+    if (tc->next)
+        tc->next->prev = tc->prev;
+    pthread_mutex_unlock(&cache_list_lock);
+    tc->registered = 0;
+}
+
+static void cache_create_key(void)
+{
+    pthread_key_create(&cache_key, cache_destroy);
+}
+
+/* Lists the cache of the calling thread and flushes it when the thread exits. */
+static void cache_register(thread_cache_t *tc)
+{
+    pthread_once(&cache_key_once, cache_create_key);
+    pthread_setspecific(cache_key, tc);
+    pthread_mutex_lock(&cache_list_lock);
+    tc->prev = NULL;
+    tc->next = cache_list;
+    if (cache_list)
+        cache_list->prev = tc;
+    cache_list = tc;
+    pthread_mutex_unlock(&cache_list_lock);
+    tc->registered = 1;
+}
+
+/******************************************************************/
+void *tlsf_malloc(size_t size)
+{
+/******************************************************************/
+    thread_cache_t *tc = &thread_cache;
+    bhdr_t *b;
+    void *ret;
+    int c;
+
+    if (size > CACHE_MAX_SIZE || !mp)
+        return mp_malloc(size);
+
+    if (!tc->registered)
+        cache_register(tc);
+    cache_validate(tc);
+
+    c = cache_class(size < CACHE_MIN_SIZE ? CACHE_MIN_SIZE : size);
+    /* round up to the class, unless size is exactly a class size. */
+    if ((size_t)(CACHE_MIN_SIZE << c) < size)
+        ++c;
+
+    if (tc->count[c]) {
+        ret = tc->blocks[c][--tc->count[c]];
+        b = (bhdr_t *) ((char *) ret - BHDR_OVERHEAD);
+        b->size &= ~CACHED_BLOCK;
+        tc->stats.cached -= b->size & BLOCK_SIZE;
+        tc->stats.allocated += b->size & BLOCK_SIZE;
+        ++tc->stats.hits;
+        return ret;
+    }
+
+    ++tc->stats.misses;
+    ret = mp_malloc(CACHE_MIN_SIZE << c);
+    if (ret) {
+        b = (bhdr_t *) ((char *) ret - BHDR_OVERHEAD);
+        tc->stats.allocated += b->size & BLOCK_SIZE;
+    }
+    return ret;
+}
+
+/******************************************************************/
+void tlsf_free(void *ptr)
+{
+/******************************************************************/
+    thread_cache_t *tc = &thread_cache;
+    bhdr_t *b;
+    size_t size;
+    int c;
+
+    if (!ptr)
+        return;
+
+    if (!mp) {
+        mp_free(ptr);
+        return;
+    }
+
+    b = (bhdr_t *) ((char *) ptr - BHDR_OVERHEAD);
+    if (b->size & CACHED_BLOCK)
+        corrupt("tlsf_free(): Freeing cached block\n");
+    size = b->size & BLOCK_SIZE;
+    c = cache_class(size);
+    if (c < 0 || (b->size & BLOCK_STATE) != USED_BLOCK) {
+        /* free_ex() reports the corruption of an unused block. */
+        mp_free(ptr);
+        return;
+    }
+
+    if (!tc->registered)
+        cache_register(tc);
+    cache_validate(tc);
+
+    if (tc->count[c] == CACHE_DEPTH)
+        cache_release(tc, c, CACHE_DEPTH / 2);
+
+    b->size |= CACHED_BLOCK;
+    tc->blocks[c][tc->count[c]++] = ptr;
+    tc->stats.cached += size;
+    tc->stats.released += size;
+}
+
+/******************************************************************/
+void flush_thread_cache(void)
+{
+/******************************************************************/
+    thread_cache_t *tc = &thread_cache;
+    int c;
+
+    if (!mp || !tc->registered)
+        return;
+    cache_validate(tc);
+    for (c = 0; c != CACHE_CLASSES; ++c)
+        cache_release(tc, c, 0);
+}
+
+/******************************************************************/
+void get_thread_cache_statistics(struct tlsf_thread_cache_statistics *stats)
+{
+/******************************************************************/
+    cache_validate(&thread_cache);
+    *stats = thread_cache.stats;
+}
+
+/******************************************************************/
+size_t get_cached_size_mp()
+{
+/******************************************************************/
+    thread_cache_t *tc;
+    size_t cached = 0;
+
+    pthread_mutex_lock(&cache_list_lock);
+    for (tc = cache_list; tc; tc = tc->next)
+        if (tc->generation == mp_generation)
+            cached += tc->stats.cached;
+    pthread_mutex_unlock(&cache_list_lock);
+    return cached;
+}
+
+#else
+
+/******************************************************************/
+void *tlsf_malloc(size_t size)
+{
+/******************************************************************/
+    return mp_malloc(size);
+}
+
+/******************************************************************/
+void tlsf_free(void *ptr)
+{
+/******************************************************************/
+    mp_free(ptr);
+}
+
+/******************************************************************/
+void flush_thread_cache(void)
+{
+/******************************************************************/
+}
+
+/******************************************************************/
+void get_thread_cache_statistics(struct tlsf_thread_cache_statistics *stats)
+{
+/******************************************************************/
+    memset(stats, 0, sizeof(*stats));
+}
+
+/******************************************************************/
+size_t get_cached_size_mp()
+{
+/******************************************************************/
+    return 0;
+}
+
+#endif
+
+/******************************************************************/
+size_t get_free_size_mp(size_t *largest)
+{
+/******************************************************************/
+    tlsf_t *tlsf = (tlsf_t *) mp;
+    bhdr_t *b;
+    size_t free_size = 0, size;
+    int fl, sl;
+
+    if (largest)
+        *largest = 0;
+    if (!tlsf)
+        return 0;
+
+    TLSF_ACQUIRE_LOCK(&tlsf->lock);
+    for (fl = 0; fl != REAL_FLI; ++fl)
+        for (sl = 0; sl != MAX_SLI; ++sl)
+            for (b = tlsf->matrix[fl][sl]; b; b = b->ptr.free_ptr.next) {
+                size = b->size & BLOCK_SIZE;
+                free_size += size;
+                if (largest && size > *largest)
+                    *largest = size;
+            }
+    TLSF_RELEASE_LOCK(&tlsf->lock);
+    return free_size;
+}
+
 /******************************************************************/
 void *tlsf_realloc(void *ptr, size_t size)
 {
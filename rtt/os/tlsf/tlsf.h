@@ -33,6 +33,17 @@ extern "C" {
 #endif
 
 #ifdef ORO_MEMORY_POOL
+/* The counters of the per-thread cache in front of the default pool,
+ * in bytes of blocks, which are updated without locking. */
+struct tlsf_thread_cache_statistics {
+    size_t allocated;   /* handed out to the thread */
+    size_t released;    /* freed by the thread */
+    size_t cached;      /* kept in the cache of the thread */
+    size_t hits;        /* allocations served from the cache */
+    size_t misses;      /* allocations served from the pool */
+    size_t flushes;     /* times that cached blocks went back to the pool */
+};
+
 extern size_t init_memory_pool(size_t, void *);
 extern size_t get_used_size(void *);
 extern size_t get_used_size_mp();
@@ -44,6 +55,10 @@ extern void *malloc_ex(size_t, void *);
 extern void free_ex(void *, void *);
 extern void *realloc_ex(void *, size_t, void *);
 extern void *calloc_ex(size_t, size_t, void *);
+extern void flush_thread_cache(void);
+extern void get_thread_cache_statistics(struct tlsf_thread_cache_statistics *);
+extern size_t get_cached_size_mp();
+extern size_t get_free_size_mp(size_t *largest);
 #endif
 
 extern void *tlsf_malloc(size_t size);
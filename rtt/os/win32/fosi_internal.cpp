@@ -341,6 +341,30 @@ void ErrorHandler(LPTSTR lpszFunction)
     return ~0;
     }
 
+    INTERNAL_QUAL int rtos_task_set_cpu_set(RTOS_TASK * task, const CpuSet& cpus)
+    {
+    // only the cpus of an affinity mask are supported.
+    if ( !cpus.fitsMask() )
+        return -1;
+    return rtos_task_set_cpu_affinity(task, cpus.toMask());
+    }
+
+    INTERNAL_QUAL int rtos_task_get_cpu_set(const RTOS_TASK * task, CpuSet& cpus)
+    {
+    cpus = CpuSet( rtos_task_get_cpu_affinity(task) );
+    return 0;
+    }
+
+    INTERNAL_QUAL int rtos_task_set_numa_node(RTOS_TASK * task, int node)
+    {
+    return -1;
+    }
+
+    INTERNAL_QUAL int rtos_numa_bind_memory(void* addr, size_t size, int node)
+    {
+    return -1;
+    }
+
     INTERNAL_QUAL const char * rtos_task_get_name(const RTOS_TASK* t)
     {
     	/* printf("Get Name: ");
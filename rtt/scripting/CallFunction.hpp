@@ -175,8 +175,12 @@ namespace RTT
                 //    step and without a call to updateHook() in between.
                 //
                 do {
-                    maccept = mrunner->process( this );
-                    if ( !maccept ) return false;
+                    // executeAndDispose() may clear maccept before process() returns.
+                    maccept = true;
+                    if ( !mrunner->process( this ) ) {
+                        maccept = false;
+                        return false;
+                    }
 
                     // block for the result: foo stopped or in error or yielded
                     mrunner->waitForMessages(boost::bind(&CallFunction::checkIfDoneOrYielded, this) );
@@ -189,8 +193,12 @@ namespace RTT
                 // 1. Enqueue as a message callback (for the callback step)
                 //    ==> mrunner will call executeAndDispose() (see below)
                 //
-                maccept = mrunner->process( this );
-                if ( !maccept ) return false;
+                // executeAndDispose() may clear maccept before process() returns.
+                maccept = true;
+                if ( !mrunner->process( this ) ) {
+                    maccept = false;
+                    return false;
+                }
 
                 // block for the result: foo stopped or in error or yielded
                 mrunner->waitForMessages(boost::bind(&CallFunction::checkIfDoneOrYielded, this) );
@@ -44,13 +44,15 @@
  */
 
 #include "CorbaConnPolicy.hpp"
+#include <algorithm>
 
 RTT::corba::CConnPolicy toCORBA(RTT::ConnPolicy const& policy)
 {
     RTT::corba::CConnPolicy corba_policy;
     corba_policy.type          = RTT::corba::CConnectionModel(policy.type);
     corba_policy.size          = policy.size;
-    corba_policy.lock_policy   = RTT::corba::CLockPolicy(policy.lock_policy);
+    // CLockPolicy has no SPSC and SEQLOCK, which lock-free replaces for older peers.
+    corba_policy.lock_policy   = RTT::corba::CLockPolicy(std::min(policy.lock_policy, int(RTT::ConnPolicy::LOCK_FREE)));
     corba_policy.init          = policy.init;
     corba_policy.pull          = policy.pull;
     corba_policy.buffer_policy = RTT::corba::CBufferPolicy(policy.buffer_policy);
@@ -78,3 +80,25 @@ RTT::ConnPolicy toRTT(RTT::corba::CConnPolicy const& corba_policy)
     policy.name_id       = corba_policy.name_id;
     return policy;
 }
+
+RTT::corba::CConnPolicyExtras toCORBAExtras(RTT::ConnPolicy const& policy)
+{
+    RTT::corba::CConnPolicyExtras extras;
+    extras.lock_policy  = policy.lock_policy;
+    extras.zero_copy    = policy.zero_copy;
+    extras.statistics   = policy.statistics;
+    extras.batch_size   = policy.batch_size;
+    extras.batch_period = policy.batch_period;
+    return extras;
+}
+
+RTT::ConnPolicy toRTT(RTT::corba::CConnPolicy const& corba_policy, RTT::corba::CConnPolicyExtras const& extras)
+{
+    RTT::ConnPolicy policy = toRTT(corba_policy);
+    policy.lock_policy  = extras.lock_policy;
+    policy.zero_copy    = extras.zero_copy;
+    policy.statistics   = extras.statistics;
+    policy.batch_size   = extras.batch_size;
+    policy.batch_period = extras.batch_period;
+    return policy;
+}
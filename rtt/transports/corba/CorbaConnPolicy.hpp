@@ -58,3 +58,19 @@ RTT::corba::CConnPolicy RTT_CORBA_API toCORBA(RTT::ConnPolicy const& policy);
  */
 RTT::ConnPolicy RTT_CORBA_API toRTT(RTT::corba::CConnPolicy const& corba_policy);
 
+/**
+ * Returns the fields of a RTT ConnPolicy object which a Corba
+ * CConnPolicy object does not have.
+ * @param policy RTT policy
+ * @return Corba policy extras
+ */
+RTT::corba::CConnPolicyExtras RTT_CORBA_API toCORBAExtras(RTT::ConnPolicy const& policy);
+
+/**
+ * Converts a Corba CConnPolicy object and its extras to a RTT ConnPolicy object.
+ * @param corba_policy Corba policy
+ * @param extras Corba policy extras
+ * @return RTT policy
+ */
+RTT::ConnPolicy RTT_CORBA_API toRTT(RTT::corba::CConnPolicy const& corba_policy, RTT::corba::CConnPolicyExtras const& extras);
+
@@ -41,9 +41,12 @@
 namespace RTT {
     using namespace corba;
     CorbaDispatcher::DispatchMap CorbaDispatcher::DispatchI;
+    CorbaDispatcher::Shards CorbaDispatcher::SharedPool;
+    CorbaDispatcher::PeerMap CorbaDispatcher::Peers;
     RTT_CORBA_API os::Mutex* CorbaDispatcher::mlock = 0;
 
     int CorbaDispatcher::defaultScheduler = ORO_SCHED_RT;
     int CorbaDispatcher::defaultPriority  = os::LowestPriority;
     int CorbaDispatcher::defaultCpuAffinity  = 0;
+    int CorbaDispatcher::defaultThreads  = 1;
 }
@@ -40,6 +40,7 @@
 #define ORO_CORBA_DISPATCHER_HPP
 
 #include "../../os/MutexLock.hpp"
+#include "../../os/Atomic.hpp"
 #include "../../Activity.hpp"
 #include "../../base/ChannelElementBase.hpp"
 #include "../../Logger.hpp"
@@ -48,105 +49,238 @@
 #include "DataFlowI.h"
 #include "../../DataFlowInterface.hpp"
 #include "../../TaskContext.hpp"
+#include <sstream>
+#include <vector>
+#include <map>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
 
 namespace RTT {
     namespace corba {
+        /**
+         * The number of channels to one peer which wait in the
+         * dispatchers. Shared by the channels to that peer, see
+         * CorbaDispatcher::Peer().
+         */
+        struct CorbaPeerQueue
+        {
+            CorbaPeerQueue(std::string const& name)
+            : name(name), pending(0), max_pending(0) {}
+
+            std::string name;
+            os::AtomicInt pending;
+            int max_pending;
+        };
+
+        /**
+         * The queue depth of the channels to one peer, as returned
+         * by CorbaDispatcher::GetPeerStatistics().
+         */
+        struct CorbaPeerStatistics
+        {
+            /** The name of the peer, or its key if it has none. */
+            std::string peer;
+            /** The number of its channels waiting to be transferred. */
+            int pending;
+            /** The largest number seen since the last ResetPeerStatistics(). */
+            int max_pending;
+        };
+
         /**
          * This object sends over data flow messages
          * from local buffers to a remote channel element.
+         *
+         * By default, one dispatcher thread is created per data flow
+         * interface. When the CorbaDispatcherThreads property is larger
+         * than one, the interface uses a pool of that many dispatchers
+         * (shards) instead, which is shared by all interfaces of the
+         * process. Each remote channel element is assigned to one shard
+         * by the key of its peer, such that a slow peer only stalls the
+         * connections of its own shard.
+         *
+         * The queue depth is counted per shard and per peer, see
+         * GetPeerStatistics().
          */
         class CorbaDispatcher : public Activity
         {
-            typedef std::map<DataFlowInterface*,CorbaDispatcher*> DispatchMap;
+            typedef std::vector<CorbaDispatcher*> Shards;
+            typedef std::map<DataFlowInterface*,Shards> DispatchMap;
             RTT_CORBA_API static DispatchMap DispatchI;
 
+            /**
+             * The pool which all interfaces with more than one
+             * CorbaDispatcherThreads share. Created by the first of them,
+             * with its properties.
+             */
+            RTT_CORBA_API static Shards SharedPool;
+
+            typedef std::map<CORBA::ULong, boost::weak_ptr<CorbaPeerQueue> > PeerMap;
+            RTT_CORBA_API static PeerMap Peers;
+
             typedef internal::List<base::ChannelElementBase::shared_ptr> RCList;
             RCList RClist;
 
             bool do_exit;
 
+            /**
+             * The number of channels waiting in RClist and the
+             * largest number seen since the last resetStatistics().
+             */
+            os::AtomicInt mpending;
+            int mmax_pending;
+
             RTT_CORBA_API static os::Mutex* mlock;
 
             RTT_CORBA_API static int defaultScheduler;
             RTT_CORBA_API static int defaultPriority;
             RTT_CORBA_API static int defaultCpuAffinity;
+            RTT_CORBA_API static int defaultThreads;
 
             CorbaDispatcher( const std::string& name)
             : Activity(defaultScheduler, defaultPriority, 0.0, 0, name),
               RClist(20,2),
-              do_exit(false)
+              do_exit(false),
+              mpending(0),
+              mmax_pending(0)
               {}
 
             CorbaDispatcher( const std::string& name, int scheduler, int priority, unsigned cpu_affinity)
             : Activity(scheduler, priority, 0.0, cpu_affinity, 0, name),
               RClist(20,2),
-              do_exit(false)
+              do_exit(false),
+              mpending(0),
+              mmax_pending(0)
               {}
 
             ~CorbaDispatcher() {
                 this->stop();
             }
 
+            static void CreateLock() {
+                if (!mlock)
+                    mlock = new os::Mutex();
+            }
+
+            static bool IsShared(Shards const& shards) {
+                return !SharedPool.empty() && !shards.empty() && shards.front() == SharedPool.front();
+            }
+
+            /**
+             * Deletes the shared pool when no interface uses it anymore.
+             * Must be called with mlock held.
+             */
+            static void ReleaseSharedPool() {
+                for (DispatchMap::iterator it = DispatchI.begin(); it != DispatchI.end(); ++it)
+                    if ( IsShared(it->second) )
+                        return;
+                for (Shards::iterator it = SharedPool.begin(); it != SharedPool.end(); ++it)
+                    delete *it;
+                SharedPool.clear();
+            }
+
+            /**
+             * Creates and starts the dispatcher of \a iface, or the shared
+             * pool if \a iface is the first one which asks for a pool.
+             * Must be called with mlock held.
+             */
+            static Shards& CreateShards(DataFlowInterface* iface) {
+                std::string name;
+                TaskContext* owner = (iface != 0 ? iface->getOwner() : 0);
+                if ( !owner )
+                    name = "Global";
+                else
+                    name = owner->getName();
+                name += "Corba";
+
+                // The properties to create the CorbaDispatcher are retrieved.
+                // When the CorbaDispatcher is created these properties can't be changed anymore,
+                // so they are converted to Constants.
+                RTT::types::GlobalsRepository::shared_ptr global_repository = RTT::types::GlobalsRepository::Instance();
+                // The hard coded default is used if the property isn't set for the Component
+                // that owns the Dispatcher and for the GlobalService.
+                RTT::Property<int> scheduler = RTT::Property<int>("","",defaultScheduler);
+                RTT::Property<int> priority = RTT::Property<int>("","",defaultPriority);
+                RTT::Property<int> cpu_affinity =RTT::Property<int>("","",defaultCpuAffinity);
+                RTT::Property<int> threads = RTT::Property<int>("","",defaultThreads);
+
+                // If the Property is defined for the Component or for the GlobalService,
+                // the temporary Property values is updated.
+                if ( owner ) {
+                    scheduler.refresh(owner->getProperty("CorbaDispatcherScheduler")) ||
+                        scheduler.refresh(global_repository->getProperty("CorbaDispatcherScheduler"));
+
+                    priority.refresh(owner->getProperty("CorbaDispatcherPriority")) ||
+                        priority.refresh(global_repository->getProperty("CorbaDispatcherPriority"));
+
+                    cpu_affinity.refresh(owner->getProperty("CorbaDispatcherCpuAffinity")) ||
+                        cpu_affinity.refresh(global_repository->getProperty("CorbaDispatcherCpuAffinity"));
+
+                    threads.refresh(owner->getProperty("CorbaDispatcherThreads")) ||
+                        threads.refresh(global_repository->getProperty("CorbaDispatcherThreads"));
+                } else {
+                    scheduler.refresh(global_repository->getProperty("CorbaDispatcherScheduler"));
+                    priority.refresh(global_repository->getProperty("CorbaDispatcherPriority"));
+                    cpu_affinity.refresh(global_repository->getProperty("CorbaDispatcherCpuAffinity"));
+                    threads.refresh(global_repository->getProperty("CorbaDispatcherThreads"));
+                }
+
+                Shards& shards = DispatchI[iface];
+                if ( threads.get() <= 1 ) {
+                    shards.push_back( new CorbaDispatcher( name, scheduler, priority, cpu_affinity ) );
+                    shards.back()->start();
+                    return shards;
+                }
+                // the first interface which asks for a pool sizes it.
+                if ( SharedPool.empty() ) {
+                    for (int i = 0; i != threads.get(); ++i) {
+                        std::ostringstream shard_name;
+                        shard_name << "CorbaPool" << i;
+                        SharedPool.push_back( new CorbaDispatcher( shard_name.str(), scheduler, priority, cpu_affinity ) );
+                        SharedPool.back()->start();
+                    }
+                }
+                shards = SharedPool;
+                return shards;
+            }
+
         public:
             /**
              * Create a new dispatcher for a given data flow interface.
              * This method will only lock and allocate when a new dispatcher must be created,
              * otherwise, the access is lock-free and real-time.
-             * One dispatcher per \a iface is created.
+             * One dispatcher per \a iface is created, or a pool of
+             * CorbaDispatcherThreads dispatchers if that property is set on
+             * the owner of \a iface or in the GlobalsRepository.
              * @param iface The interface to dispatch data flow messages for.
+             * @param key Selects the dispatcher of the pool, typically a hash
+             * of the remote peer. All channels with the same key share a dispatcher.
              * @return
              */
-            static CorbaDispatcher* Instance(DataFlowInterface* iface) {
-                if (!mlock)
-                    mlock = new os::Mutex();
+            static CorbaDispatcher* Instance(DataFlowInterface* iface, unsigned int key = 0) {
+                CreateLock();
                 DispatchMap::iterator result = DispatchI.find(iface);
                 if ( result == DispatchI.end() ) {
                     os::MutexLock lock(*mlock);
                     // re-try to find (avoid race):
                     result = DispatchI.find(iface);
                     if ( result != DispatchI.end() )
-                        return result->second;
+                        return result->second[ key % result->second.size() ];
                     // *really* not found, let's create it.
-                    std::string name;
-                    TaskContext* owner = (iface != 0 ? iface->getOwner() : 0);
-                    if ( !owner )
-                        name = "Global";
-                    else
-                        name = owner->getName();
-                    name += "Corba";
-
-                    // The properties to create the CorbaDispatcher are retrieved.
-                    // When the CorbaDispatcher is created these properties can't be changed anymore,
-                    // so they are converted to Constants.
-                    RTT::types::GlobalsRepository::shared_ptr global_repository = RTT::types::GlobalsRepository::Instance();
-                    // The hard coded default is used if the property isn't set for the Component
-                    // that owns the Dispatcher and for the GlobalService.
-                    RTT::Property<int> scheduler = RTT::Property<int>("","",defaultScheduler);
-                    RTT::Property<int> priority = RTT::Property<int>("","",defaultPriority);
-                    RTT::Property<int> cpu_affinity =RTT::Property<int>("","",defaultCpuAffinity);
-
-                    // If the Property is defined for the Component or for the GlobalService,
-                    // the temporary Property values is updated.
-                    if ( owner ) {
-                        scheduler.refresh(owner->getProperty("CorbaDispatcherScheduler")) ||
-                            scheduler.refresh(global_repository->getProperty("CorbaDispatcherScheduler"));
-
-                        priority.refresh(owner->getProperty("CorbaDispatcherPriority")) ||
-                            priority.refresh(global_repository->getProperty("CorbaDispatcherPriority"));
-
-                        cpu_affinity.refresh(owner->getProperty("CorbaDispatcherCpuAffinity")) ||
-                            cpu_affinity.refresh(global_repository->getProperty("CorbaDispatcherCpuAffinity"));
-                    } else {
-                        scheduler.refresh(global_repository->getProperty("CorbaDispatcherScheduler"));
-                        priority.refresh(global_repository->getProperty("CorbaDispatcherPriority"));
-                        cpu_affinity.refresh(global_repository->getProperty("CorbaDispatcherCpuAffinity"));
-                    }
-
-                    DispatchI[iface] = new CorbaDispatcher( name, scheduler, priority, cpu_affinity );
-                    DispatchI[iface]->start();
-                    return DispatchI[iface];
+                    Shards& shards = CreateShards(iface);
+                    return shards[ key % shards.size() ];
                 }
-                return result->second;
+                return result->second[ key % result->second.size() ];
+            }
+
+            /**
+             * Returns the number of dispatchers which serve \a iface,
+             * or zero if none were created yet.
+             */
+            static unsigned int ShardCount(DataFlowInterface* iface) {
+                DispatchMap::iterator result = DispatchI.find(iface);
+                if ( result == DispatchI.end() )
+                    return 0;
+                return result->second.size();
             }
 
             /**
@@ -157,8 +291,13 @@ namespace RTT {
                 DispatchMap::iterator result = DispatchI.find(iface);
                 if ( result != DispatchI.end() ) {
                     os::MutexLock lock(*mlock);
-                    delete result->second;
+                    bool shared = IsShared(result->second);
+                    if ( !shared )
+                        for (Shards::iterator it = result->second.begin(); it != result->second.end(); ++it)
+                            delete *it;
                     DispatchI.erase(result);
+                    if ( shared )
+                        ReleaseSharedPool();
                 }
                 if ( DispatchI.empty() )
                     delete mlock;
@@ -171,29 +310,134 @@ namespace RTT {
             static void ReleaseAll() {
                 DispatchMap::iterator result = DispatchI.begin();
                 while ( result != DispatchI.end() ) {
-                    delete result->second;
+                    if ( !IsShared(result->second) )
+                        for (Shards::iterator it = result->second.begin(); it != result->second.end(); ++it)
+                            delete *it;
                     DispatchI.erase(result);
                     result = DispatchI.begin();
                 }
+                ReleaseSharedPool();
+                Peers.clear();
                 delete mlock;
                 mlock = 0;
             }
 
+            /**
+             * Returns the queue statistics of the peer with \a key, which
+             * the channels to that peer share. Not real-time, call it
+             * while the connection is set up.
+             * @param name names the peer in GetPeerStatistics().
+             */
+            static boost::shared_ptr<CorbaPeerQueue> Peer(CORBA::ULong key, std::string const& name) {
+                CreateLock();
+                os::MutexLock lock(*mlock);
+                boost::shared_ptr<CorbaPeerQueue> peer = Peers[key].lock();
+                if ( !peer ) {
+                    std::string peer_name = name;
+                    if ( peer_name.empty() ) {
+                        std::ostringstream key_name;
+                        key_name << key;
+                        peer_name = key_name.str();
+                    }
+                    peer.reset( new CorbaPeerQueue(peer_name) );
+                    Peers[key] = peer;
+                }
+                return peer;
+            }
+
+            /**
+             * Returns the queue depth of each peer which has a connection.
+             * Not real-time.
+             */
+            static std::vector<CorbaPeerStatistics> GetPeerStatistics() {
+                std::vector<CorbaPeerStatistics> result;
+                CreateLock();
+                os::MutexLock lock(*mlock);
+                PeerMap::iterator it = Peers.begin();
+                while ( it != Peers.end() ) {
+                    boost::shared_ptr<CorbaPeerQueue> peer = it->second.lock();
+                    if ( !peer ) {
+                        Peers.erase(it++);
+                        continue;
+                    }
+                    CorbaPeerStatistics stats;
+                    stats.peer = peer->name;
+                    stats.pending = peer->pending.read();
+                    stats.max_pending = peer->max_pending;
+                    result.push_back(stats);
+                    ++it;
+                }
+                return result;
+            }
+
+            static void ResetPeerStatistics() {
+                CreateLock();
+                os::MutexLock lock(*mlock);
+                for (PeerMap::iterator it = Peers.begin(); it != Peers.end(); ++it) {
+                    boost::shared_ptr<CorbaPeerQueue> peer = it->second.lock();
+                    if ( peer )
+                        peer->max_pending = peer->pending.read();
+                }
+            }
+
+            /**
+             * Returns the number of channels waiting to be transferred
+             * by this dispatcher, of all peers it serves.
+             */
+            int getPendingChannels() const {
+                return mpending.read();
+            }
+
+            /**
+             * Returns the largest number of channels that were waiting
+             * at the same time since the creation of this dispatcher
+             * or the last call to resetStatistics().
+             */
+            int getMaxPendingChannels() const {
+                return mmax_pending;
+            }
+
+            void resetStatistics() {
+                mmax_pending = mpending.read();
+            }
+
             static void hasElement(base::ChannelElementBase::shared_ptr c0, base::ChannelElementBase::shared_ptr c1, bool& result)
             {
                 result = result || (c0 == c1);
             }
 
-            void dispatchChannel( base::ChannelElementBase::shared_ptr chan ) {
+            /**
+             * Queues \a chan for transfer and counts it for the queue
+             * statistics of this dispatcher and of \a peer, if any.
+             */
+            void dispatchChannel( base::ChannelElementBase::shared_ptr chan, CorbaPeerQueue* peer = 0 ) {
                 bool has_element = false;
                 RClist.apply(boost::bind(&CorbaDispatcher::hasElement, _1, chan, boost::ref(has_element)));
-                if (!has_element)
-                    RClist.append( chan );
+                if (!has_element && RClist.append( chan )) {
+                    // statistics only, a lost update is harmless.
+                    mpending.inc();
+                    int pending = mpending.read();
+                    if ( pending > mmax_pending )
+                        mmax_pending = pending;
+                    if ( peer ) {
+                        peer->pending.inc();
+                        pending = peer->pending.read();
+                        if ( pending > peer->max_pending )
+                            peer->max_pending = pending;
+                    }
+                }
                 this->trigger();
             }
 
-            void cancelChannel( base::ChannelElementBase::shared_ptr chan ) {
-                RClist.erase( chan );
+            void cancelChannel( base::ChannelElementBase::shared_ptr chan, CorbaPeerQueue* peer = 0 ) {
+                if ( RClist.erase( chan ) )
+                    dequeued( peer );
+            }
+
+            void dequeued( CorbaPeerQueue* peer ) {
+                mpending.dec();
+                if ( peer )
+                    peer->pending.dec();
             }
 
             bool initialize() {
@@ -208,7 +452,8 @@ namespace RTT {
                     CRemoteChannelElement_i* rbase = dynamic_cast<CRemoteChannelElement_i*>(chan.get());
                     if (rbase)
                         rbase->transferSamples();
-                    RClist.erase( chan );
+                    if ( RClist.erase( chan ) )
+                        dequeued( rbase ? rbase->getPeerQueue() : 0 );
                 }
             }
 
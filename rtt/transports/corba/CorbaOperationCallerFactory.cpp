@@ -39,6 +39,8 @@
 #include "CorbaOperationCallerFactory.hpp"
 #include "AnyDataSource.hpp"
 #include "CorbaLib.hpp"
+#include "CorbaSendDispatcher.hpp"
+#include "OperationInterfaceI.h"
 
 #include "../../types/Types.hpp"
 #include "../../internal/DataSources.hpp"
@@ -257,7 +259,17 @@ public:
                     return mctt->updateFromAny(&any.in(), mresult);
             } else {
                 if (!moneway) {
-                    CSendHandle_var sh = mfact->sendOperation( mop.c_str(), nargs.in() );
+                    // The dispatcher sends the operation, the caller only gets a local
+                    // handle, which the dispatcher activated and the results are delivered to.
+                    CorbaSendDispatcher* dispatcher = CorbaSendDispatcher::Instance();
+                    RTT_corba_CAsyncSendHandle_i* ash = dispatcher->acquire();
+                    ash->prepare( mfact.in(), mop, nargs.in() );
+                    CSendHandle_var sh = ash->reference();
+                    if ( !dispatcher->send( ash ) ) {
+                        log(Error) << "Sending the '" << mop << "' operation failed: too many pending sends." << endlog();
+                        ash->fail( CSendFailure );
+                        ash->_remove_ref(); // the POA keeps it until it is disposed.
+                    }
                     AssignableDataSource<CSendHandle_var>::shared_ptr ads = AssignableDataSource<CSendHandle_var>::narrow( mresult.get() );
                     if (ads) {
                         ads->set( sh ); // _var creates a copy of the obj reference.
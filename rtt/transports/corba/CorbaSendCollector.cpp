@@ -0,0 +1,136 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#include "CorbaSendCollector.hpp"
+#include "OperationInterfaceI.h"
+#include "../../Activity.hpp"
+#include "../../os/MutexLock.hpp"
+#include "../../Logger.hpp"
+
+namespace RTT {
+    using namespace corba;
+
+    CorbaSendCollector* CorbaSendCollector::CollectI = 0;
+    RTT_CORBA_API os::Mutex* CorbaSendCollector::mcreate = 0;
+
+    CorbaSendCollector::CorbaSendCollector()
+        : mact( new Activity(ORO_SCHED_OTHER, os::LowestPriority, 0.0, 0, this, "CorbaSendCollector") )
+    {
+        mact->start();
+    }
+
+    CorbaSendCollector::~CorbaSendCollector() {
+        mact->stop();
+        mact.reset();
+        // the remote handles would wait forever.
+        {
+            os::MutexLock lock(mlock);
+            mpending.insert( mpending.end(), mnew.begin(), mnew.end() );
+            mnew.clear();
+        }
+        for (PendingList::iterator it = mpending.begin(); it != mpending.end(); ++it) {
+            try {
+                it->callback->done( CCollectFailure, CAnyArguments(), "" );
+            } catch ( CORBA::Exception& ) {}
+            it->handle->_remove_ref();
+        }
+    }
+
+    CorbaSendCollector* CorbaSendCollector::Instance() {
+        if (!mcreate)
+            mcreate = new os::Mutex();
+        if ( CollectI == 0 ) {
+            os::MutexLock lock(*mcreate);
+            // re-try to find (avoid race):
+            if ( CollectI == 0 )
+                CollectI = new CorbaSendCollector();
+        }
+        return CollectI;
+    }
+
+    void CorbaSendCollector::ReleaseAll() {
+        delete CollectI;
+        CollectI = 0;
+        delete mcreate;
+        mcreate = 0;
+    }
+
+    void CorbaSendCollector::watch(RTT_corba_CSendHandle_i* handle, CAsyncSendHandle_ptr callback, std::string const& operation) {
+        Pending p;
+        p.handle = handle;
+        p.callback = CAsyncSendHandle::_duplicate(callback);
+        p.operation = operation;
+        {
+            os::MutexLock lock(mlock);
+            mnew.push_back(p);
+        }
+        mact->trigger();
+    }
+
+    void CorbaSendCollector::deliver(Pending& p, CSendStatus status, CAnyArguments_var& results, std::string const& error) {
+        try {
+            if ( results.ptr() )
+                p.callback->done( status, results.in(), error.c_str() );
+            else
+                p.callback->done( status, CAnyArguments(), error.c_str() );
+        } catch ( CORBA::Exception& e ) {
+            log(Error) << "Returning the results of the '" << p.operation << "' operation failed: " << CORBA_EXCEPTION_INFO(e) << endlog();
+        }
+    }
+
+    void CorbaSendCollector::work(base::RunnableInterface::WorkReason reason) {
+        // the owners return the operations that completed to this engine.
+        ExecutionEngine::work(reason);
+        {
+            os::MutexLock lock(mlock);
+            mpending.insert( mpending.end(), mnew.begin(), mnew.end() );
+            mnew.clear();
+        }
+        PendingList::iterator it = mpending.begin();
+        while ( it != mpending.end() ) {
+            CSendStatus status;
+            CAnyArguments_var results;
+            std::string error;
+            try {
+                status = it->handle->collectIfDone( results.out() );
+            } catch ( CCallError& e ) {
+                status = CCollectFailure;
+                error = e.what.in();
+            }
+            if ( status == CSendNotReady ) {
+                ++it;
+                continue;
+            }
+            deliver( *it, status, results, error );
+            it->handle->_remove_ref(); // Drop the CSendHandle
+            it = mpending.erase(it);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#ifndef ORO_CORBA_SEND_COLLECTOR_HPP
+#define ORO_CORBA_SEND_COLLECTOR_HPP
+
+#include "rtt-corba-config.h"
+#include "corba.h"
+#include "OperationInterfaceC.h"
+#include "../../ExecutionEngine.hpp"
+#include "../../os/Mutex.hpp"
+#include <boost/shared_ptr.hpp>
+#include <string>
+#include <vector>
+
+class RTT_corba_CSendHandle_i;
+
+namespace RTT {
+    namespace corba {
+        /**
+         * This engine is the caller of the operations which remote
+         * services send with COperationInterface::sendOperationCallback().
+         * The owner of an operation returns it to this engine when it
+         * completed, after which this engine delivers the results to the
+         * remote handle. Hence the ORB upcall returns as soon as the
+         * operation was sent and no thread waits for an operation.
+         */
+        class CorbaSendCollector : public ExecutionEngine
+        {
+            struct Pending {
+                RTT_corba_CSendHandle_i* handle;
+                CAsyncSendHandle_var callback;
+                std::string operation;
+            };
+            typedef std::vector<Pending> PendingList;
+
+            /**
+             * The sends which watch() added, guarded by mlock.
+             */
+            PendingList mnew;
+            os::Mutex mlock;
+
+            /**
+             * The sends that did not complete yet. Only the
+             * thread of this engine accesses it.
+             */
+            PendingList mpending;
+
+            boost::shared_ptr<base::ActivityInterface> mact;
+
+            RTT_CORBA_API static CorbaSendCollector* CollectI;
+
+            RTT_CORBA_API static os::Mutex* mcreate;
+
+            CorbaSendCollector();
+
+            ~CorbaSendCollector();
+
+            /**
+             * Delivers the results of \a p to its remote handle.
+             */
+            static void deliver(Pending& p, CSendStatus status, CAnyArguments_var& results, std::string const& error);
+
+        public:
+            /**
+             * Returns the collector, which is created on the first call.
+             */
+            static CorbaSendCollector* Instance();
+
+            /**
+             * May be called during program termination to clean up all resources.
+             */
+            static void ReleaseAll();
+
+            /**
+             * Delivers the results of \a handle to \a callback as soon as
+             * the \a operation it sent completed. Takes over the caller's
+             * reference to \a handle.
+             */
+            void watch(RTT_corba_CSendHandle_i* handle, CAsyncSendHandle_ptr callback, std::string const& operation);
+
+            /**
+             * Processes the returned operations, then delivers
+             * the results of those that completed.
+             */
+            virtual void work(base::RunnableInterface::WorkReason reason);
+        };
+    }
+}
+#endif
@@ -0,0 +1,156 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "CorbaSendDispatcher.hpp"
+#include "OperationInterfaceI.h"
+#include "../../os/MutexLock.hpp"
+#include "../../Logger.hpp"
+
+namespace RTT {
+    using namespace corba;
+
+    CorbaSendDispatcher* CorbaSendDispatcher::DispatchI = 0;
+    RTT_CORBA_API os::Mutex* CorbaSendDispatcher::mlock = 0;
+
+    CorbaSendDispatcher::CorbaSendDispatcher(unsigned int queue_size)
+        : Activity(ORO_SCHED_RT, os::LowestPriority, 0.0, 0, "CorbaSendDispatcher"),
+          mqueue(queue_size),
+          mspares(SpareHandles)
+    {
+    }
+
+    CorbaSendDispatcher::~CorbaSendDispatcher() {
+        this->stop();
+        // fail what was never sent.
+        RTT_corba_CAsyncSendHandle_i* handle;
+        while ( mqueue.dequeue(handle) ) {
+            handle->fail(CSendFailure);
+            handle->_remove_ref();
+        }
+        while ( mspares.dequeue(handle) ) {
+            try {
+                handle->dispose();
+            } catch ( CORBA::Exception& ) {}
+            handle->_remove_ref();
+        }
+    }
+
+    CorbaSendDispatcher* CorbaSendDispatcher::Instance() {
+        if (!mlock)
+            mlock = new os::Mutex();
+        if ( DispatchI == 0 ) {
+            os::MutexLock lock(*mlock);
+            // re-try to find (avoid race):
+            if ( DispatchI == 0 ) {
+                CorbaSendDispatcher* dispatcher = new CorbaSendDispatcher(DefaultQueueSize);
+                dispatcher->start();
+                DispatchI = dispatcher;
+            }
+        }
+        return DispatchI;
+    }
+
+    void CorbaSendDispatcher::ReleaseAll() {
+        delete DispatchI;
+        DispatchI = 0;
+        delete mlock;
+        mlock = 0;
+    }
+
+    RTT_corba_CAsyncSendHandle_i* CorbaSendDispatcher::newHandle() {
+        RTT_corba_CAsyncSendHandle_i* handle = new RTT_corba_CAsyncSendHandle_i();
+        handle->activate();
+        return handle;
+    }
+
+    void CorbaSendDispatcher::refill() {
+        while ( !mspares.isFull() ) {
+            RTT_corba_CAsyncSendHandle_i* handle = newHandle();
+            if ( !mspares.enqueue(handle) ) {
+                try {
+                    handle->dispose();
+                } catch ( CORBA::Exception& ) {}
+                handle->_remove_ref();
+                return;
+            }
+        }
+    }
+
+    RTT_corba_CAsyncSendHandle_i* CorbaSendDispatcher::acquire() {
+        RTT_corba_CAsyncSendHandle_i* handle;
+        if ( mspares.dequeue(handle) ) {
+            this->trigger(); // refill
+            return handle;
+        }
+        return newHandle();
+    }
+
+    bool CorbaSendDispatcher::send(RTT_corba_CAsyncSendHandle_i* handle) {
+        if ( !mqueue.enqueue(handle) )
+            return false;
+        this->trigger();
+        return true;
+    }
+
+    bool CorbaSendDispatcher::initialize() {
+        log(Info) <<"Started " << this->getName() << "." <<endlog();
+        refill();
+        return true;
+    }
+
+    bool CorbaSendDispatcher::isLegacy(COperationInterface_ptr service) const {
+        for (LegacyServices::const_iterator it = mlegacy.begin(); it != mlegacy.end(); ++it) {
+            try {
+                if ( (*it)->_is_equivalent(service) )
+                    return true;
+            } catch ( CORBA::Exception& ) {}
+        }
+        return false;
+    }
+
+    void CorbaSendDispatcher::loop() {
+        RTT_corba_CAsyncSendHandle_i* handle;
+        while ( mqueue.dequeue(handle) ) {
+            if ( isLegacy( handle->service() ) ) {
+                handle->sendRemoteLegacy();
+            } else {
+                try {
+                    // the remote service calls done() on the handle, which the POA keeps alive.
+                    handle->sendRemote();
+                } catch ( CORBA::BAD_OPERATION& ) {
+                    log(Info) << "Remote service does not deliver the results of sent operations, collecting them from it." << endlog();
+                    mlegacy.push_back( COperationInterface::_duplicate( handle->service() ) );
+                    handle->sendRemoteLegacy();
+                }
+            }
+            handle->_remove_ref();
+        }
+        refill();
+    }
+}
@@ -0,0 +1,151 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef ORO_CORBA_SEND_DISPATCHER_HPP
+#define ORO_CORBA_SEND_DISPATCHER_HPP
+
+#include "rtt-corba-config.h"
+#include "corba.h"
+#include "../../os/Mutex.hpp"
+#include "../../Activity.hpp"
+#include "../../internal/AtomicMWSRQueue.hpp"
+#include "../../internal/AtomicMWMRQueue.hpp"
+#include "OperationInterfaceC.h"
+#include <vector>
+
+class RTT_corba_CAsyncSendHandle_i;
+
+namespace RTT {
+    namespace corba {
+        /**
+         * This object sends operations to remote services on behalf
+         * of the threads that send() them, such that these threads
+         * never wait for the network. The remote service delivers the
+         * results to the local handle with a oneway call when the
+         * operation completed, so an operation which takes long, or
+         * which sends an operation back to this process, does not hold
+         * up the others and nobody polls for results.
+         *
+         * The dispatcher thread also activates the handles in advance,
+         * such that the sending threads do not enter the POA.
+         *
+         * Remote services which predate sendOperationCallback() get
+         * the operation with sendOperation(), and the handle collects
+         * the results from the remote handle. Which services those are
+         * is found out once, by the first send to them.
+         */
+        class CorbaSendDispatcher : public Activity
+        {
+            typedef internal::AtomicMWSRQueue<RTT_corba_CAsyncSendHandle_i*> SendQueue;
+            SendQueue mqueue;
+
+            /**
+             * Activated handles, which acquire() hands out. Only the
+             * dispatcher thread adds to it.
+             */
+            typedef internal::AtomicMWMRQueue<RTT_corba_CAsyncSendHandle_i*> SpareQueue;
+            SpareQueue mspares;
+
+            /**
+             * The remote services which do not know
+             * sendOperationCallback(). Only the dispatcher thread
+             * accesses it.
+             */
+            typedef std::vector<COperationInterface_var> LegacyServices;
+            LegacyServices mlegacy;
+
+            /**
+             * Returns true if \a service is in mlegacy.
+             */
+            bool isLegacy(COperationInterface_ptr service) const;
+
+            /**
+             * Creates and activates a handle.
+             */
+            static RTT_corba_CAsyncSendHandle_i* newHandle();
+
+            /**
+             * Activates handles until mspares is full.
+             */
+            void refill();
+
+            RTT_CORBA_API static CorbaSendDispatcher* DispatchI;
+
+            RTT_CORBA_API static os::Mutex* mlock;
+
+            CorbaSendDispatcher(unsigned int queue_size);
+
+            ~CorbaSendDispatcher();
+
+        public:
+            /**
+             * The number of sends that may be waiting for the dispatcher.
+             * When it is exceeded, send() fails.
+             */
+            enum { DefaultQueueSize = 128 };
+
+            /**
+             * The number of activated handles kept in advance.
+             */
+            enum { SpareHandles = 16 };
+
+            /**
+             * Returns the dispatcher, which is created on the first call.
+             * This method only locks and allocates when the dispatcher
+             * must be created.
+             */
+            static CorbaSendDispatcher* Instance();
+
+            /**
+             * May be called during program termination to clean up all resources.
+             */
+            static void ReleaseAll();
+
+            /**
+             * Returns an activated handle, which the caller owns one
+             * reference of. Only if the dispatcher thread did not
+             * keep up, the handle is created and activated here.
+             */
+            RTT_corba_CAsyncSendHandle_i* acquire();
+
+            /**
+             * Queues \a handle such that it is sent by the dispatcher
+             * thread, which takes over the caller's reference. Never blocks.
+             * @return false if the queue is full. The caller keeps its
+             * reference in that case.
+             */
+            bool send(RTT_corba_CAsyncSendHandle_i* handle);
+
+            bool initialize();
+
+            void loop();
+        };
+    }
+}
+#endif
@@ -336,6 +336,23 @@ CChannelElement_ptr CDataFlowInterface_i::buildChannelOutput(
           ,::RTT::corba::CNoSuchPortException
           ,::RTT::corba::CInvalidArgument
         ))
+{
+    return buildChannelOutput(port_name, corba_policy, toRTT(corba_policy));
+}
+
+CChannelElement_ptr CDataFlowInterface_i::buildChannelOutputExtras(
+        const char* port_name, CConnPolicy & corba_policy, const CConnPolicyExtras& extras) ACE_THROW_SPEC ((
+          CORBA::SystemException
+          ,::RTT::corba::CNoCorbaTransport
+          ,::RTT::corba::CNoSuchPortException
+          ,::RTT::corba::CInvalidArgument
+        ))
+{
+    return buildChannelOutput(port_name, corba_policy, toRTT(corba_policy, extras));
+}
+
+CChannelElement_ptr CDataFlowInterface_i::buildChannelOutput(
+        const char* port_name, CConnPolicy & corba_policy, ConnPolicy const& policy)
 {
     Logger::In in("CDataFlowInterface_i::buildChannelOutput");
     InputPortInterface* port = dynamic_cast<InputPortInterface*>(mdf->getPort(port_name));
@@ -352,8 +369,7 @@ CChannelElement_ptr CDataFlowInterface_i::buildChannelOutput(
         throw CNoCorbaTransport();
 
     CORBA_CHECK_THREAD();
-    // Convert to RTT policy.
-    ConnPolicy policy2 = toRTT(corba_policy);
+    ConnPolicy policy2 = policy;
 
     // For shared push connections, also build or check the local shared connection instance here
     ChannelElementBase::shared_ptr end;
@@ -49,6 +49,8 @@
 #include "../../internal/DataSources.hpp"
 #include "CorbaTypeTransporter.hpp"
 #include <list>
+#include <string>
+#include <boost/shared_ptr.hpp>
 #include <rtt/os/Mutex.hpp>
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
@@ -60,6 +62,7 @@ namespace RTT {
 
     namespace corba {
         class CDataFlowInterface_i;
+        struct CorbaPeerQueue;
 
         /**
          * Base class for CORBA channel servers.
@@ -75,6 +78,11 @@ namespace RTT {
             RTT::corba::CorbaTypeTransporter const& transport;
             PortableServer::POA_var mpoa;
             CDataFlowInterface_i* mdataflow;
+            /**
+             * Counts the channels to the same peer which wait in the
+             * CorbaDispatcher, see setPeer().
+             */
+            boost::shared_ptr<CorbaPeerQueue> mpeer;
 
         public:
             // standard constructor
@@ -94,6 +102,18 @@ namespace RTT {
                 mdataflow = dataflow;
             }
 
+            /**
+             * Tells which peer this channel sends to, before setRemoteSide().
+             * All channels with the same \a key share a dispatcher and their
+             * queue statistics, which are reported under \a name.
+             * Without a peer, the channel is keyed by its remote side.
+             */
+            virtual void setPeer(CORBA::ULong key, std::string const& name) {}
+
+            CorbaPeerQueue* getPeerQueue() const {
+                return mpeer.get();
+            }
+
             PortableServer::POA_ptr _default_POA();
 
             void setRemoteSide(CRemoteChannelElement_ptr remote) ACE_THROW_SPEC ((
@@ -134,6 +154,12 @@ namespace RTT {
             ChannelList channel_list;
             // Lock that should be taken before access to channel_list
             RTT::os::Mutex channel_list_mtx;
+
+            /**
+             * Implements buildChannelOutput() and buildChannelOutputExtras(),
+             * with \a policy converted from \a corba_policy and its extras.
+             */
+            CChannelElement_ptr buildChannelOutput(const char* input_port, RTT::corba::CConnPolicy& corba_policy, ConnPolicy const& policy);
         public:
             // standard constructor
             CDataFlowInterface_i(DataFlowInterface* interface, PortableServer::POA_ptr poa);
@@ -194,6 +220,13 @@ namespace RTT {
                       ,::RTT::corba::CInvalidArgument
                     ));
 
+            CChannelElement_ptr buildChannelOutputExtras(const char* input_port, RTT::corba::CConnPolicy& policy, const RTT::corba::CConnPolicyExtras& extras) ACE_THROW_SPEC ((
+                      CORBA::SystemException
+                      ,::RTT::corba::CNoCorbaTransport
+                      ,::RTT::corba::CNoSuchPortException
+                      ,::RTT::corba::CInvalidArgument
+                    ));
+
             CChannelElement_ptr buildChannelInput(const char* output_port, RTT::corba::CConnPolicy& policy) ACE_THROW_SPEC ((
                       CORBA::SystemException
                       ,::RTT::corba::CNoCorbaTransport
@@ -0,0 +1,214 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_CORBA_OCTET_CONVERSION_HPP
+#define ORO_CORBA_OCTET_CONVERSION_HPP
+
+#include "corba.h"
+#include "DataFlowC.h"
+#include "../../internal/DataSourceTypeInfo.hpp"
+#include "../../types/TypeInfo.hpp"
+#include <boost/serialization/is_bitwise_serializable.hpp>
+#include <boost/mpl/bool.hpp>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace RTT {
+  namespace corba {
+
+    /**
+     * Returns a string which identifies the byte order of this host.
+     */
+    inline const char* octetByteOrder() {
+      const unsigned short one = 1;
+      return *reinterpret_cast<const unsigned char*>(&one) == 1 ? "le" : "be";
+    }
+
+    /**
+     * Returns the encoding of a sample of type \a T, made of the name under
+     * which T is registered in the type system, \a size and the byte order.
+     * The name is the same in all processes which load the same typekits,
+     * unlike the mangled name of the compiler.
+     * @return an empty string if T is not registered.
+     */
+    template<class T>
+    std::string octetEncoding(std::size_t size) {
+      const types::TypeInfo* ti = internal::DataSourceTypeInfo<T>::getTypeInfo();
+      if ( ti == 0 || ti == internal::DataSourceTypeInfo<internal::UnknownType>::getTypeInfo() )
+        return std::string();
+      std::ostringstream enc;
+      enc << ti->getTypeName() << "/" << size << "/" << octetByteOrder();
+      return enc.str();
+    }
+
+    /**
+     * Converts bitwise serializable types, and vectors of them, from
+     * and to the raw octets of their memory, which avoids the
+     * conversion through a CORBA::Any. Both sides of a connection
+     * must agree on the encoding() before exchanging octets, so only
+     * types registered in the type system are converted.
+     * @param Type is the Standard C++ type which is used throughout your
+     * application. It is bitwise serializable if
+     * boost::serialization::is_bitwise_serializable<Type> is true.
+     */
+    template<class Type>
+    struct OctetConversion
+    {
+      typedef boost::mpl::bool_< boost::serialization::is_bitwise_serializable<Type>::value > is_bitwise;
+
+      /**
+       * Returns an identification of the memory layout of Type,
+       * or an empty string if Type can not be converted to octets.
+       * @see octetEncoding()
+       */
+      static std::string encoding() {
+        return encoding( is_bitwise() );
+      }
+
+      /**
+       * Lets \a cb refer to the memory of \a tp, without copying it.
+       * \a tp must not change nor be destroyed as long as \a cb refers to it.
+       */
+      static bool toOctets(CChannelElement::COctets& cb, const Type& tp) {
+        return toOctets( cb, tp, is_bitwise() );
+      }
+
+      /**
+       * Updates \a tp with the contents of \a cb.
+       * @return false if \a cb has the wrong size.
+       */
+      static bool fromOctets(Type& tp, const CChannelElement::COctets& cb) {
+        return fromOctets( tp, cb, is_bitwise() );
+      }
+
+    private:
+      static std::string encoding(boost::mpl::true_) {
+        return octetEncoding<Type>( sizeof(Type) );
+      }
+
+      static std::string encoding(boost::mpl::false_) {
+        return std::string();
+      }
+
+      static bool toOctets(CChannelElement::COctets& cb, const Type& tp, boost::mpl::true_) {
+        cb.replace( sizeof(Type), sizeof(Type), reinterpret_cast<CORBA::Octet*>( const_cast<Type*>(&tp) ), false );
+        return true;
+      }
+
+      static bool toOctets(CChannelElement::COctets& cb, const Type& tp, boost::mpl::false_) {
+        return false;
+      }
+
+      static bool fromOctets(Type& tp, const CChannelElement::COctets& cb, boost::mpl::true_) {
+        if ( cb.length() != sizeof(Type) )
+          return false;
+        std::memcpy( &tp, cb.get_buffer(), sizeof(Type) );
+        return true;
+      }
+
+      static bool fromOctets(Type& tp, const CChannelElement::COctets& cb, boost::mpl::false_) {
+        return false;
+      }
+    };
+
+    /**
+     * Vectors of bitwise serializable types are sent as the octets of
+     * their elements.
+     */
+    template<class T, class A>
+    struct OctetConversion< std::vector<T, A> >
+    {
+      typedef std::vector<T, A> Type;
+      typedef boost::mpl::false_ is_bitwise;
+      typedef typename OctetConversion<T>::is_bitwise has_bitwise_elements;
+
+      static std::string encoding() {
+        if ( !has_bitwise_elements::value )
+          return std::string();
+        // the vector's own registration, with the size of its elements.
+        std::string enc = octetEncoding<Type>( sizeof(T) );
+        return enc.empty() ? enc : "vector:" + enc;
+      }
+
+      static bool toOctets(CChannelElement::COctets& cb, const Type& tp) {
+        return toOctets( cb, tp, has_bitwise_elements() );
+      }
+
+      static bool fromOctets(Type& tp, const CChannelElement::COctets& cb) {
+        return fromOctets( tp, cb, has_bitwise_elements() );
+      }
+
+    private:
+      static bool toOctets(CChannelElement::COctets& cb, const Type& tp, boost::mpl::true_) {
+        if ( tp.empty() ) {
+          cb.length(0);
+          return true;
+        }
+        CORBA::ULong size = tp.size() * sizeof(T);
+        cb.replace( size, size, reinterpret_cast<CORBA::Octet*>( const_cast<T*>(&tp[0]) ), false );
+        return true;
+      }
+
+      static bool toOctets(CChannelElement::COctets& cb, const Type& tp, boost::mpl::false_) {
+        return false;
+      }
+
+      static bool fromOctets(Type& tp, const CChannelElement::COctets& cb, boost::mpl::true_) {
+        if ( cb.length() % sizeof(T) != 0 )
+          return false;
+        tp.resize( cb.length() / sizeof(T) );
+        if ( !tp.empty() )
+          std::memcpy( &tp[0], cb.get_buffer(), cb.length() );
+        return true;
+      }
+
+      static bool fromOctets(Type& tp, const CChannelElement::COctets& cb, boost::mpl::false_) {
+        return false;
+      }
+    };
+
+    /**
+     * std::vector<bool> does not store its elements as bools, so it
+     * is always sent as an any.
+     */
+    template<class A>
+    struct OctetConversion< std::vector<bool, A> >
+    {
+      typedef std::vector<bool, A> Type;
+      typedef boost::mpl::false_ is_bitwise;
+
+      static std::string encoding() { return std::string(); }
+      static bool toOctets(CChannelElement::COctets& cb, const Type& tp) { return false; }
+      static bool fromOctets(Type& tp, const CChannelElement::COctets& cb) { return false; }
+    };
+  }
+}
+
+#endif
@@ -69,11 +69,13 @@
 #include "CorbaLib.hpp"
 #include "CorbaTypeTransporter.hpp"
 #include "OperationInterfaceI.h"
+#include "CorbaSendCollector.hpp"
 #include "AnyDataSource.hpp"
 #include "../../rtt-detail-fwd.hpp"
 #include "../../internal/OperationCallerC.hpp"
 #include "../../internal/SendHandleC.hpp"
 #include "../../Logger.hpp"
+#include "../../os/MutexLock.hpp"
 #include "../../internal/GlobalEngine.hpp"
 #include "../../plugin/PluginLoader.hpp"
 
@@ -213,6 +215,181 @@ void RTT_corba_CSendHandle_i::dispose (
     return;
 }
 
+RTT_corba_CAsyncSendHandle_i::RTT_corba_CAsyncSendHandle_i (void)
+: mstatus(CSendNotReady)
+{
+}
+
+RTT_corba_CAsyncSendHandle_i::~RTT_corba_CAsyncSendHandle_i (void)
+{
+}
+
+void RTT_corba_CAsyncSendHandle_i::activate()
+{
+    mself = _this();
+}
+
+CSendHandle_ptr RTT_corba_CAsyncSendHandle_i::reference()
+{
+    return CAsyncSendHandle::_duplicate( mself.in() );
+}
+
+void RTT_corba_CAsyncSendHandle_i::prepare(COperationInterface_ptr fact, std::string const& op, CAnyArguments const& args)
+{
+    mfact = COperationInterface::_duplicate(fact);
+    mop = op;
+    margs = args;
+}
+
+bool RTT_corba_CAsyncSendHandle_i::sendRemote()
+{
+    try {
+        mfact->sendOperationCallback( mop.c_str(), margs, mself.in() );
+        return true;
+    } catch ( CORBA::BAD_OPERATION& ) {
+        // an older service, the dispatcher falls back to sendRemoteLegacy().
+        throw;
+    } catch ( CORBA::Exception& e ) {
+        log(Error) << "Sending the '" << mop << "' operation failed: " << CORBA_EXCEPTION_INFO(e) << endlog();
+    }
+    fail( CSendFailure );
+    return false;
+}
+
+bool RTT_corba_CAsyncSendHandle_i::sendRemoteLegacy()
+{
+    try {
+        CSendHandle_var sh = mfact->sendOperation( mop.c_str(), margs );
+        os::MutexLock lock(mlock);
+        mremote = sh._retn();
+        mdone.broadcast();
+        return true;
+    } catch ( CORBA::Exception& e ) {
+        log(Error) << "Sending the '" << mop << "' operation failed: " << CORBA_EXCEPTION_INFO(e) << endlog();
+    }
+    fail( CSendFailure );
+    return false;
+}
+
+CSendHandle_ptr RTT_corba_CAsyncSendHandle_i::remote()
+{
+    os::MutexLock lock(mlock);
+    return CSendHandle::_duplicate( mremote.in() );
+}
+
+void RTT_corba_CAsyncSendHandle_i::done (
+    ::RTT::corba::CSendStatus status,
+    const ::RTT::corba::CAnyArguments & args,
+    const char * error)
+{
+    os::MutexLock lock(mlock);
+    if ( status == CSendSuccess )
+        mresults = args;
+    merror = error;
+    mstatus = status;
+    mdone.broadcast();
+}
+
+void RTT_corba_CAsyncSendHandle_i::fail(CSendStatus status, std::string const& error)
+{
+    os::MutexLock lock(mlock);
+    merror = error;
+    mstatus = status;
+    mdone.broadcast();
+}
+
+::RTT::corba::CSendStatus RTT_corba_CAsyncSendHandle_i::collect (
+    ::RTT::corba::CAnyArguments_out args)
+{
+    CSendHandle_var sh;
+    {
+        os::MutexLock lock(mlock);
+        while ( mstatus == CSendNotReady && CORBA::is_nil( mremote.in() ) )
+            mdone.wait(mlock);
+        sh = CSendHandle::_duplicate( mremote.in() );
+    }
+    if ( !CORBA::is_nil( sh.in() ) )
+        return sh->collect(args);
+    return collectIfDone(args);
+}
+
+::RTT::corba::CSendStatus RTT_corba_CAsyncSendHandle_i::collectIfDone (
+    ::RTT::corba::CAnyArguments_out args)
+{
+    CSendHandle_var sh = remote();
+    if ( !CORBA::is_nil( sh.in() ) )
+        return sh->collectIfDone(args);
+    os::MutexLock lock(mlock);
+    if ( !merror.empty() )
+        throw ::RTT::corba::CCallError( merror.c_str() );
+    if ( mstatus == CSendSuccess )
+        args = new CAnyArguments( mresults );
+    else
+        args = new CAnyArguments();
+    return mstatus;
+}
+
+::RTT::corba::CSendStatus RTT_corba_CAsyncSendHandle_i::checkStatus (
+    void)
+{
+    CSendHandle_var sh = remote();
+    if ( !CORBA::is_nil( sh.in() ) )
+        return sh->checkStatus();
+    os::MutexLock lock(mlock);
+    return mstatus;
+}
+
+::CORBA::Any * RTT_corba_CAsyncSendHandle_i::ret (
+    void)
+{
+    CSendHandle_var sh = remote();
+    if ( !CORBA::is_nil( sh.in() ) )
+        return sh->ret();
+    os::MutexLock lock(mlock);
+    if ( !merror.empty() )
+        throw ::RTT::corba::CCallError( merror.c_str() );
+    // Like RTT_corba_CSendHandle_i, return the first collectable argument.
+    if ( mstatus == CSendSuccess && mresults.length() > 0 )
+        return new CORBA::Any( mresults[0] );
+    return new CORBA::Any();
+}
+
+void RTT_corba_CAsyncSendHandle_i::checkArguments (
+    const ::RTT::corba::CAnyArguments & args)
+{
+    CSendHandle_var sh = remote();
+    if ( !CORBA::is_nil( sh.in() ) ) {
+        sh->checkArguments(args);
+        return;
+    }
+    // The remote handle does not exist yet, so only the number of
+    // arguments can be checked here. collect() reports wrong types.
+    CORBA::ULong arity = 0;
+    try {
+        arity = mfact->getCollectArity( mop.c_str() );
+    } catch ( CNoSuchNameException& ) {
+        // sending failed too, collect() reports it.
+        return;
+    }
+    if ( args.length() != arity )
+        throw ::RTT::corba::CWrongNumbArgException( arity, args.length() );
+}
+
+void RTT_corba_CAsyncSendHandle_i::dispose (
+    void)
+{
+    CSendHandle_var sh = remote();
+    if ( !CORBA::is_nil( sh.in() ) ) {
+        try {
+            sh->dispose();
+        } catch ( CORBA::Exception& ) {}
+    }
+    PortableServer::POA_var mPOA = _default_POA();
+    PortableServer::ObjectId_var oid = mPOA->servant_to_id(this);
+    mPOA->deactivate_object( oid.in() );
+    return;
+}
+
 // Implementation skeleton constructor
 RTT_corba_COperationInterface_i::RTT_corba_COperationInterface_i (OperationInterface* gmf, PortableServer::POA_ptr the_poa)
     : mfact(gmf), mpoa( PortableServer::POA::_duplicate(the_poa)),
@@ -435,14 +612,15 @@ void RTT_corba_COperationInterface_i::checkOperation (
 
 RTT_corba_CSendHandle_i* RTT_corba_COperationInterface_i::sendOperationInternal (
     const char * operation,
-    const ::RTT::corba::CAnyArguments & args)
+    const ::RTT::corba::CAnyArguments & args,
+    ExecutionEngine* caller)
 {
     // This implementation is 90% identical to callOperation above, only deviating in the orig.ready() part.
     OperationInterfacePart* mofp = findOperation(operation);
 
     // convert Corba args to C++ args.
     try {
-        OperationCallerC orig(mofp, operation, internal::GlobalEngine::Instance());
+        OperationCallerC orig(mofp, operation, caller);
         for (size_t i =0; i != args.length(); ++i) {
             const TypeInfo* ti = mofp->getArgumentType( i + 1);
             CorbaTypeTransporter* ctt = dynamic_cast<CorbaTypeTransporter*> ( ti->getProtocol(ORO_CORBA_PROTOCOL_ID) );
@@ -473,7 +651,7 @@ RTT_corba_CSendHandle_i* RTT_corba_COperationInterface_i::sendOperationInternal
     const char * operation,
     const ::RTT::corba::CAnyArguments & args)
 {
-    RTT_corba_CSendHandle_i* ret_i = sendOperationInternal(operation, args);
+    RTT_corba_CSendHandle_i* ret_i = sendOperationInternal(operation, args, internal::GlobalEngine::Instance());
     if (ret_i) {
         // our resulthandle copy makes sure that the resulthandle can return.
         CSendHandle_var ret = ret_i->_this();
@@ -491,7 +669,7 @@ void RTT_corba_COperationInterface_i::sendOperationOneway (
     RTT_corba_CSendHandle_i* ret_i = 0;
 
     try {
-        ret_i = sendOperationInternal(operation, args);
+        ret_i = sendOperationInternal(operation, args, internal::GlobalEngine::Instance());
 
         if (!ret_i || ret_i->checkStatus() == CSendFailure) {
             log(Error) << "Sending the '" << operation << "'' operation failed (SendFailure)." << endlog();
@@ -503,6 +681,35 @@ void RTT_corba_COperationInterface_i::sendOperationOneway (
     if (ret_i) ret_i->_remove_ref(); // Drop the CSendHandle
 }
 
+void RTT_corba_COperationInterface_i::sendOperationCallback (
+    const char * operation,
+    const ::RTT::corba::CAnyArguments & args,
+    ::RTT::corba::CAsyncSendHandle_ptr handle)
+{
+    RTT_corba_CSendHandle_i* ret_i = 0;
+
+    try {
+        // the collector is the caller, such that the owner returns the
+        // operation to it when it completed. This upcall does not wait.
+        CorbaSendCollector* collector = CorbaSendCollector::Instance();
+        ret_i = sendOperationInternal(operation, args, collector);
+        if (ret_i) {
+            collector->watch( ret_i, handle, operation );
+            return;
+        }
+    } catch ( CORBA::Exception& e ) {
+        log(Error) << "Sending the '" << operation << "' operation failed: " << CORBA_EXCEPTION_INFO(e) << endlog();
+    } catch ( std::exception& e ) {
+        log(Error) << "Sending the '" << operation << "' operation failed: " << e.what() << endlog();
+    }
+
+    try {
+        handle->done( CSendFailure, CAnyArguments(), "" );
+    } catch ( CORBA::Exception& e ) {
+        log(Error) << "Returning the results of the '" << operation << "' operation failed: " << CORBA_EXCEPTION_INFO(e) << endlog();
+    }
+}
+
 RTT::OperationInterfacePart *RTT_corba_COperationInterface_i::findOperation( const char *operation )
 {
     string operation_str(operation);
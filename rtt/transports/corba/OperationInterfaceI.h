@@ -78,6 +78,8 @@
 #include "../../OperationInterface.hpp"
 #include "../../internal/SendHandleC.hpp"
 #include "../../internal/OperationInterfacePartFused.hpp"
+#include "../../os/Mutex.hpp"
+#include "../../os/Condition.hpp"
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 #pragma once
@@ -121,6 +123,117 @@ public:
   void dispose ();
 };
 
+/**
+ * A local CSendHandle for an operation sent to a remote COperationInterface.
+ * The CorbaSendDispatcher activates it and sends the operation with
+ * sendOperationCallback() in its own thread. The remote service calls
+ * done() when the operation completed, such that collectIfDone() only
+ * checks local state and nobody waits for, nor polls, the network.
+ *
+ * A remote service which does not know sendOperationCallback() gets
+ * the operation with sendOperation() instead, after which this handle
+ * forwards to the remote CSendHandle.
+ */
+class  RTT_corba_CAsyncSendHandle_i
+  : public virtual POA_RTT::corba::CAsyncSendHandle,
+  public virtual PortableServer::RefCountServantBase
+{
+      RTT::corba::COperationInterface_var mfact;
+      std::string mop;
+      RTT::corba::CAnyArguments margs;
+      RTT::corba::CAsyncSendHandle_var mself;
+      RTT::corba::CSendHandle_var mremote;
+      RTT::corba::CAnyArguments mresults;
+      RTT::corba::CSendStatus mstatus;
+      std::string merror;
+      RTT::os::Mutex mlock;
+      RTT::os::Condition mdone;
+
+      /**
+       * Returns a new reference to the remote handle
+       * sendRemoteLegacy() got, or nil.
+       */
+      RTT::corba::CSendHandle_ptr remote();
+public:
+  // Constructor
+  RTT_corba_CAsyncSendHandle_i (void);
+
+  // Destructor
+  virtual ~RTT_corba_CAsyncSendHandle_i (void);
+
+  /**
+   * Activates this servant in its POA. Called by the CorbaSendDispatcher,
+   * before the handle is handed out.
+   */
+  void activate();
+
+  /**
+   * Returns a new reference to this activated servant.
+   */
+  RTT::corba::CSendHandle_ptr reference();
+
+  /**
+   * Sets the operation which sendRemote() sends.
+   */
+  void prepare(RTT::corba::COperationInterface_ptr fact, std::string const& op, RTT::corba::CAnyArguments const& args);
+
+  /**
+   * Returns the service which sendRemote() sends to.
+   */
+  RTT::corba::COperationInterface_ptr service() const { return mfact.in(); }
+
+  /**
+   * Sends the operation to the remote service, which calls done()
+   * when it completed. Called by the CorbaSendDispatcher.
+   * @return false if sending failed, which completes this handle.
+   * @throw CORBA::BAD_OPERATION if the remote service does not know
+   * sendOperationCallback(). Nothing was sent in that case.
+   */
+  bool sendRemote();
+
+  /**
+   * Sends the operation with sendOperation(), for remote services
+   * which do not know sendOperationCallback(). This handle then
+   * forwards to the remote handle.
+   * @return false if sending failed, which completes this handle.
+   */
+  bool sendRemoteLegacy();
+
+  /**
+   * Completes this handle with \a status without sending the operation.
+   */
+  void fail(RTT::corba::CSendStatus status, std::string const& error = std::string());
+
+  virtual
+  ::RTT::corba::CSendStatus collect (
+      ::RTT::corba::CAnyArguments_out args);
+
+  virtual
+  ::RTT::corba::CSendStatus collectIfDone (
+      ::RTT::corba::CAnyArguments_out args);
+
+  virtual
+  ::RTT::corba::CSendStatus checkStatus (
+      void);
+
+  virtual
+  ::CORBA::Any * ret (
+      void);
+
+  virtual
+  void checkArguments (
+          const ::RTT::corba::CAnyArguments & args);
+
+  virtual
+  void dispose ();
+
+  virtual
+  void done (
+      ::RTT::corba::CSendStatus status,
+      const ::RTT::corba::CAnyArguments & args,
+      const char * error);
+};
+
 class  RTT_corba_COperationInterface_i
   : public virtual POA_RTT::corba::COperationInterface
 {
@@ -194,10 +307,17 @@ class  RTT_corba_COperationInterface_i
       const char * operation,
       const ::RTT::corba::CAnyArguments & args);
 
+  virtual
+  void sendOperationCallback (
+      const char * operation,
+      const ::RTT::corba::CAnyArguments & args,
+      ::RTT::corba::CAsyncSendHandle_ptr handle);
+
 private:
   RTT_corba_CSendHandle_i* sendOperationInternal (
       const char * operation,
-      const ::RTT::corba::CAnyArguments & args);
+      const ::RTT::corba::CAnyArguments & args,
+      RTT::ExecutionEngine* caller);
 
   RTT::OperationInterfacePart *findOperation ( const char *operation );
   bool loadPlugin ( const std::string& pluginPath );
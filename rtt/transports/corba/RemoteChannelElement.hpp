@@ -44,6 +44,8 @@
 #include "CorbaDispatcher.hpp"
 #include "CorbaConnPolicy.hpp"
 #include "ApplicationServer.hpp"
+#include "OctetConversion.hpp"
+#include <boost/scoped_array.hpp>
 
 namespace RTT {
 
@@ -55,6 +57,16 @@ namespace RTT {
      * A read will cause a call to the remote channel (which is of the
      * same type of this RemoteChannelElement) which returns an Any
      * with the data. A similar mechanism is in place for a write.
+     *
+     * In push mode, the dispatcher drains the local buffer and sends the
+     * samples in batches with writeSamples(). A remote side which does not
+     * know channelReadyOctets() at connection setup does not know that
+     * operation either and gets them one by one.
+     *
+     * If the library is built with PLUGINS_CORBA_OCTET_SAMPLES, bitwise
+     * serializable types, and vectors of them, are sent as raw octets
+     * with writeOctets() instead of as anys if the remote side agrees
+     * with their OctetConversion encoding in channelReadyOctets().
      */
     template<typename T>
     class RemoteChannelElement
@@ -75,6 +87,40 @@ namespace RTT {
 
         ConnPolicy policy;
 
+        /**
+         * True if the remote side answered channelReadyOctets(), which
+         * tells that it implements writeSamples() too.
+         */
+        bool use_batches;
+
+        /**
+         * The maximum number of samples sent in one writeSamples() call.
+         */
+        CORBA::ULong batch_limit;
+
+        /**
+         * The batch limit of connections which do not set ConnPolicy::batch_size.
+         */
+        enum { DefaultBatchLimit = 64 };
+
+        /**
+         * Selects the CorbaDispatcher of msender which serves this
+         * connection. It identifies the peer, such that connections to
+         * different peers can be sent in parallel. Set once in setPeer(),
+         * or to the hash of the remote side in setRemoteSide().
+         */
+        CORBA::ULong dispatch_key;
+
+        /**
+         * True if the remote side accepted raw octets in channelReadyOctets().
+         */
+        bool use_octets;
+
+        /**
+         * Holds the samples of a batch of octets, which refer to their memory.
+         */
+        boost::scoped_array<T> octet_values;
+
         public:
             /**
              * Create a channel element for remote data exchange.
@@ -86,6 +132,10 @@ namespace RTT {
             , valid(true)
             , msender(sender)
             , policy(policy)
+            , use_batches(false)
+            , batch_limit(policy.batch_size > 1 ? policy.batch_size : DefaultBatchLimit)
+            , dispatch_key(0)
+            , use_octets(false)
             {
                 // Big note about cleanup: The RTT will dispose this object through
 	            // the ChannelElement<T> refcounting. So we only need to inform the
@@ -112,6 +162,26 @@ namespace RTT {
             { this->deref(); }
 
 
+            void setPeer(CORBA::ULong key, std::string const& name)
+            {
+                dispatch_key = key;
+                mpeer = CorbaDispatcher::Peer(key, name);
+            }
+
+            /**
+             * CORBA IDL function. Hashes the remote side while the
+             * connection is set up, instead of in signal(), if no peer
+             * was set.
+             */
+            void setRemoteSide(CRemoteChannelElement_ptr remote) ACE_THROW_SPEC ((
+                    CORBA::SystemException
+                  ))
+            {
+                CRemoteChannelElement_i::setRemoteSide(remote);
+                if ( !mpeer && !CORBA::is_nil(remote) )
+                    setPeer(remote->_hash(0x7fffffff), std::string());
+            }
+
             /**
              * CORBA IDL function.
              */
@@ -130,7 +200,7 @@ namespace RTT {
                 // Remember that signal() is called in the context of the one
                 // that wrote the data, so we must decouple here to keep hard-RT happy.
                 // the dispatch thread must read the data and send it over by calling transferSample().
-                CorbaDispatcher::Instance(msender)->dispatchChannel( this );
+                CorbaDispatcher::Instance(msender, dispatch_key)->dispatchChannel( this, mpeer.get() );
 
                 return valid;
             }
@@ -159,6 +229,10 @@ namespace RTT {
                         log(Error) << "caught CORBA exception while signalling our remote endpoint: " << e._name() << endlog();
                         valid = false;
                     }
+                } else if ( use_octets ) {
+                    transferOctets();
+                } else if ( use_batches ) {
+                    transferBatches();
                 } else {
                     /** This is used on to read the channel */
                     typename base::ChannelElement<T>::value_t sample;
@@ -175,6 +249,109 @@ namespace RTT {
 
             }
 
+            /**
+             * Drains the local buffer in batches of at most batch_limit samples.
+             */
+            void transferBatches() {
+                typename base::ChannelElement<T>::value_t sample;
+                CChannelElement::CSamples samples;
+                while ( valid ) {
+                    samples.length(batch_limit);
+                    CORBA::ULong count = 0;
+                    while ( count != batch_limit && this->read(sample, false) == NewData ) {
+                        internal::LateConstReferenceDataSource<T> const_ref_data_source(&sample);
+                        const_ref_data_source.ref();
+                        if ( transport.updateAny(&const_ref_data_source, samples[count]) )
+                            ++count;
+                    }
+                    if ( count == 0 )
+                        return;
+                    samples.length(count);
+                    if ( sendSamples(samples) == NotConnected )
+                        valid = false;
+                    if ( count != batch_limit )
+                        return;
+                }
+            }
+
+            /**
+             * Drains the local buffer in batches of at most batch_limit raw samples.
+             * The octets refer to the memory of octet_values, so nothing is copied
+             * before the ORB marshals them.
+             */
+            void transferOctets() {
+                CChannelElement::COctetSamples samples;
+                while ( valid ) {
+                    samples.length(batch_limit);
+                    CORBA::ULong count = 0;
+                    while ( count != batch_limit && this->read(octet_values[count], false) == NewData ) {
+                        if ( OctetConversion<T>::toOctets(samples[count], octet_values[count]) )
+                            ++count;
+                    }
+                    if ( count == 0 )
+                        return;
+                    samples.length(count);
+                    if ( sendOctets(samples, !policy.mandatory) == NotConnected )
+                        valid = false;
+                    if ( count != batch_limit )
+                        return;
+                }
+            }
+
+            /**
+             * Sends \a samples to the remote side, without waiting for the result
+             * if \a oneway is true.
+             */
+            WriteStatus sendOctets(CChannelElement::COctetSamples const& samples, bool oneway) {
+                try
+                {
+                    if ( oneway ) {
+                        remote_side->writeOctetsOneway(samples);
+                        return WriteSuccess;
+                    }
+                    return (WriteStatus)remote_side->writeOctets(samples);
+                }
+#ifdef CORBA_IS_OMNIORB
+                catch(CORBA::SystemException& e)
+                {
+                    log(Error) << "caught CORBA exception while marshalling: " << e._name() << " " << e.NP_minorString() << endlog();
+                    return NotConnected;
+                }
+#endif
+                catch(CORBA::Exception& e)
+                {
+                    log(Error) << "caught CORBA exception while marshalling: " << e._name() << endlog();
+                    return NotConnected;
+                }
+            }
+
+            /**
+             * Sends \a samples to the remote side, which implements
+             * writeSamples(), one way if the connection is not mandatory.
+             */
+            WriteStatus sendSamples(CChannelElement::CSamples const& samples) {
+                try
+                {
+                    if ( !policy.mandatory ) {
+                        remote_side->writeSamplesOneway(samples);
+                        return WriteSuccess;
+                    }
+                    return (WriteStatus)remote_side->writeSamples(samples);
+                }
+#ifdef CORBA_IS_OMNIORB
+                catch(CORBA::SystemException& e)
+                {
+                    log(Error) << "caught CORBA exception while marshalling: " << e._name() << " " << e.NP_minorString() << endlog();
+                    return NotConnected;
+                }
+#endif
+                catch(CORBA::Exception& e)
+                {
+                    log(Error) << "caught CORBA exception while marshalling: " << e._name() << endlog();
+                    return NotConnected;
+                }
+            }
+
             void disconnect() {
                 // disconnect both local and remote side.
                 // !!!THIS RELIES ON BEHAVIOR OF REMOTEDISCONNECT BELOW doing both forward and !forward !!!
@@ -328,6 +505,18 @@ namespace RTT {
 
                 // go through corba
                 assert( remote_side.in() != 0 && "Got write() without remote side. Need buffer OR remote side but neither was present.");
+                if ( use_octets ) {
+                    CChannelElement::COctetSamples samples;
+                    samples.length(1);
+                    if ( !OctetConversion<T>::toOctets(samples[0], sample) )
+                        return WriteFailure;
+#ifndef RTT_CORBA_PORTS_WRITE_ONEWAY
+                    return sendOctets(samples, false);
+#else
+                    return sendOctets(samples, true);
+#endif
+                }
+
                 try
                 {
                     // This is used on the writing side, to avoid allocating an Any for
@@ -391,6 +580,74 @@ namespace RTT {
                 (void) write(sample);
             }
 
+            /**
+             * CORBA IDL function.
+             */
+            CWriteStatus writeSamples(const CChannelElement::CSamples& samples) ACE_THROW_SPEC ((
+                    CORBA::SystemException
+                  ))
+            {
+                typename internal::ValueDataSource<T> value_data_source;
+                value_data_source.ref();
+                WriteStatus result = WriteSuccess;
+                for (CORBA::ULong i = 0; i != samples.length(); ++i) {
+                    if (!transport.updateFromAny(&samples[i], &value_data_source)) {
+                        result = WriteFailure;
+                        continue;
+                    }
+                    WriteStatus fs = base::ChannelElement<T>::write(value_data_source.rvalue());
+                    if (fs == NotConnected)
+                        return CNotConnected;
+                    if (fs != WriteSuccess)
+                        result = fs;
+                }
+                return (CWriteStatus)result;
+            }
+
+            /**
+             * CORBA IDL function.
+             */
+            void writeSamplesOneway(const CChannelElement::CSamples& samples) ACE_THROW_SPEC ((
+                    CORBA::SystemException
+                  ))
+            {
+                (void) writeSamples(samples);
+            }
+
+            /**
+             * CORBA IDL function.
+             */
+            CWriteStatus writeOctets(const CChannelElement::COctetSamples& samples) ACE_THROW_SPEC ((
+                    CORBA::SystemException
+                  ))
+            {
+                typename internal::ValueDataSource<T> value_data_source;
+                value_data_source.ref();
+                WriteStatus result = WriteSuccess;
+                for (CORBA::ULong i = 0; i != samples.length(); ++i) {
+                    if (!OctetConversion<T>::fromOctets(value_data_source.set(), samples[i])) {
+                        result = WriteFailure;
+                        continue;
+                    }
+                    WriteStatus fs = base::ChannelElement<T>::write(value_data_source.rvalue());
+                    if (fs == NotConnected)
+                        return CNotConnected;
+                    if (fs != WriteSuccess)
+                        result = fs;
+                }
+                return (CWriteStatus)result;
+            }
+
+            /**
+             * CORBA IDL function.
+             */
+            void writeOctetsOneway(const CChannelElement::COctetSamples& samples) ACE_THROW_SPEC ((
+                    CORBA::SystemException
+                  ))
+            {
+                (void) writeOctets(samples);
+            }
+
             virtual WriteStatus data_sample(typename base::ChannelElement<T>::param_t sample)
             {
                 // we don't pass it on through CORBA (yet).
@@ -454,6 +711,30 @@ namespace RTT {
 
                 try
                 {
+                    // negotiates the batches and octets once, such that sending never falls back.
+                    try
+                    {
+#ifdef RTT_CORBA_OCTET_SAMPLES
+                        std::string encoding = OctetConversion<T>::encoding();
+#else
+                        // raw octets are only proposed if PLUGINS_CORBA_OCTET_SAMPLES is enabled.
+                        std::string encoding;
+#endif
+                        CORBA::Boolean accepted = false;
+                        bool ready = remote_side->channelReadyOctets(toCORBA(policy), toCORBAExtras(policy), encoding.c_str(), accepted);
+                        use_batches = true;
+                        if ( ready && accepted && !encoding.empty() ) {
+                            octet_values.reset( new T[batch_limit] );
+                            use_octets = true;
+                        }
+                        return ready;
+                    }
+                    catch(CORBA::BAD_OPERATION&)
+                    {
+                        // the remote side was built without channelReadyOctets() and writeSamples(),
+                        // it only gets the policy fields which CConnPolicy has.
+                        log(Debug) << "remote channel does not support batches or octet samples, sending anys one by one." << endlog();
+                    }
                     return remote_side->channelReady(toCORBA(policy));
                 }
 #ifdef CORBA_IS_OMNIORB
@@ -481,6 +762,23 @@ namespace RTT {
                 return base::ChannelElement<T>::channelReady(this, policy);
             }
 
+            /**
+             * CORBA IDL function.
+             */
+            virtual bool channelReadyOctets(const CConnPolicy& cp, const CConnPolicyExtras& extras, const char* encoding, CORBA::Boolean_out accepted) ACE_THROW_SPEC ((
+                    CORBA::SystemException
+                ))
+            {
+#ifdef RTT_CORBA_OCTET_SAMPLES
+                std::string own = OctetConversion<T>::encoding();
+                accepted = !own.empty() && own == encoding;
+#else
+                accepted = false;
+#endif
+                ConnPolicy policy = toRTT(cp, extras);
+                return base::ChannelElement<T>::channelReady(this, policy);
+            }
+
             virtual bool isRemoteElement() const
             {
                 return true;
@@ -40,6 +40,7 @@
 #include "CorbaTypeTransporter.hpp"
 #include "DataFlowI.h"
 #include "../../DataFlowInterface.hpp"
+#include "../../TaskContext.hpp"
 #include <cassert>
 #include "CorbaConnPolicy.hpp"
 #include "CorbaLib.hpp"
@@ -134,7 +135,16 @@ RTT::base::ChannelElementBase::shared_ptr RemoteInputPort::buildRemoteChannelOut
     RTT::base::ChannelElementBase::shared_ptr buf;
     try {
         CConnPolicy cpolicy = toCORBA(policy);
-        CChannelElement_var ret = dataflow->buildChannelOutput(getName().c_str(), cpolicy);
+        CChannelElement_var ret;
+        try {
+            ret = dataflow->buildChannelOutputExtras(getName().c_str(), cpolicy, toCORBAExtras(policy));
+        }
+        catch(CORBA::BAD_OPERATION&)
+        {
+            // the remote side only knows the policy fields of CConnPolicy.
+            log(Debug) << "remote data flow interface does not support the policy extras, building the connection without them." << endlog();
+            ret = dataflow->buildChannelOutput(getName().c_str(), cpolicy);
+        }
         if ( CORBA::is_nil(ret) ) {
             return 0;
         }
@@ -156,6 +166,11 @@ RTT::base::ChannelElementBase::shared_ptr RemoteInputPort::buildRemoteChannelOut
                             ->createChannelElement_i(output_port.getInterface(), mpoa, policy);
 
     CRemoteChannelElement_var proxy = local->_this();
+    // all connections to the peer's interface share a dispatcher and its statistics.
+    std::string peer;
+    if ( getInterface() && getInterface()->getOwner() )
+        peer = getInterface()->getOwner()->getName();
+    local->setPeer(dataflow->_hash(0x7fffffff), peer);
     local->setRemoteSide(remote);
     remote->setRemoteSide(proxy.in());
     local->_remove_ref();
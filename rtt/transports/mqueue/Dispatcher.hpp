@@ -41,10 +41,24 @@
 #include "../../Activity.hpp"
 #include "../../base/ChannelElementBase.hpp"
 #include "../../Logger.hpp"
+#include "../../os/TimeService.hpp"
+#include "MQSendRecv.hpp"
+#include <algorithm>
 #include <map>
-#include <sys/select.h>
+#include <set>
+#include <vector>
 #include <mqueue.h>
 
+#if defined(OROCOS_TARGET_GNULINUX)
+// On plain Linux, a mqd_t is a file descriptor which epoll can watch.
+#define ORO_MQUEUE_DISPATCHER_EPOLL
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#else
+#include <sys/select.h>
+#endif
+
 namespace RTT { namespace mqueue { class Dispatcher; } }
 
 namespace RTT {
@@ -58,6 +72,19 @@ namespace RTT {
          * received new data.
          * Reasonably, there should be one dispatcher for each
          * peer component sending us data.
+         *
+         * On gnulinux, the queues are registered one by one in an epoll
+         * set and the ready queues are received in batches, such that the
+         * number of queues is not limited by FD_SETSIZE. Other targets
+         * rebuild a select() set in each iteration.
+         *
+         * The dispatcher also flushes the incomplete batches of the
+         * batching senders which registered with addFlush(), by waking
+         * up at least twice per (shortest) batch period.
+         *
+         * A pull sender of which the end of a reply did not fit in the
+         * queue registers that queue with addWritable(). The dispatcher
+         * calls MQSendRecv::mqResendEnd() when the queue has room again.
          */
         class Dispatcher : public Activity
         {
@@ -69,17 +96,119 @@ namespace RTT {
             typedef std::map<mqd_t,base::ChannelElementBase*> MQMap;
             MQMap mqmap;
 
-            fd_set socks;        /* Socket file descriptors we want to wake up for, using select() */
+            typedef std::set<MQSendRecv*> FlushSet;
+            FlushSet flushset;
 
-            int highsock;        /* Highest #'d file descriptor, needed for select() */
+            typedef std::map<mqd_t,MQSendRecv*> WriteMap;
+            WriteMap writemap;
 
             bool do_exit;
 
-            os::Mutex maplock;
+            /**
+             * Recursive, because a receiving channel moves its queue
+             * when it follows a resize from within signal().
+             */
+            os::MutexRecursive maplock;
+
+#ifdef ORO_MQUEUE_DISPATCHER_EPOLL
+            /**
+             * The maximum number of ready queues handled per wake-up.
+             */
+            static const int MaxEvents = 64;
+
+            int epfd;            /* The epoll set with all queues and wakefd */
+
+            int wakefd;          /* An eventfd to wake up epoll_wait() */
+
+            struct epoll_event events[MaxEvents];
+
+            Dispatcher( const std::string& name)
+            : Activity(ORO_SCHED_RT, os::HighestPriority, 0.0, 0, name),
+              do_exit(false), epfd(-1), wakefd(-1)
+              {
+                  epfd = epoll_create1(EPOLL_CLOEXEC);
+                  wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+                  if (epfd < 0 || wakefd < 0) {
+                      log(Error) <<"Dispatcher failed to create its epoll set: "<<strerror(errno)<<endlog();
+                      return;
+                  }
+                  struct epoll_event ev;
+                  ev.events = EPOLLIN;
+                  ev.data.fd = wakefd;
+                  epoll_ctl(epfd, EPOLL_CTL_ADD, wakefd, &ev);
+              }
+
+            ~Dispatcher() {
+                Logger::In in("Dispatcher");
+                log(Info) << "Dispacher cleans up: no more work."<<endlog();
+                stop();
+                if (wakefd >= 0)
+                    close(wakefd);
+                if (epfd >= 0)
+                    close(epfd);
+                DispatchI = 0;
+            }
+
+            /**
+             * Wakes up the loop, which checks do_exit.
+             */
+            void wakeup() {
+                eventfd_write(wakefd, 1);
+            }
+
+            void watch(mqd_t mqdes, bool update) {
+                struct epoll_event ev;
+                ev.events = EPOLLIN;
+                ev.data.fd = mqdes;
+                if ( epoll_ctl(epfd, update ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, mqdes, &ev) != 0 )
+                    log(Error) <<"Dispatcher failed to watch mqdes "<< mqdes <<": "<<strerror(errno)<<endlog();
+            }
+
+            void unwatch(mqd_t mqdes) {
+                // the queue may already be closed, which removed it from the set.
+                struct epoll_event ev;
+                epoll_ctl(epfd, EPOLL_CTL_DEL, mqdes, &ev);
+            }
+
+            void watchWritable(mqd_t mqdes) {
+                struct epoll_event ev;
+                ev.events = EPOLLOUT;
+                ev.data.fd = mqdes;
+                if ( epoll_ctl(epfd, EPOLL_CTL_ADD, mqdes, &ev) != 0 )
+                    log(Error) <<"Dispatcher failed to watch mqdes "<< mqdes <<" for room: "<<strerror(errno)<<endlog();
+            }
+
+            void read_events(int count) {
+                /* Signal the channels of the ready queues. A queue removed
+                   after epoll_wait() returned is no longer in mqmap. */
+                os::MutexLock lock(maplock);
+                for (int i = 0; i != count; ++i) {
+                    if ( events[i].data.fd == wakefd ) {
+                        eventfd_t value;
+                        eventfd_read(wakefd, &value);
+                        continue;
+                    }
+                    if ( events[i].events & EPOLLOUT ) {
+                        WriteMap::iterator wit = writemap.find( events[i].data.fd );
+                        if ( wit != writemap.end() )
+                            wit->second->mqResendEnd();
+                        continue;
+                    }
+                    MQMap::iterator it = mqmap.find( events[i].data.fd );
+                    if ( it != mqmap.end() )
+                        it->second->signal();
+                }
+            }
+#else
+            fd_set socks;        /* Socket file descriptors we want to wake up for, using select() */
+
+            fd_set wsocks;       /* Queues of which we wait for room, using select() */
+
+            int highsock;        /* Highest #'d file descriptor, needed for select() */
 
             Dispatcher( const std::string& name)
             : Activity(ORO_SCHED_RT, os::HighestPriority, 0.0, 0, name),
-              highsock(0), do_exit(false)
+              do_exit(false), highsock(0)
               {}
 
             ~Dispatcher() {
@@ -89,6 +218,20 @@ namespace RTT {
                 DispatchI = 0;
             }
 
+            void wakeup() {
+                // the select() timeout wakes up the loop.
+            }
+
+            void watch(mqd_t mqdes, bool update) {
+                // the select list is rebuilt in every iteration.
+            }
+
+            void unwatch(mqd_t mqdes) {
+            }
+
+            void watchWritable(mqd_t mqdes) {
+            }
+
             void build_select_list() {
 
                 /* First put together fd_set for select(), which will
@@ -101,6 +244,7 @@ namespace RTT {
                     it doesn't contain any file descriptors. */
 
                 FD_ZERO(&socks);
+                FD_ZERO(&wsocks);
                 highsock = 0;
 
                 /* Loops through all the possible connections and adds
@@ -111,6 +255,11 @@ namespace RTT {
                     if ( int(it->first) > highsock)
                         highsock = int(it->first);
                 }
+                for (WriteMap::const_iterator it = writemap.begin(); it != writemap.end(); ++it) {
+                    FD_SET( it->first, &wsocks);
+                    if ( int(it->first) > highsock)
+                        highsock = int(it->first);
+                }
             }
 
             void read_socks() {
@@ -120,12 +269,55 @@ namespace RTT {
                 /* Run through our sockets and check to see if anything
                     happened with them, if so 'service' them. */
                 os::MutexLock lock(maplock);
+                std::vector<mqd_t> ready;
                 for (MQMap::iterator it = mqmap.begin(); it != mqmap.end(); ++it) {
-                    if ( FD_ISSET( it->first, &socks) ) {
+                    if ( FD_ISSET( it->first, &socks) )
+                        ready.push_back( it->first );
+                }
+                // signal() may move its queue in mqmap.
+                for (std::vector<mqd_t>::iterator fd = ready.begin(); fd != ready.end(); ++fd) {
+                    MQMap::iterator it = mqmap.find( *fd );
+                    if ( it != mqmap.end() ) {
                         //log(Debug) << "New data on " << it->first <<endlog();
                         it->second->signal();
                     }
                 }
+                // mqResendEnd() removes its queue from writemap.
+                std::vector<mqd_t> writable;
+                for (WriteMap::iterator it = writemap.begin(); it != writemap.end(); ++it) {
+                    if ( FD_ISSET( it->first, &wsocks) )
+                        writable.push_back( it->first );
+                }
+                for (std::vector<mqd_t>::iterator fd = writable.begin(); fd != writable.end(); ++fd) {
+                    WriteMap::iterator it = writemap.find( *fd );
+                    if ( it != writemap.end() )
+                        it->second->mqResendEnd();
+                }
+            }
+#endif
+
+            /**
+             * Returns how long to wait for new data in nanoseconds,
+             * or -1 if no sender needs periodic flushing.
+             */
+            nsecs flush_timeout() {
+                os::MutexLock lock(maplock);
+                nsecs timeout = -1;
+                for (FlushSet::const_iterator it = flushset.begin(); it != flushset.end(); ++it) {
+                    nsecs half = (*it)->mqBatchPeriod() / 2;
+                    if ( timeout < 0 || half < timeout )
+                        timeout = half;
+                }
+                return timeout;
+            }
+
+            void flush_expired() {
+                os::MutexLock lock(maplock);
+                if ( flushset.empty() )
+                    return;
+                nsecs now = os::TimeService::Instance()->getNSecs();
+                for (FlushSet::const_iterator it = flushset.begin(); it != flushset.end(); ++it)
+                    (*it)->mqFlushExpired(now);
             }
 
         public:
@@ -148,9 +340,11 @@ namespace RTT {
                 log(Debug) <<"Dispatcher is monitoring mqdes "<< mqdes <<endlog();
                 os::MutexLock lock(maplock);
                 // we add a refcount per channel we monitor.
-                if (mqmap.count(mqdes) == 0)
+                bool update = mqmap.count(mqdes) != 0;
+                if (!update)
                     refcount.inc();
                 mqmap[mqdes] = chan;
+                watch(mqdes, update);
             }
 
             void removeQueue(mqd_t mqdes) {
@@ -158,28 +352,111 @@ namespace RTT {
                 log(Debug) <<"Dispatcher drops mqdes "<< mqdes <<endlog();
                 os::MutexLock lock(maplock);
                 if (mqmap.count(mqdes)) {
+                    unwatch(mqdes);
                     mqmap.erase( mqmap.find(mqdes) );
                     refcount.dec();
                 }
             }
 
+            /**
+             * Watches \a to instead of \a from for the same channel.
+             */
+            void moveQueue( mqd_t from, mqd_t to ) {
+                os::MutexLock lock(maplock);
+                MQMap::iterator it = mqmap.find(from);
+                if ( it == mqmap.end() )
+                    return;
+                base::ChannelElementBase* chan = it->second;
+                unwatch(from);
+                mqmap.erase(it);
+                mqmap[to] = chan;
+                watch(to, false);
+            }
+
+            /**
+             * Flushes the batch of \a sender when it gets older than
+             * its batch period.
+             */
+            void addFlush( MQSendRecv* sender ) {
+                os::MutexLock lock(maplock);
+                if ( flushset.insert(sender).second )
+                    refcount.inc();
+                // recalculate the wait timeout.
+                wakeup();
+            }
+
+            void removeFlush( MQSendRecv* sender ) {
+                os::MutexLock lock(maplock);
+                if ( flushset.erase(sender) )
+                    refcount.dec();
+            }
+
+            /**
+             * Calls mqResendEnd() of \a sender when \a mqdes has room
+             * for a message, until removeWritable() is called.
+             */
+            void addWritable( mqd_t mqdes, MQSendRecv* sender ) {
+                os::MutexLock lock(maplock);
+                if ( writemap.count(mqdes) )
+                    return;
+                refcount.inc();
+                writemap[mqdes] = sender;
+                watchWritable(mqdes);
+            }
+
+            void removeWritable( mqd_t mqdes ) {
+                os::MutexLock lock(maplock);
+                if ( writemap.count(mqdes) ) {
+                    unwatch(mqdes);
+                    writemap.erase( writemap.find(mqdes) );
+                    refcount.dec();
+                }
+            }
+
             bool initialize() {
                 do_exit = false;
                 return true;
             }
 
+#ifdef ORO_MQUEUE_DISPATCHER_EPOLL
+            void loop() {
+                int count;           /* Number of ready queues */
+                while (1) { /* epoll loop */
+                    nsecs timeout = flush_timeout();
+                    count = epoll_wait(epfd, events, MaxEvents, timeout < 0 ? -1 : int(std::max(timeout / NSECS_IN_MSECS, nsecs(1))));
+
+                    if (count < 0) {
+                        if (errno != EINTR)
+                        {
+                            log(Error) <<"Dispatcher failed to wait on message queues. Stopped thread. error: "<<strerror(errno)<<endlog();
+                            return;
+                        }
+                    }
+                    else if (count > 0)
+                        read_events(count);
+
+                    flush_expired();
+
+                    if ( do_exit )
+                        return;
+                } /* while(1) */
+            }
+#else
             void loop() {
                 struct timeval timeout;  /* Timeout for select */
                 int readsocks;       /* Number of sockets ready for reading */
                 while (1) { /* select loop */
                     build_select_list();
+                    nsecs flush = flush_timeout();
                     timeout.tv_sec = 0;
                     timeout.tv_usec = 50000;
+                    if ( flush >= 0 && flush < usecs_to_nsecs(50000) )
+                        timeout.tv_usec = std::max(long(flush / NSECS_IN_USECS), 1000L);
 
                     /* The first argument to select is the highest file
                         descriptor value plus 1.*/
 
-                    readsocks = select(highsock+1, &socks, (fd_set *) 0,
+                    readsocks = select(highsock+1, &socks, &wsocks,
                       (fd_set *) 0, &timeout);
 
                     /* select() returns the number of sockets that had
@@ -203,13 +480,17 @@ namespace RTT {
                     } else // readsocks > 0
                         read_socks();
 
+                    flush_expired();
+
                     if ( do_exit )
                         return;
                 } /* while(1) */
             }
+#endif
 
             bool breakLoop() {
                 do_exit = true;
+                wakeup();
                 return true;
             }
         };
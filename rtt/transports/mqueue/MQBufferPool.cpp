@@ -0,0 +1,108 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "MQBufferPool.hpp"
+#include "../../os/MutexLock.hpp"
+#include <cstring>
+
+using namespace RTT;
+using namespace RTT::mqueue;
+
+MQBufferPool& MQBufferPool::Instance()
+{
+    static MQBufferPool pool;
+    return pool;
+}
+
+MQBufferPool::MQBufferPool()
+{
+}
+
+MQBufferPool::~MQBufferPool()
+{
+    for (unsigned int c = 0; c != free_lists.size(); ++c)
+        for (FreeList::iterator it = free_lists[c].begin(); it != free_lists[c].end(); ++it)
+            delete[] *it;
+}
+
+int MQBufferPool::sizeClass(int size)
+{
+    int c = 0;
+    while ( (MinSize << c) < size )
+        ++c;
+    return c;
+}
+
+int MQBufferPool::capacity(int size)
+{
+    return MinSize << sizeClass(size);
+}
+
+char* MQBufferPool::acquire(int size)
+{
+    int c = sizeClass(size);
+    {
+        os::MutexLock locker(lock);
+        if ( c < int(free_lists.size()) && !free_lists[c].empty() ) {
+            char* buf = free_lists[c].back();
+            free_lists[c].pop_back();
+            return buf;
+        }
+    }
+    char* buf = new char[MinSize << c];
+    memset(buf, 0, MinSize << c); // necessary to trick valgrind
+    return buf;
+}
+
+void MQBufferPool::release(char* buf, int size)
+{
+    if (buf == 0)
+        return;
+    int c = sizeClass(size);
+    {
+        os::MutexLock locker(lock);
+        if ( c >= int(free_lists.size()) )
+            free_lists.resize(c + 1);
+        if ( free_lists[c].size() < MaxFree ) {
+            free_lists[c].push_back(buf);
+            return;
+        }
+    }
+    delete[] buf;
+}
+
+bool MQBufferPool::reserve(char*& buf, int& size, int new_size)
+{
+    if (buf && new_size <= size)
+        return false;
+    release(buf, size);
+    buf = acquire(new_size);
+    size = capacity(new_size);
+    return true;
+}
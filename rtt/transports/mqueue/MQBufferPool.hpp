@@ -0,0 +1,100 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef ORO_MQBUFFERPOOL_HPP_
+#define ORO_MQBUFFERPOOL_HPP_
+
+#include "../../os/Mutex.hpp"
+#include <vector>
+
+namespace RTT
+{
+    namespace mqueue
+    {
+        /**
+         * A process wide pool of the send, receive and reassembly
+         * buffers of the message queues. Buffers are kept in power of
+         * two size classes, such that a queue which needs a larger
+         * buffer can reuse one which was released by another queue
+         * instead of allocating it again.
+         */
+        class MQBufferPool
+        {
+        public:
+            /**
+             * The smallest buffer size handed out, in bytes.
+             */
+            static const int MinSize = 64;
+            /**
+             * The number of released buffers kept per size class.
+             */
+            static const unsigned int MaxFree = 8;
+
+            static MQBufferPool& Instance();
+
+            ~MQBufferPool();
+
+            /**
+             * Returns the size of the buffer that acquire(size) returns,
+             * which is the smallest size class that holds \a size bytes.
+             */
+            static int capacity(int size);
+
+            /**
+             * Returns a buffer of capacity(size) bytes. Newly allocated
+             * buffers are zero-initialised.
+             */
+            char* acquire(int size);
+
+            /**
+             * Returns a buffer obtained from acquire(size) to the pool.
+             * Does nothing if \a buf is null.
+             */
+            void release(char* buf, int size);
+
+            /**
+             * Replaces \a buf of \a size bytes with a buffer for at
+             * least \a new_size bytes, unless \a buf is already large enough.
+             * The contents are not preserved.
+             * @return true if \a buf was replaced.
+             */
+            bool reserve(char*& buf, int& size, int new_size);
+
+        private:
+            MQBufferPool();
+            static int sizeClass(int size);
+
+            typedef std::vector<char*> FreeList;
+            std::vector<FreeList> free_lists;
+            os::Mutex lock;
+        };
+    }
+}
+
+#endif /* ORO_MQBUFFERPOOL_HPP_ */
@@ -41,9 +41,12 @@
 
 #include "MQSendRecv.hpp"
 #include "../../Logger.hpp"
+#include "../../os/MutexLock.hpp"
 #include "../../base/ChannelElement.hpp"
 #include "../../internal/DataSource.hpp"
 #include "../../internal/DataSources.hpp"
+#include "../../internal/DataSourceTypeInfo.hpp"
+#include "../../types/TypeInfo.hpp"
 #include <stdexcept>
 
 namespace RTT
@@ -65,6 +68,10 @@ namespace RTT
             typename internal::ValueDataSource<T>::shared_ptr read_sample;
             /** Used in write() to refer to the sample that needs to be written */
             typename internal::LateConstReferenceDataSource<T>::shared_ptr write_sample;
+            /** Holds the pulled samples on the reading side of a pull connection */
+            typename base::ChannelElement<T>::shared_ptr pull_storage;
+            /** The type of the connection */
+            int mtype;
 
         public:
             /**
@@ -76,10 +83,16 @@ namespace RTT
                 : MQSendRecv(transport)
                 , read_sample(new internal::ValueDataSource<T>)
                 , write_sample(new internal::LateConstReferenceDataSource<T>)
-
+                , mtype(policy.type)
             {
                 Logger::In in("MQChannelElement");
                 setupStream(read_sample, port, policy, is_sender);
+                if ( mqIsPull() ) {
+                    if ( is_sender )
+                        mqListen(this);
+                    else
+                        pull_storage = detail::DataSourceTypeInfo<T>::getTypeInfo()->buildDataStorage(policy)->template narrow<T>();
+                }
             }
 
             ~MQChannelElement() {
@@ -87,10 +100,20 @@ namespace RTT
             }
 
             virtual bool inputReady(base::ChannelElementBase::shared_ptr const& caller) {
-                if ( mqReady(read_sample, this) ) {
+                if ( mqReady(read_sample) ) {
                     typename base::ChannelElement<T>::shared_ptr output = caller->narrow<T>();
                     assert(output);
+                    if ( pull_storage )
+                        pull_storage->data_sample(read_sample->rvalue());
                     output->data_sample(read_sample->rvalue());
+                    // the rest of the first batch, before the Dispatcher forwards the next ones.
+                    while ( mqPending() && mqRead(read_sample) ) {
+                        if ( pull_storage )
+                            pull_storage->write(read_sample->rvalue());
+                        else
+                            output->write(read_sample->rvalue());
+                    }
+                    mqListen(this);
                     return true;
                 }
                 return false;
@@ -100,10 +123,13 @@ namespace RTT
             {
                 // send initial data sample to the other side using a plain write.
                 if (mis_sender && (!write_sample->getRawDataConst() || reset)) {
+                    // the Dispatcher may be replying to a pull request now.
+                    os::MutexLock lock(msend_lock);
                     write_sample->setPointer(&sample);
                     // update MQSendRecv buffer:
                     mqNewSample(write_sample);
-                    return mqWrite(write_sample) ? WriteSuccess : WriteFailure;
+                    // the initial sample is not kept waiting in a batch.
+                    return mqWrite(write_sample) && mqFlush() ? WriteSuccess : WriteFailure;
                 }
                 return NotConnected;
             }
@@ -123,12 +149,40 @@ namespace RTT
              * that does the read/write cycle, but that seems only causing overhead.
              * The receiving case must use a thread which blocks on all mq
              * file descriptors.
+             *
+             * In pull mode, the dispatcher signals a sending MQ when the
+             * receiver requests samples, and a receiving MQ when the sender
+             * announces new data or a reply arrives.
              * @return true in case the forwarding could be done, false otherwise.
              */
             bool signal()
             {
                 // copy messages into channel
-                if (mis_sender) {
+                if (mis_sender && mpull) {
+                    // serve the requests of the receiver from the data element.
+                    typename base::ChannelElement<T>::shared_ptr input =
+                        this->getInput();
+                    unsigned int seq;
+                    int count;
+                    bool result = true;
+                    while ( mqNextRequest(seq, count) ) {
+                        os::MutexLock lock(msend_lock);
+                        for (int i = 0; i < count && input && input->read(read_sample->set(), false) == NewData; ++i)
+                            result = ( this->write(read_sample->rvalue()) == WriteSuccess ) && result;
+                        result = mqReply(seq) && result;
+                    }
+                    return result;
+                } else if (mpull) {
+                    // store the replies which arrived and request what the
+                    // sender announced, such that read() never waits for it.
+                    bool notified = mqNotified();
+                    bool stored = false;
+                    while ( mqReadReply(read_sample) )
+                        stored = ( pull_storage->write(read_sample->rvalue()) == WriteSuccess ) || stored;
+                    if ( notified )
+                        mqRequest();
+                    return stored ? base::ChannelElementBase::signal() : true;
+                } else if (mis_sender) {
                     // this read should always succeed since signal() means
                     // 'data available in a data element'.
                     typename base::ChannelElement<T>::shared_ptr input =
@@ -138,20 +192,46 @@ namespace RTT
                 } else {
                     typename base::ChannelElement<T>::shared_ptr output =
                         this->getOutput();
-                    if (output && mqRead(read_sample))
-                        return ( output->write(read_sample->rvalue()) == WriteSuccess );
+                    if (!output || !mqRead(read_sample))
+                        return false;
+                    bool result = ( output->write(read_sample->rvalue()) == WriteSuccess );
+                    // unpack the rest of a batch in one go.
+                    while ( mqPending() && mqRead(read_sample) )
+                        result = ( output->write(read_sample->rvalue()) == WriteSuccess ) && result;
+                    return result;
                 }
                 return false;
             }
 
             /**
-             * Read from the message queue.
+             * A sending MQ of a pull connection only announces new data.
+             * It sends the samples which the receiver requests, see signal().
+             */
+            virtual bool signalFrom(base::ChannelElementBase* caller)
+            {
+                if (mis_sender && mpull)
+                    return mqNotify();
+                return signal();
+            }
+
+            /**
+             * Read the pulled samples. Works only on the receiving side
+             * of a pull connection. The dispatcher requests the latest
+             * sample (data connections) or the next samples (buffer
+             * connections) when the sender announces them and stores the
+             * replies, such that this never waits for the sender.
              * @param sample stores the resulting data sample.
-             * @return true if an item could be read.
+             * @return NewData if a new item could be read.
              */
             FlowStatus read(typename base::ChannelElement<T>::reference_t sample, bool copy_old_data)
             {
-                throw std::runtime_error("not implemented");
+                if ( !pull_storage )
+                    throw std::runtime_error("not implemented");
+                FlowStatus result = pull_storage->read(sample, copy_old_data);
+                // a buffer which ran empty asks for the samples which did not fit before.
+                if ( mtype != ConnPolicy::DATA && result != NewData )
+                    mqRequest();
+                return result;
             }
 
             /**
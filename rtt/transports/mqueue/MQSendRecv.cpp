@@ -46,24 +46,116 @@
 #include <stdexcept>
 #include <errno.h>
 #include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <fstream>
+#include <algorithm>
 
 #include "MQSendRecv.hpp"
 #include "../../types/TypeTransporter.hpp"
 #include "../../types/TypeMarshaller.hpp"
 #include "../../Logger.hpp"
 #include "Dispatcher.hpp"
+#include "MQBufferPool.hpp"
 #include "../../base/PortInterface.hpp"
 #include "../../DataFlowInterface.hpp"
 #include "../../TaskContext.hpp"
+#include "../../os/CAS.hpp"
+#include "../../os/TimeService.hpp"
+#include <boost/cstdint.hpp>
 
 using namespace RTT;
 using namespace RTT::detail;
 using namespace RTT::mqueue;
 
+namespace {
+    /**
+     * The frame header of each message.
+     */
+    struct MQFrame {
+        /** The size of the sample or batch, or the generation of a resize message. */
+        boost::uint32_t size;
+        /** The offset of the payload in the sample, or ResizeMark. */
+        boost::uint32_t offset;
+    };
+
+    /**
+     * Marks a message which tells the receiver to continue on a resized queue.
+     */
+    const boost::uint32_t ResizeMark = 0xffffffff;
+
+    /**
+     * Marks the last message of the reply to a pull request.
+     */
+    const boost::uint32_t EndMark = 0xfffffffe;
+
+    /**
+     * A request of a pull receiver.
+     */
+    struct MQRequest {
+        /** The sequence number, which the sender returns in the end message. */
+        boost::uint32_t seq;
+        /** The maximum number of samples to send. */
+        boost::uint32_t count;
+    };
+
+    /**
+     * Opens one of the non-blocking queues of a pull connection, which
+     * either side may create.
+     */
+    mqd_t openQueue(std::string const& name, int oflag, struct mq_attr& mattr) {
+        mqd_t mq = mq_open(name.c_str(), oflag | O_CREAT | O_NONBLOCK, S_IREAD | S_IWRITE, &mattr);
+        if (mq < 0)
+        {
+            log(Error) << "FAILED opening '" << name << "': " << strerror(errno) << endlog();
+            throw std::runtime_error("Could not open message queue of a pull connection: mq_open returned -1.");
+        }
+        struct mq_attr attr;
+        if (mq_getattr(mq, &attr) != 0 || attr.mq_msgsize != mattr.mq_msgsize)
+        {
+            mq_close(mq);
+            log(Error) << "The existing queue '" << name << "' has a wrong message size." << endlog();
+            throw std::runtime_error("Could not open message queue of a pull connection: wrong message size.");
+        }
+        return mq;
+    }
+
+    /**
+     * Returns the size of a record payload of \a size bytes in a batch.
+     */
+    int padded(int size) {
+        return (size + MQSendRecv::BatchAlign - 1) / MQSendRecv::BatchAlign * MQSendRecv::BatchAlign;
+    }
+
+    /**
+     * Returns the largest message size an unprivileged process may
+     * create a queue with.
+     */
+    int maxMessageSize() {
+        static int max_msgsize = 0;
+        if (max_msgsize == 0) {
+            std::ifstream proc("/proc/sys/fs/mqueue/msgsize_max");
+            if ( !(proc >> max_msgsize) || max_msgsize <= 0 )
+                max_msgsize = 8192;
+        }
+        return max_msgsize;
+    }
+}
+
 
 MQSendRecv::MQSendRecv(types::TypeMarshaller const& transport) :
-    mtransport(transport), marshaller_cookie(0), buf(0), mis_sender(false), minit_done(false), max_size(0), mdata_size(0)
+    mtransport(transport), marshaller_cookie(0), mqdes(-1), buf(0), buf_size(0), msg(0), msg_capacity(0), msg_size(0),
+    mis_sender(false), minit_done(false), max_size(0), mgeneration(0), mdata_size(0), frag_size(0), frag_filled(0),
+    mbatch_size(0), mbatch_period(0), mbatch_state(0), batch_used(0), batch_count(0),
+    mpull(false), mreqdes(-1), msigdes(-1), mpull_count(0), mpull_seq(0), mpull_waiting(0), mpull_notified(false), mpull_time(0),
+    mend_pending(false), mend_seq(0), mend_des(-1)
 {
+    for (int i = 0; i != 2; ++i) {
+        mbatch[i].data = 0;
+        mbatch[i].capacity = 0;
+        mbatch[i].used = 0;
+        mbatch[i].count = 0;
+        mbatch[i].start = 0;
+    }
 }
 
 void MQSendRecv::setupStream(base::DataSourceBase::shared_ptr ds, base::PortInterface* port, ConnPolicy const& policy,
@@ -72,9 +164,12 @@ void MQSendRecv::setupStream(base::DataSourceBase::shared_ptr ds, base::PortInte
     Logger::In in("MQSendRecv");
 
     mdata_size = policy.data_size;
-    max_size = policy.data_size ? policy.data_size : mtransport.getSampleSize(ds);
-    marshaller_cookie = mtransport.createCookie();
     mis_sender = is_sender;
+    mpull = policy.pull == ConnPolicy::PULL;
+    mbatch_size = policy.batch_size > 1 ? policy.batch_size : 0;
+    mbatch_period = mbatch_size ? Seconds_to_nsecs(policy.batch_period) : 0;
+    int sample_size = policy.data_size ? policy.data_size : mtransport.getSampleSize(ds);
+    marshaller_cookie = mtransport.createCookie();
 
     if (policy.name_id.empty())
     {
@@ -90,11 +185,11 @@ void MQSendRecv::setupStream(base::DataSourceBase::shared_ptr ds, base::PortInte
 
     struct mq_attr mattr;
     mattr.mq_maxmsg = policy.size ? policy.size : 10;
-    mattr.mq_msgsize = max_size;
-    assert( max_size );
+    // a batch holds up to mbatch_size records of at most sample_size bytes.
+    mattr.mq_msgsize = messageSize(sample_size);
     if (policy.name_id[0] != '/')
         throw std::runtime_error("Could not open message queue with wrong name. Names must start with '/' and contain no more '/' after the first one.");
-    if (max_size <= 0)
+    if (sample_size <= 0)
         throw std::runtime_error("Could not open message queue with zero message size.");
     int oflag = O_CREAT;
     if (mis_sender)
@@ -143,17 +238,60 @@ void MQSendRecv::setupStream(base::DataSourceBase::shared_ptr ds, base::PortInte
         throw std::runtime_error("Could not open message queue: mq_open returned -1.");
     }
 
-    log(Debug) << "Opened '" << policy.name_id << "' with mqdes='" << mqdes << "', msg size='"<<mattr.mq_msgsize<<"' an queue length='"<<mattr.mq_maxmsg<<"' for " << (is_sender ? "writing." : "reading.") << endlog();
+    // the queue may have been created by the other side, with another message size.
+    useQueue(mqdes);
+    log(Debug) << "Opened '" << policy.name_id << "' with mqdes='" << mqdes << "', msg size='"<<msg_size<<"' an queue length='"<<mattr.mq_maxmsg<<"' for " << (is_sender ? "writing." : "reading.") << endlog();
 
-    buf = new char[max_size];
-    memset(buf, 0, max_size); // necessary to trick valgrind
     mqname = policy.name_id;
+    mqbase = policy.name_id;
+    mgeneration = 0;
+
+    if (mpull)
+    {
+        openPullQueues();
+        if (!mis_sender)
+        {
+            // the end message of a reply needs a place in the queue too.
+            struct mq_attr attr;
+            mq_getattr(mqdes, &attr);
+            int room = std::max(int(attr.mq_maxmsg) - 1, 1);
+            mpull_count = policy.type == ConnPolicy::DATA ? 1 : std::max(std::min(policy.size, room), 1);
+        }
+    }
+
+    if (mbatch_size)
+    {
+        batch_used = 0;
+        batch_count = 0;
+        mbatch_state = 0;
+        if (mis_sender && mbatch_period)
+            Dispatcher::Instance()->addFlush(this);
+    }
 }
 
 MQSendRecv::~MQSendRecv()
 {
     if ( mqdes > 0)
         mq_close(mqdes);
+    if ( mreqdes > 0)
+        mq_close(mreqdes);
+    if ( msigdes > 0)
+        mq_close(msigdes);
+    for (unsigned int i = 0; i != mretired.size(); ++i)
+        mq_close(mretired[i].first);
+}
+
+void MQSendRecv::openPullQueues()
+{
+    struct mq_attr mattr;
+    // the sender reads the requests, the receiver the notifications.
+    mattr.mq_maxmsg = 4;
+    mattr.mq_msgsize = sizeof(MQRequest);
+    mreqdes = openQueue(mqbase + ".req", mis_sender ? O_RDONLY : O_WRONLY, mattr);
+    // a pending notification suffices to announce any number of samples.
+    mattr.mq_maxmsg = 1;
+    mattr.mq_msgsize = 1;
+    msigdes = openQueue(mqbase + ".sig", mis_sender ? O_WRONLY : O_RDONLY, mattr);
 }
 
 void MQSendRecv::cleanupStream()
@@ -163,39 +301,253 @@ void MQSendRecv::cleanupStream()
         if (minit_done)
         {
             Dispatcher::Instance()->removeQueue(mqdes);
+            if (mpull)
+                Dispatcher::Instance()->removeQueue(msigdes);
             minit_done = false;
         }
     }
     else
     {
+        if (mpull)
+        {
+            if (mreqdes >= 0)
+                Dispatcher::Instance()->removeQueue(mreqdes);
+            if (mend_des >= 0)
+                Dispatcher::Instance()->removeWritable(mend_des);
+            mend_des = -1;
+            mend_pending = false;
+            mq_unlink((mqbase + ".req").c_str());
+            mq_unlink((mqbase + ".sig").c_str());
+        }
+        if (mbatch_size)
+        {
+            if (mbatch_period)
+                Dispatcher::Instance()->removeFlush(this);
+            mqFlush();
+        }
         // sender unlinks to avoid future re-use of new readers.
         mq_unlink(mqname.c_str());
+        unlinkRetired(true);
     }
     // both sender and receiver close their end.
     mq_close( mqdes);
+    mqdes = -1;
+    if (mreqdes >= 0)
+        mq_close(mreqdes);
+    mreqdes = -1;
+    if (msigdes >= 0)
+        mq_close(msigdes);
+    msigdes = -1;
 
     if (marshaller_cookie)
         mtransport.deleteCookie(marshaller_cookie);
+    marshaller_cookie = 0;
 
-    if (buf)
-    {
-        delete[] buf;
-        buf = 0;
+    MQBufferPool::Instance().release(buf, buf_size);
+    buf = 0;
+    buf_size = 0;
+    MQBufferPool::Instance().release(msg, msg_capacity);
+    msg = 0;
+    msg_capacity = 0;
+    for (int i = 0; i != 2; ++i) {
+        MQBufferPool::Instance().release(mbatch[i].data, mbatch[i].capacity);
+        mbatch[i].data = 0;
+        mbatch[i].capacity = 0;
     }
 }
 
+int MQSendRecv::messageSize(int sample_size) const
+{
+    if (mbatch_size)
+        return FrameSize + mbatch_size * (BatchAlign + padded(sample_size));
+    return FrameSize + sample_size;
+}
+
+void MQSendRecv::useQueue(mqd_t mq)
+{
+    struct mq_attr attr;
+    if (mq_getattr(mq, &attr) != 0)
+        throw std::runtime_error("Could not read the attributes of the message queue.");
+    msg_size = attr.mq_msgsize;
+    MQBufferPool::Instance().reserve(msg, msg_capacity, msg_size);
+    // a sender only resizes with empty batches.
+    if (mis_sender && mbatch_size)
+        for (int i = 0; i != 2; ++i)
+            MQBufferPool::Instance().reserve(mbatch[i].data, mbatch[i].capacity, msg_size);
+    if (mbatch_size)
+        max_size = (msg_size - FrameSize) / mbatch_size - BatchAlign;
+    else
+        max_size = msg_size - FrameSize;
+}
 
 void MQSendRecv::mqNewSample(RTT::base::DataSourceBase::shared_ptr ds)
 {
-    // only deduce if user did not specify it explicitly:
-    if (mdata_size == 0)
-        max_size = mtransport.getSampleSize(ds);
-    delete[] buf;
-    buf = new char[max_size];
-    memset(buf, 0, max_size); // necessary to trick valgrind
+    if (mis_sender)
+    {
+        int size = mtransport.getSampleSize(ds, marshaller_cookie);
+        if (!mbatch_size)
+        {
+            if (size > max_size)
+                mqResize(size);
+            return;
+        }
+        // the next write resizes if the Dispatcher is sending a batch now.
+        if ( !(enterBatch() & BatchClaimed) && size > max_size )
+            mqResize(size);
+        leaveBatch();
+    }
+}
+
+bool MQSendRecv::mqResize(int sample_size)
+{
+    Logger::In in("MQSendRecv");
+    // grow in steps, such that a slowly growing sample does not resize each time.
+    // Samples larger than the system limit are sent in the fewest fragments.
+    int new_size = std::min( messageSize(MQBufferPool::capacity(sample_size)), maxMessageSize() );
+    if (new_size <= msg_size)
+        return false;
+
+    // the receiver must get the samples of the current batch first.
+    if (mbatch_size && !sendBatch(currentBatch()))
+        return false;
+    unlinkRetired(false);
+
+    struct mq_attr mattr;
+    mq_getattr(mqdes, &mattr);
+    mattr.mq_msgsize = new_size;
+    unsigned int generation = mgeneration + 1;
+    std::string name = mqbase + "." + boost::lexical_cast<std::string>(generation);
+    mq_unlink(name.c_str()); // a stale queue would have the wrong size.
+    mqd_t newdes = mq_open(name.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_NONBLOCK, S_IREAD | S_IWRITE, &mattr);
+    if (newdes < 0)
+    {
+        log(Debug) << "Could not resize '" << mqname << "' to message size " << new_size << ": " << strerror(errno) << endlog();
+        return false;
+    }
+
+    // tell the receiver to continue on the new queue.
+    if (!sendMessage(0, generation, ResizeMark))
+    {
+        mq_close(newdes);
+        mq_unlink(name.c_str());
+        return false;
+    }
+    log(Debug) << "Resized '" << mqname << "' to '" << name << "' with message size " << new_size << endlog();
+    // the receiver opens the new queue by name when it gets there.
+    mretired.push_back( std::make_pair(mqdes, mqname) );
+    mqdes = newdes;
+    mqname = name;
+    mgeneration = generation;
+    useQueue(mqdes);
+    // the new queue has room for a pending end, the Dispatcher then unwatches the retired one.
+    if (mend_pending && sendMessage(0, mend_seq, EndMark))
+        mend_pending = false;
+    return true;
+}
+
+void MQSendRecv::unlinkRetired(bool all)
+{
+    std::vector< std::pair<mqd_t, std::string> >::iterator it = mretired.begin();
+    while ( it != mretired.end() )
+    {
+        struct mq_attr attr;
+        // the resize message was the last one in the queue.
+        // The Dispatcher may still watch it for a pending end.
+        if ( !all && it->first == mend_des )
+        {
+            ++it;
+            continue;
+        }
+        if ( !all && mq_getattr(it->first, &attr) == 0 && attr.mq_curmsgs != 0 )
+        {
+            ++it;
+            continue;
+        }
+        mq_unlink(it->second.c_str());
+        mq_close(it->first);
+        it = mretired.erase(it);
+    }
 }
 
-bool MQSendRecv::mqReady(base::DataSourceBase::shared_ptr ds, base::ChannelElementBase* chan)
+bool MQSendRecv::mqReopen(unsigned int generation)
+{
+    Logger::In in("MQSendRecv");
+    std::string name = mqbase + "." + boost::lexical_cast<std::string>(generation);
+    mqd_t newdes = mq_open(name.c_str(), O_RDONLY);
+    if (newdes < 0)
+    {
+        log(Error) << "MQChannel could not follow the resize of '" << mqname << "' to '" << name << "': " << strerror(errno) << endlog();
+        return false;
+    }
+    useQueue(newdes);
+    if (minit_done)
+        Dispatcher::Instance()->moveQueue(mqdes, newdes);
+    mq_close(mqdes);
+    mqdes = newdes;
+    mqname = name;
+    mgeneration = generation;
+    frag_size = 0;
+    frag_filled = 0;
+    return true;
+}
+
+MQSendRecv::ReceiveResult MQSendRecv::mqReceive(const struct timespec* abs_timeout, const char*& data, int& size)
+{
+    ssize_t bytes = mq_timedreceive(mqdes, msg, msg_size, 0, abs_timeout);
+    if (bytes == -1)
+        return ReceiveFailed;
+    if (bytes < FrameSize)
+    {
+        log(Error) << "MQChannel "<< mqdes << " received a message without frame header." << endlog();
+        return ReceiveFailed;
+    }
+    MQFrame frame;
+    memcpy(&frame, msg, FrameSize);
+    int payload = bytes - FrameSize;
+
+    if (frame.offset == ResizeMark)
+        return mqReopen(frame.size) ? ReceivePartial : ReceiveFailed;
+
+    if (frame.offset == EndMark)
+    {
+        size = frame.size;
+        return ReceiveEnd;
+    }
+
+    if (frame.offset == 0 && int(frame.size) == payload)
+    {
+        data = msg + FrameSize;
+        size = payload;
+        return ReceiveWhole;
+    }
+
+    // a fragment of a sample which did not fit in one message.
+    if (frame.offset == 0)
+    {
+        MQBufferPool::Instance().reserve(buf, buf_size, frame.size);
+        frag_size = frame.size;
+        frag_filled = 0;
+    }
+    if (frag_size == 0 || int(frame.size) != frag_size || int(frame.offset) != frag_filled || payload > frag_size - frag_filled)
+    {
+        // a fragment was lost, because the queue was full.
+        log(Warning) << "MQChannel "<< mqdes << " dropped an incomplete sample." << endlog();
+        frag_size = 0;
+        frag_filled = 0;
+        return ReceivePartial;
+    }
+    memcpy(buf + frag_filled, msg + FrameSize, payload);
+    frag_filled += payload;
+    if (frag_filled != frag_size)
+        return ReceivePartial;
+    data = buf;
+    size = frag_size;
+    frag_size = 0;
+    frag_filled = 0;
+    return ReceiveReassembled;
+}
+
+bool MQSendRecv::mqReady(base::DataSourceBase::shared_ptr ds)
 {
     if (minit_done)
         return true;
@@ -212,14 +564,28 @@ bool MQSendRecv::mqReady(base::DataSourceBase::shared_ptr ds, base::ChannelEleme
         abs_timeout.tv_sec += abs_timeout.tv_nsec / (1000*1000*1000);
         abs_timeout.tv_nsec = abs_timeout.tv_nsec % (1000*1000*1000);
         //abs_timeout.tv_sec +=1;
-        ssize_t ret = mq_timedreceive(mqdes, buf, max_size, 0, &abs_timeout);
-        if (ret != -1)
+        const char* data = 0;
+        int size = 0;
+        ReceiveResult ret;
+        // resize messages and fragments precede a large initial sample.
+        while ( (ret = mqReceive(&abs_timeout, data, size)) == ReceivePartial )
+            ;
+        if (ret != ReceiveFailed)
         {
-            if (mtransport.updateFromBlob((void*) buf, ret, ds, marshaller_cookie))
+            bool ok;
+            if (ret == ReceiveWhole && mbatch_size)
+            {
+                // the first sample of the first batch initializes the
+                // channel, the others are read with mqRead().
+                batch_used = size;
+                batch_count = 0;
+                ok = mqPending() && unpackRecord(ds);
+            }
+            else
+                ok = mtransport.updateFromBlob((void*) data, size, ds, marshaller_cookie);
+            if (ok)
             {
                 minit_done = true;
-                // ok, now we can add the dispatcher.
-                Dispatcher::Instance()->addQueue(mqdes, chan);
                 return true;
             }
             else
@@ -245,47 +611,394 @@ bool MQSendRecv::mqReady(base::DataSourceBase::shared_ptr ds, base::ChannelEleme
 
 bool MQSendRecv::mqRead(RTT::base::DataSourceBase::shared_ptr ds)
 {
-    int bytes = 0;
+    // first hand out the rest of the last received batch.
+    if (mqPending())
+        return unpackRecord(ds);
+
     struct timespec abs_timeout;
     clock_gettime(CLOCK_REALTIME, &abs_timeout);
     abs_timeout.tv_nsec += Seconds_to_nsecs(0.5);
     abs_timeout.tv_sec += abs_timeout.tv_nsec / (1000*1000*1000);
     abs_timeout.tv_nsec = abs_timeout.tv_nsec % (1000*1000*1000);
     //abs_timeout.tv_sec +=1;
-    if ((bytes = mq_timedreceive(mqdes, buf, max_size, 0, &abs_timeout)) == -1)
+    const char* data = 0;
+    int size = 0;
+    switch ( mqReceive(&abs_timeout, data, size) )
     {
+    case ReceiveFailed:
         //log(Debug) << "Tried read on empty mq!" <<endlog();
         return false;
+    case ReceivePartial:
+        // the rest of the sample is in the next messages.
+        return false;
+    case ReceiveEnd:
+        return false;
+    case ReceiveWhole:
+        if (mbatch_size)
+        {
+            batch_used = size;
+            batch_count = 0;
+            return unpackRecord(ds);
+        }
+        break;
+    case ReceiveReassembled:
+        break;
+    }
+    return mtransport.updateFromBlob((void*) data, size, ds, marshaller_cookie);
+}
+
+bool MQSendRecv::unpackRecord(RTT::base::DataSourceBase::shared_ptr ds)
+{
+    const char* batch = msg + FrameSize;
+    boost::uint32_t size = 0;
+    int payload = batch_count + BatchAlign;
+    if (payload <= batch_used)
+        memcpy(&size, batch + batch_count, sizeof(size));
+    if (payload > batch_used || int(size) > batch_used - payload)
+    {
+        log(Error) << "MQChannel "<< mqdes << " received a corrupt batch of "<< batch_used << " bytes." << endlog();
+        batch_count = batch_used;
+        return false;
     }
-    if (bytes == 0) {
-        log(Error) << "Failed to read from MQ Channel Element: no data received within 500ms!" <<endlog();
+    batch_count = payload + padded(size);
+    return mtransport.updateFromBlob((void*) (batch + payload), size, ds, marshaller_cookie);
+}
+
+bool MQSendRecv::sendMessage(int size, int total, int offset)
+{
+    return sendMessage(msg, size, total, offset);
+}
+
+bool MQSendRecv::sendMessage(char* message, int size, int total, int offset)
+{
+    MQFrame frame;
+    frame.size = total;
+    frame.offset = offset;
+    memcpy(message, &frame, FrameSize);
+    if (mq_send(mqdes, message, FrameSize + size, 0) == -1)
+    {
+        if (errno == EAGAIN)
+            return offset != int(ResizeMark) && offset != int(EndMark);
+
+        log(Error) << "MQChannel "<< mqdes << " became invalid (mq length="<<msg_size<<", msg length="<<FrameSize + size<<"): " << strerror(errno) << endlog();
         return false;
     }
-    if (mtransport.updateFromBlob((void*) buf, bytes, ds, marshaller_cookie))
+    return true;
+}
+
+bool MQSendRecv::sendFragments(const char* data, int size)
+{
+    // in batch mode, a whole message is a batch, so each fragment is smaller than the sample.
+    int chunk = msg_size - FrameSize - (mbatch_size ? BatchAlign : 0);
+    for (int offset = 0; offset < size; offset += chunk)
     {
+        int count = std::min(chunk, size - offset);
+        memcpy(msg + FrameSize, data + offset, count);
+        if (!sendMessage(count, size, offset))
+            return false;
+    }
+    return true;
+}
+
+int MQSendRecv::enterBatch()
+{
+    int state;
+    do {
+        state = mbatch_state;
+    } while ( !os::CAS(&mbatch_state, state, state | BatchBusy) );
+    return state;
+}
+
+void MQSendRecv::leaveBatch()
+{
+    int state;
+    do {
+        state = mbatch_state;
+    } while ( !os::CAS(&mbatch_state, state, state & ~BatchBusy) );
+}
+
+bool MQSendRecv::sendBatch(Batch& batch)
+{
+    if (batch.count == 0)
+        return true;
+    int bytes = batch.used;
+    batch.used = 0;
+    batch.count = 0;
+    return sendMessage(batch.data, bytes, bytes, 0);
+}
+
+bool MQSendRecv::mqFlush()
+{
+    if (!mbatch_size || !mis_sender)
         return true;
+    bool result = true;
+    // if the Dispatcher is sending the batch now, it also sends the rest.
+    if ( !(enterBatch() & BatchClaimed) )
+        result = sendBatch(currentBatch());
+    leaveBatch();
+    return result;
+}
+
+void MQSendRecv::mqFlushExpired(nsecs now)
+{
+    int state = mbatch_state;
+    Batch& batch = mbatch[state & BatchCurrent];
+    // the writer sends its batch itself when it is busy.
+    if ( (state & BatchBusy) || batch.count == 0 || now - batch.start < mbatch_period )
+        return;
+    if ( !os::CAS(&mbatch_state, state, state | BatchClaimed) )
+        return;
+    sendBatch(batch);
+    // the other batch holds the samples that were written meanwhile.
+    do {
+        state = mbatch_state;
+    } while ( !os::CAS(&mbatch_state, state, (state ^ BatchCurrent) & ~BatchClaimed) );
+}
+
+std::pair<void const*, int> MQSendRecv::marshal(RTT::base::DataSourceBase::shared_ptr ds)
+{
+    std::pair<void const*, int> blob(0, 0);
+    if (buf)
+        blob = mtransport.fillBlob(ds, buf, buf_size, marshaller_cookie);
+    if (blob.first == 0)
+    {
+        int size = mtransport.getSampleSize(ds, marshaller_cookie);
+        if ( MQBufferPool::Instance().reserve(buf, buf_size, size) )
+            blob = mtransport.fillBlob(ds, buf, buf_size, marshaller_cookie);
+    }
+    return blob;
+}
+
+bool MQSendRecv::writeBatch(RTT::base::DataSourceBase::shared_ptr ds, Batch& batch, bool overflow)
+{
+    bool resized = false;
+    // marshal in place, or start a new batch if the sample does not fit.
+    while (true)
+    {
+        int room = msg_size - FrameSize - batch.used - BatchAlign;
+        char* record = batch.data + FrameSize + batch.used;
+        std::pair<void const*, int> blob(0, 0);
+        if (room > 0 && batch.count < mbatch_size)
+            blob = mtransport.fillBlob(ds, record + BatchAlign, room, marshaller_cookie);
+        if (blob.first != 0 && blob.second <= room)
+        {
+            if (blob.first != record + BatchAlign)
+                memcpy(record + BatchAlign, blob.first, blob.second);
+            boost::uint32_t size = blob.second;
+            memcpy(record, &size, sizeof(size));
+            batch.used += BatchAlign + padded(blob.second);
+            if (batch.count++ == 0)
+                batch.start = os::TimeService::Instance()->getNSecs();
+            // a full overflow batch is sent when it became the current one.
+            if (!overflow && (batch.count >= mbatch_size || batch.used + FrameSize >= msg_size))
+                return sendBatch(batch);
+            return true;
+        }
+        // the Dispatcher sends the other batch now: drop the sample and
+        // report the failed write, like a full buffer does.
+        if (overflow)
+            return false;
+        if (batch.count != 0)
+        {
+            if (!sendBatch(batch))
+                return false;
+            continue;
+        }
+        // the sample does not fit in an empty batch.
+        blob = marshal(ds);
+        if (blob.first == 0)
+        {
+            log(Error) << "MQChannel: failed to marshal sample" << endlog();
+            return false;
+        }
+        if (!resized && mqResize(blob.second))
+        {
+            resized = true;
+            if (blob.second <= max_size)
+                continue;
+        }
+        return sendFragments((const char*) blob.first, blob.second);
     }
-    return false;
 }
 
 bool MQSendRecv::mqWrite(RTT::base::DataSourceBase::shared_ptr ds)
 {
-    std::pair<void const*, int> blob = mtransport.fillBlob(ds, buf, max_size, marshaller_cookie);
+    if (mbatch_size)
+    {
+        int state = enterBatch();
+        // fill the other batch while the Dispatcher sends the current one.
+        bool overflow = state & BatchClaimed;
+        bool result = writeBatch(ds, mbatch[(state & BatchCurrent) ^ (overflow ? 1 : 0)], overflow);
+        leaveBatch();
+        return result;
+    }
+
+    // marshal in place behind the frame header in the common case.
+    std::pair<void const*, int> blob = mtransport.fillBlob(ds, msg + FrameSize, max_size, marshaller_cookie);
+    if (blob.first == 0)
+        blob = marshal(ds);
     if (blob.first == 0)
     {
         log(Error) << "MQChannel: failed to marshal sample" << endlog();
         return false;
     }
+    if (blob.second > max_size)
+    {
+        mqResize(blob.second);
+        if (blob.second > max_size)
+            return sendFragments((const char*) blob.first, blob.second);
+    }
 
-    char* lbuf = (char*) blob.first;
-    if (mq_send(mqdes, lbuf, blob.second, 0) == -1)
+    if (blob.first != msg + FrameSize)
+        memcpy(msg + FrameSize, blob.first, blob.second);
+    return sendMessage(blob.second, blob.second, 0);
+}
+
+void MQSendRecv::mqListen(base::ChannelElementBase* chan)
+{
+    if (mis_sender && mpull)
+        Dispatcher::Instance()->addQueue(mreqdes, chan);
+    else if (!mis_sender && minit_done)
     {
-        if (errno == EAGAIN)
-            return true;
+        // a pull receiver gets the replies on the data queue.
+        Dispatcher::Instance()->addQueue(mqdes, chan);
+        if (mpull)
+            Dispatcher::Instance()->addQueue(msigdes, chan);
+    }
+}
 
-        log(Error) << "MQChannel "<< mqdes << " became invalid (mq length="<<max_size<<", msg length="<<blob.second<<"): " << strerror(errno) << endlog();
+bool MQSendRecv::mqNotify()
+{
+    char note = 0;
+    if (mq_send(msigdes, &note, sizeof(note), 0) == -1 && errno != EAGAIN)
+    {
+        log(Error) << "MQChannel "<< mqdes << " could not announce new data: " << strerror(errno) << endlog();
         return false;
     }
     return true;
 }
 
+bool MQSendRecv::mqNotified()
+{
+    char note;
+    bool notified = false;
+    while (mq_receive(msigdes, &note, sizeof(note), 0) != -1)
+        notified = true;
+    if (notified)
+        mpull_notified = true;
+    return mpull_notified;
+}
+
+bool MQSendRecv::mqNextRequest(unsigned int& seq, int& count)
+{
+    MQRequest request;
+    if (mq_receive(mreqdes, (char*) &request, sizeof(request), 0) != ssize_t(sizeof(request)))
+        return false;
+    seq = request.seq;
+    count = request.count;
+    return true;
+}
+
+bool MQSendRecv::mqReply(unsigned int seq)
+{
+    // the samples of the reply are sent before its end.
+    if (!mqFlush())
+        return false;
+    // the receiver no longer waits for the end of an older reply.
+    mend_pending = false;
+    if (sendMessage(0, seq, EndMark))
+        return true;
+    // sendMessage() returns right away when the queue is full.
+    if (errno != EAGAIN)
+        return false;
+    mend_seq = seq;
+    mend_pending = true;
+    if (mend_des != mqdes)
+    {
+        if (mend_des >= 0)
+            Dispatcher::Instance()->removeWritable(mend_des);
+        mend_des = mqdes;
+        Dispatcher::Instance()->addWritable(mqdes, this);
+    }
+    return true;
+}
+
+void MQSendRecv::mqResendEnd()
+{
+    os::MutexLock lock(msend_lock);
+    if (mend_pending && (sendMessage(0, mend_seq, EndMark) || errno != EAGAIN))
+        mend_pending = false;
+    // keep watching while the queue is still full.
+    if (mend_pending && mend_des == mqdes)
+        return;
+    if (mend_des >= 0)
+        Dispatcher::Instance()->removeWritable(mend_des);
+    mend_des = -1;
+    // the end did not fit in the queue which replaced the watched one.
+    if (mend_pending)
+    {
+        mend_des = mqdes;
+        Dispatcher::Instance()->addWritable(mqdes, this);
+    }
+}
+
+bool MQSendRecv::mqRequest()
+{
+    nsecs now = os::TimeService::Instance()->getNSecs();
+    int waiting = mpull_waiting;
+    if (waiting && now - mpull_time < Seconds_to_nsecs(0.5))
+        return false;
+    // only one thread sends, a lost reply may be requested twice.
+    if (!os::CAS(&mpull_waiting, waiting, 1))
+        return false;
+    mpull_time = now;
+    mpull_notified = false;
+    MQRequest request;
+    request.seq = ++mpull_seq;
+    request.count = mpull_count;
+    if (mq_send(mreqdes, (const char*) &request, sizeof(request), 0) == -1)
+    {
+        log(Error) << "MQChannel "<< mqdes << " could not request samples: " << strerror(errno) << endlog();
+        mpull_waiting = 0;
+        return false;
+    }
+    return true;
+}
+
+bool MQSendRecv::mqReadReply(RTT::base::DataSourceBase::shared_ptr ds)
+{
+    if (mqPending())
+        return unpackRecord(ds);
+
+    // an absolute timeout in the past only takes the messages which arrived.
+    struct timespec abs_timeout = { 0, 0 };
+    while (true)
+    {
+        const char* data = 0;
+        int size = 0;
+        switch ( mqReceive(&abs_timeout, data, size) )
+        {
+        case ReceiveFailed:
+            return false;
+        case ReceivePartial:
+            continue;
+        case ReceiveEnd:
+            // the end of an earlier request, of which the reply came too late.
+            if ((unsigned int) size != mpull_seq)
+                continue;
+            mpull_waiting = 0;
+            return false;
+        case ReceiveWhole:
+            if (mbatch_size)
+            {
+                batch_used = size;
+                batch_count = 0;
+                return unpackRecord(ds);
+            }
+            break;
+        case ReceiveReassembled:
+            break;
+        }
+        return mtransport.updateFromBlob((void*) data, size, ds, marshaller_cookie);
+    }
+}
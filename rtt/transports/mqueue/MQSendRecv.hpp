@@ -40,8 +40,13 @@
 #define ORO_MQSENDER_HPP_
 
 #include <mqueue.h>
+#include <string>
+#include <utility>
+#include <vector>
 #include "../../rtt-fwd.hpp"
 #include "../../base/DataSourceBase.hpp"
+#include "../../Time.hpp"
+#include "../../os/Mutex.hpp"
 
 namespace RTT
 {
@@ -50,6 +55,21 @@ namespace RTT
         /**
          * Implements the sending/receiving of mqueue messages.
          * It can only be OR sender OR receiver (logical XOR).
+         *
+         * Every message starts with a frame header which holds the size of
+         * the sample (or batch) and the offset of the message's payload in
+         * it. A sample which does not fit in one message is sent in several
+         * fragments, which the receiver reassembles. The sender first tries to
+         * continue on a new queue with a larger message size, as long as the
+         * system's msgsize_max allows it, and tells the receiver to follow
+         * with a resize message.
+         *
+         * In pull mode (ConnPolicy::pull), the sender only marshals the
+         * samples the receiver asks for. The receiver sends a request on a
+         * second queue and the sender answers with at most the requested
+         * number of new samples of its local data object or buffer,
+         * followed by an end message. New data is only announced, on a
+         * third queue which holds at most one notification.
          */
         class MQSendRecv
         {
@@ -62,7 +82,8 @@ namespace RTT
             /**
              * A private blob that is returned by mtransport.getCookie(). It is
              * used by the marshallers if they need private internal data to do
-             * the marshalling
+             * the marshalling. A pull sender uses it from two threads, see
+             * msend_lock.
              */
             void* marshaller_cookie;
             /**
@@ -70,13 +91,33 @@ namespace RTT
              */
             mqd_t mqdes;
             /**
-             * Send/Receive buffer. It is initialized to the size of the value
-             * provided by the ConnPolicy or, if the policy has a zero data
-             * size, the sample given to setupStream
+             * Marshalling buffer of a sender for samples which do not fit
+             * in one message, reassembly buffer of a receiver. It is taken
+             * from the MQBufferPool when needed.
              *
-             * Its size is saved in max_size
+             * Its size is saved in buf_size
              */
             char* buf;
+            /**
+             * The size of buf.
+             */
+            int buf_size;
+            /**
+             * Send/Receive buffer of one message, including the frame
+             * header. It is taken from the MQBufferPool and holds at
+             * least msg_size bytes.
+             *
+             * Its size is saved in msg_capacity
+             */
+            char* msg;
+            /**
+             * The size of msg.
+             */
+            int msg_capacity;
+            /**
+             * The message size of the queue.
+             */
+            int msg_size;
             /**
              * True if this object is a sender.
              */
@@ -86,22 +127,273 @@ namespace RTT
              */
             bool minit_done;
             /**
-             * The size of buf.
+             * The largest sample which is sent without fragmenting it.
              */
             int max_size;
             /**
              * The name of the queue, as specified in the ConnPolicy when
              * creating the stream, or self-calculated when that name was empty.
+             * After a resize, the generation number is appended to it.
              */
             std::string mqname;
+            /**
+             * The name of the first queue of this stream.
+             */
+            std::string mqbase;
+            /**
+             * The number of times the queue was resized.
+             */
+            unsigned int mgeneration;
+            /**
+             * The queues of a sender which were replaced by a resize, with
+             * their names. A name is unlinked when the receiver emptied the
+             * queue, such that it has opened the queue before: the receiver
+             * may be several resizes behind.
+             */
+            std::vector< std::pair<mqd_t, std::string> > mretired;
             /**
              * The size of the data, as specified in the ConnPolicy when
-             * creating the stream, or calculated using the transport when
-             * that size was zero.
+             * creating the stream, or zero when it was calculated using
+             * the transport. It only sizes the first queue.
              */
             int mdata_size;
+            /**
+             * The size of the sample being reassembled, or zero.
+             */
+            int frag_size;
+            /**
+             * The number of bytes of the sample being reassembled
+             * which were received so far.
+             */
+            int frag_filled;
+
+            /**
+             * The maximum number of samples packed in one message, or
+             * zero if batching is disabled. See ConnPolicy::batch_size.
+             */
+            int mbatch_size;
+            /**
+             * The maximum age of an incomplete batch, or zero if the
+             * batch is only sent when full or flushed.
+             */
+            nsecs mbatch_period;
+            /**
+             * A batch of a sender. Each record is a size header followed by
+             * the marshalled sample, padded to BatchAlign, behind the frame
+             * header in data.
+             */
+            struct Batch {
+                /** The message buffer, taken from the MQBufferPool. */
+                char* data;
+                /** The size of data. */
+                int capacity;
+                /** The number of bytes of the records. */
+                int used;
+                /** The number of records. */
+                int count;
+                /** The time the first record was added. */
+                nsecs start;
+            };
+            /**
+             * The two batches of a sender. The writer fills the current one.
+             * While the Dispatcher sends an expired current batch, the
+             * writer fills the other one, which becomes the current one
+             * afterwards. Neither side ever waits for the other.
+             */
+            Batch mbatch[2];
+            /**
+             * The index of the current batch (BatchCurrent) and which side
+             * uses it: BatchBusy while the writer uses the batches,
+             * BatchClaimed while the Dispatcher sends the current one.
+             */
+            volatile int mbatch_state;
+            /**
+             * The number of bytes of the received batch in msg, after the
+             * frame header.
+             */
+            int batch_used;
+            /**
+             * The offset of the next record of the received batch to unpack.
+             */
+            int batch_count;
+
+            /**
+             * True if the receiver pulls the samples from the sender.
+             */
+            bool mpull;
+            /**
+             * The request queue of a pull connection, or -1.
+             */
+            mqd_t mreqdes;
+            /**
+             * The notification queue of a pull connection, or -1.
+             */
+            mqd_t msigdes;
+            /**
+             * The number of samples a receiver asks for in one request.
+             */
+            int mpull_count;
+            /**
+             * The sequence number of the last request of a receiver.
+             */
+            unsigned int mpull_seq;
+            /**
+             * Non-zero while the reply to the last request did not end yet.
+             * Both the reading thread and the Dispatcher send requests, the
+             * one which sets this flag sends.
+             */
+            volatile int mpull_waiting;
+            /**
+             * True if the sender announced data which was not requested yet.
+             */
+            volatile bool mpull_notified;
+            /**
+             * The time the last request was sent.
+             */
+            nsecs mpull_time;
+            /**
+             * True if the end of the reply to request mend_seq did not fit
+             * in the full queue. The Dispatcher resends it with
+             * mqResendEnd() when the queue has room again.
+             */
+            bool mend_pending;
+            /**
+             * The sequence number of the pending end of a reply.
+             */
+            unsigned int mend_seq;
+            /**
+             * The queue which the Dispatcher watches for room for the
+             * pending end of a reply, or -1. After a resize, this is a
+             * retired queue, which is kept open until it is unwatched.
+             */
+            mqd_t mend_des;
+            /**
+             * Serializes the sending of a pull sender: the Dispatcher
+             * replies to requests while the writing thread may send the
+             * initial sample with data_sample(). Both use msg and the
+             * marshaller cookie.
+             */
+            os::Mutex msend_lock;
+
+            /**
+             * The result of mqReceive().
+             */
+            enum ReceiveResult { ReceiveFailed = -1, ReceivePartial, ReceiveWhole, ReceiveReassembled, ReceiveEnd };
+
+            /**
+             * Returns the size of the messages which carry samples of
+             * \a sample_size bytes.
+             */
+            int messageSize(int sample_size) const;
+
+            /**
+             * Takes msg_size from the opened queue and sizes msg and max_size.
+             */
+            void useQueue(mqd_t mq);
+
+            /**
+             * Marshals \a ds into buf, growing buf if needed.
+             */
+            std::pair<void const*, int> marshal(base::DataSourceBase::shared_ptr ds);
+
+            /**
+             * Sends msg with a frame header for \a size bytes of payload.
+             */
+            bool sendMessage(int size, int total, int offset);
+
+            /**
+             * Sends \a message with a frame header for \a size bytes of payload.
+             */
+            bool sendMessage(char* message, int size, int total, int offset);
+
+            /**
+             * Sends a marshalled sample in fragments of at most one message.
+             */
+            bool sendFragments(const char* data, int size);
+
+            /**
+             * Continues a sender on a new queue of which the messages
+             * hold samples of \a sample_size bytes.
+             * @return false if the queue could not be resized, in which
+             * case the current queue is used further.
+             */
+            bool mqResize(int sample_size);
+
+            /**
+             * Unlinks and closes the retired queues which the receiver
+             * emptied, or all of them if \a all is set.
+             */
+            void unlinkRetired(bool all);
+
+            /**
+             * Continues a receiver on the queue of generation \a generation.
+             */
+            bool mqReopen(unsigned int generation);
+
+            /**
+             * Receives one message and handles resize and fragment messages.
+             * @param data is set to the payload of a whole message or to the
+             * reassembled sample.
+             * @param size is set to the size of data.
+             */
+            ReceiveResult mqReceive(const struct timespec* abs_timeout, const char*& data, int& size);
+
+            /**
+             * Flags of mbatch_state.
+             */
+            enum { BatchCurrent = 1, BatchClaimed = 2, BatchBusy = 4 };
+
+            /**
+             * Marks the batches as used by the writer.
+             * @return the state before, which tells which batch to fill.
+             */
+            int enterBatch();
+
+            /**
+             * Ends enterBatch().
+             */
+            void leaveBatch();
+
+            /**
+             * Returns the current batch. Only valid between enterBatch()
+             * and leaveBatch() while the Dispatcher did not claim it.
+             */
+            Batch& currentBatch() { return mbatch[mbatch_state & BatchCurrent]; }
+
+            /**
+             * Adds the sample in \a ds to \a batch and sends the batch when
+             * it is full. In \a overflow mode, the Dispatcher is sending the
+             * other batch, and nothing may be sent.
+             * @return false if the batch could not be sent, or if the sample
+             * was dropped because it did not fit in the overflow batch.
+             */
+            bool writeBatch(base::DataSourceBase::shared_ptr ds, Batch& batch, bool overflow);
+
+            /**
+             * Sends \a batch, if it is not empty.
+             */
+            bool sendBatch(Batch& batch);
+
+            /**
+             * Unpacks the next record of the received batch into ds.
+             */
+            bool unpackRecord(base::DataSourceBase::shared_ptr ds);
+
+            /**
+             * Opens the request and notification queues of a pull connection.
+             */
+            void openPullQueues();
 
         public:
+            /**
+             * The size of the frame header at the start of each message.
+             */
+            static const int FrameSize = 8;
+            /**
+             * Records in a batch start at multiples of this number of bytes.
+             */
+            static const int BatchAlign = 8;
+
             /**
              * Create a channel element for remote data exchange.
              * @param transport The type specific object that will be used to marshal the data.
@@ -115,18 +407,21 @@ namespace RTT
             void cleanupStream();
 
             /**
-             * Adapts the mq send/receive buffer size according to the
-             * data in mqdata_source, or the value set in mdata_size;
+             * Resizes the queue of a sender such that the sample in ds fits in
+             * one message, if the system limits allow it.
              * @param sample
              */
             virtual void mqNewSample(base::DataSourceBase::shared_ptr ds);
 
             /**
-             * Works only in receive mode, waits for a new sample and
-             * adapts the receive buffer to match it's size.
-             * @return
+             * Works only in receive mode, waits for the initial sample
+             * and adapts the receive buffer to match it's size.
+             * If the initial sample came in a batch with more samples,
+             * these are pending, see mqPending(), and must be read with
+             * mqRead() before mqListen() is called.
+             * @return true if the initial sample was received.
              */
-            virtual bool mqReady(base::DataSourceBase::shared_ptr ds, base::ChannelElementBase* chan);
+            virtual bool mqReady(base::DataSourceBase::shared_ptr ds);
 
             /**
              * Read from the message queue.
@@ -142,6 +437,106 @@ namespace RTT
              * @return true if it could be sent.
              */
             bool mqWrite(base::DataSourceBase::shared_ptr ds);
+
+            /**
+             * Sends the samples which were batched by mqWrite() so far.
+             * Does nothing if batching is disabled or the batch is empty.
+             * @return false if the batch could not be sent.
+             */
+            bool mqFlush();
+
+            /**
+             * Sends the current batch if it is older than the batch
+             * period. Called periodically by the Dispatcher.
+             * @param now the current time in nanoseconds.
+             */
+            void mqFlushExpired(nsecs now);
+
+            /**
+             * Returns the batch period of a sender, or zero if incomplete
+             * batches are not flushed periodically.
+             */
+            nsecs mqBatchPeriod() const { return mbatch_period; }
+
+            /**
+             * Returns true if a receiver has samples of the last received
+             * batch which were not read yet by mqRead().
+             */
+            bool mqPending() const { return !mis_sender && mbatch_size && batch_count < batch_used; }
+
+            /**
+             * Returns the message size of the queue, which grows when a
+             * sender resizes it.
+             */
+            int mqMessageSize() const { return msg_size; }
+
+            /**
+             * Returns true if the receiver pulls the samples from the sender.
+             */
+            bool mqIsPull() const { return mpull; }
+
+            /**
+             * Lets the Dispatcher signal \a chan when the receiver gets
+             * new samples (or, in pull mode, is notified of them or gets
+             * a reply), or, in pull mode on the sender, when a request arrives.
+             */
+            void mqListen(base::ChannelElementBase* chan);
+
+            /**
+             * Works only in pull mode on the sender: tells the receiver
+             * that new data is available, unless it was told so already.
+             */
+            bool mqNotify();
+
+            /**
+             * Works only in pull mode on the receiver: consumes the
+             * notifications of the sender.
+             * @return true if new data was announced which was not
+             * requested since.
+             */
+            bool mqNotified();
+
+            /**
+             * Works only in pull mode on the sender: takes the next request
+             * from the request queue, without blocking.
+             * @param seq is set to the sequence number of the request.
+             * @param count is set to the number of samples requested.
+             * @return false if there is no request.
+             */
+            bool mqNextRequest(unsigned int& seq, int& count);
+
+            /**
+             * Works only in pull mode on the sender: ends the reply to
+             * request \a seq, after the samples were sent with mqWrite().
+             * If the queue is full, the end is kept pending and the
+             * Dispatcher sends it as soon as the queue has room, see
+             * mqResendEnd(). A later reply replaces a pending end.
+             */
+            bool mqReply(unsigned int seq);
+
+            /**
+             * Works only in pull mode on the sender, from the Dispatcher:
+             * resends the end of a reply which did not fit in the queue,
+             * once the receiver made room, and stops watching the queue.
+             */
+            void mqResendEnd();
+
+            /**
+             * Works only in pull mode on the receiver: asks the sender
+             * for the next samples, unless the reply to the last request
+             * is still on its way. A request of which the reply did not
+             * end in time is repeated. May be called from any thread.
+             * @return true if a request was sent.
+             */
+            bool mqRequest();
+
+            /**
+             * Works only in pull mode on the receiver, from the Dispatcher:
+             * reads the next sample of the replies which arrived so far,
+             * without waiting.
+             * @return false if no more samples arrived.
+             */
+            bool mqReadReply(base::DataSourceBase::shared_ptr ds);
         };
     }
 }
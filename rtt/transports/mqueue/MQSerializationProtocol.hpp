@@ -48,35 +48,131 @@
 
 #include "MQTemplateProtocolBase.hpp"
 #include "binary_data_archive.hpp"
-#include <boost/iostreams/stream.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <iostream>
+#include <boost/serialization/is_bitwise_serializable.hpp>
+#include <cstring>
 namespace RTT
 {
 
     namespace mqueue
     {
 
+        /**
+         * Marshals a T with the binary_data_archive, directly in the
+         * blob. Bitwise serializable types are copied with memcpy.
+         */
         template<class T>
         class MQSerializationProtocol
         : public RTT::mqueue::MQTemplateProtocolBase<T>
         {
+            typedef boost::mpl::bool_< boost::serialization::is_bitwise_serializable<T>::value > is_bitwise;
+
+            /**
+             * The cookie of a channel: the typed data sources of the last
+             * source and target, such that they are only cast once.
+             */
+            struct Cookie {
+                Cookie() : source(0), typed_source(0), target(0), typed_target(0) {}
+                base::DataSourceBase::shared_ptr source;
+                internal::DataSource<T>* typed_source;
+                base::DataSourceBase::shared_ptr target;
+                internal::AssignableDataSource<T>* typed_target;
+            };
+
+            static internal::DataSource<T>* typedSource(base::DataSourceBase::shared_ptr const& source, void* cookie)
+            {
+                Cookie* c = static_cast<Cookie*>(cookie);
+                if ( c && c->source == source )
+                    return c->typed_source;
+                internal::DataSource<T>* d = dynamic_cast< internal::DataSource<T>* >( source.get() );
+                if ( c && d ) {
+                    c->source = source;
+                    c->typed_source = d;
+                }
+                return d;
+            }
+
+            static internal::AssignableDataSource<T>* typedTarget(base::DataSourceBase::shared_ptr const& target, void* cookie)
+            {
+                Cookie* c = static_cast<Cookie*>(cookie);
+                if ( c && c->target == target )
+                    return c->typed_target;
+                internal::AssignableDataSource<T>* ad = internal::AssignableDataSource<T>::narrow( target.get() );
+                if ( c && ad ) {
+                    c->target = target;
+                    c->typed_target = ad;
+                }
+                return ad;
+            }
+
+            static std::pair<void const*,int> save(T const& sample, void* blob, int size, boost::mpl::true_)
+            {
+                if ( sizeof(T) > (unsigned int)size )
+                    return std::make_pair((void*)0,int(0));
+                std::memcpy( blob, &sample, sizeof(T) );
+                return std::make_pair( blob, int(sizeof(T)) );
+            }
+
+            static std::pair<void const*,int> save(T const& sample, void* blob, int size, boost::mpl::false_)
+            {
+                try {
+                    binary_data_oarchive out( blob, size );
+                    out << sample;
+                    return std::make_pair( blob, out.getArchiveSize() );
+                } catch ( boost::archive::archive_exception& ) {
+                    // the sample does not fit in the blob.
+                    return std::make_pair((void*)0,int(0));
+                }
+            }
+
+            static bool load(const void* blob, int size, T& sample, boost::mpl::true_)
+            {
+                if ( sizeof(T) > (unsigned int)size )
+                    return false;
+                std::memcpy( &sample, blob, sizeof(T) );
+                return true;
+            }
+
+            static bool load(const void* blob, int size, T& sample, boost::mpl::false_)
+            {
+                try {
+                    binary_data_iarchive in( blob, size );
+                    in >> sample;
+                    return true;
+                } catch ( boost::archive::archive_exception& ) {
+                    return false;
+                }
+            }
+
+            static unsigned int sampleSize(T const& sample, boost::mpl::true_)
+            {
+                return sizeof(T);
+            }
+
+            static unsigned int sampleSize(T const& sample, boost::mpl::false_)
+            {
+                binary_data_oarchive out;
+                out << sample;
+                return out.getArchiveSize();
+            }
         public:
             MQSerializationProtocol() {
             }
 
+            virtual void* createCookie() const
+            {
+                return new Cookie();
+            }
+
+            virtual void deleteCookie(void* cookie) const
+            {
+                delete static_cast<Cookie*>(cookie);
+            }
+
             virtual std::pair<void const*,int> fillBlob( base::DataSourceBase::shared_ptr source, void* blob, int size, void* cookie) const
             {
-                namespace io = boost::iostreams;
-                typename internal::DataSource<T>::shared_ptr d = boost::dynamic_pointer_cast< internal::DataSource<T> >( source );
-                if ( d ) {
-                    // we use the boost iostreams library for re-using the blob buffer in the stream object.
-                    // and the serialization library to write the data into stream.
-                    io::stream<io::array_sink>  outbuf( (char*)blob, size);
-                    binary_data_oarchive out( outbuf );
-                    out << d->rvalue();
-                    return std::make_pair( blob, out.getArchiveSize() );
-                }
+                internal::DataSource<T>* d = typedSource( source, cookie );
+                if ( d )
+                    return save( d->rvalue(), blob, size, is_bitwise() );
                 return std::make_pair((void*)0,int(0));
             }
 
@@ -84,30 +180,20 @@ namespace RTT
             * Update \a target with the contents of \a blob which is an object of a \a protocol.
             */
             virtual bool updateFromBlob(const void* blob, int size, base::DataSourceBase::shared_ptr target, void* cookie) const {
-                namespace io = boost::iostreams;
-                typename internal::AssignableDataSource<T>::shared_ptr ad = internal::AssignableDataSource<T>::narrow( target.get() );
-                if ( ad ) {
-                    io::stream<io::array_source>  inbuf((const char*)blob, size);
-                    binary_data_iarchive in( inbuf );
-                    in >> ad->set();
-                    return true;
-                }
+                internal::AssignableDataSource<T>* ad = typedTarget( target, cookie );
+                if ( ad )
+                    return load( blob, size, ad->set(), is_bitwise() );
                 return false;
             }
 
             virtual unsigned int getSampleSize(base::DataSourceBase::shared_ptr sample, void* cookie) const {
-                typename internal::DataSource<T>::shared_ptr tsample = boost::dynamic_pointer_cast< internal::DataSource<T> >( sample );
+                internal::DataSource<T>* tsample = typedSource( sample, cookie );
                 if ( ! tsample ) {
                     log(Error) << "getSampleSize: sample has wrong type."<<endlog();
                     return 0;
                 }
-                namespace io = boost::iostreams;
-                char sink[1];
-                io::stream<io::array_sink>  outbuf(sink,1);
-                binary_data_oarchive out( outbuf, false );
-                out << tsample->get();
-                //std::cout << "sample size is "<< tsample->rvalue().size() <<" archive is " << out.getArchiveSize() <<std::endl; //disable all types but std::vector<double> for this to compile
-                return out.getArchiveSize();
+                tsample->evaluate();
+                return sampleSize( tsample->rvalue(), is_bitwise() );
             }
         };
 
@@ -61,6 +61,10 @@
  *
  * No class information or cross-references are stored.
  *
+ * The archives either use a std::streambuf or, when constructed from a
+ * blob, read and write that blob directly with a raw cursor, which avoids
+ * the overhead of a stream object per sample.
+ *
  * This archive is header-only and does not depend on the serialization DLL.
  *
  */
@@ -113,7 +117,9 @@ namespace RTT
          */
         class binary_data_iarchive
         {
-            std::streambuf& m_sb;
+            std::streambuf* m_sb;
+            const char* m_blob;
+            std::size_t m_size;
             int data_read;
         public:
             typedef char Elem;
@@ -133,7 +139,7 @@ namespace RTT
              * @param os The stream to serialize from.
              */
             binary_data_iarchive(std::streambuf& bsb) :
-                m_sb(bsb), data_read(0)
+                m_sb(&bsb), m_blob(0), m_size(0), data_read(0)
             {
             }
 
@@ -142,7 +148,18 @@ namespace RTT
              * @param os The buffer to serialize from.
              */
             binary_data_iarchive(std::istream& is) :
-                m_sb(*is.rdbuf()), data_read(0)
+                m_sb(is.rdbuf()), m_blob(0), m_size(0), data_read(0)
+            {
+            }
+
+            /**
+             * Constructor from a memory area, which is read without
+             * a stream.
+             * @param blob The memory to serialize from.
+             * @param size The number of bytes in blob.
+             */
+            binary_data_iarchive(const void* blob, std::size_t size) :
+                m_sb(0), m_blob(static_cast<const char*>(blob)), m_size(size), data_read(0)
             {
             }
 
@@ -260,9 +277,24 @@ namespace RTT
              */
             void load_binary(void *address, std::size_t count)
             {
+                if (!m_sb) {
+                    if (data_read + count > m_size)
+#if BOOST_VERSION >= 104400
+                        boost::serialization::throw_exception(
+                                boost::archive::archive_exception(
+                                        boost::archive::archive_exception::input_stream_error));
+#else
+                        boost::serialization::throw_exception(
+                                boost::archive::archive_exception(
+                                        boost::archive::archive_exception::stream_error));
+#endif
+                    std::memcpy(address, m_blob + data_read, count);
+                    data_read += count;
+                    return;
+                }
                 // note: an optimizer should eliminate the following for char files
                 std::streamsize s = count / sizeof(Elem);
-                std::streamsize scount = m_sb.sgetn(
+                std::streamsize scount = m_sb->sgetn(
                         static_cast<Elem *> (address), s);
                 if (scount != static_cast<std::streamsize> (s))
 #if BOOST_VERSION >= 104400
@@ -283,7 +315,7 @@ namespace RTT
                     //                archive_exception(archive_exception::stream_error)
                     //        );
                     Elem t;
-                    scount = m_sb.sgetn(&t, 1);
+                    scount = m_sb->sgetn(&t, 1);
                     if (scount != 1)
 #if BOOST_VERSION >= 104400
                         boost::serialization::throw_exception(
@@ -369,7 +401,9 @@ namespace RTT
          */
         class binary_data_oarchive
         {
-            std::streambuf & m_sb;
+            std::streambuf* m_sb;
+            char* m_blob;
+            std::size_t m_size;
             int data_written;
             bool mdo_save;
         public:
@@ -392,7 +426,7 @@ namespace RTT
              * in advance how much space you will need.
              */
             binary_data_oarchive(std::ostream& os,bool do_save = true) :
-                m_sb(*os.rdbuf()), data_written(0), mdo_save(do_save)
+                m_sb(os.rdbuf()), m_blob(0), m_size(0), data_written(0), mdo_save(do_save)
             {
             }
 
@@ -405,7 +439,29 @@ namespace RTT
              * in advance how much space you will need.
              */
             binary_data_oarchive(std::streambuf& sb,bool do_save = true) :
-                m_sb(sb), data_written(0), mdo_save(do_save)
+                m_sb(&sb), m_blob(0), m_size(0), data_written(0), mdo_save(do_save)
+            {
+            }
+
+            /**
+             * Constructor from a memory area, which is written without
+             * a stream.
+             * @param blob The memory to serialize to.
+             * @param size The number of bytes available in blob.
+             */
+            binary_data_oarchive(void* blob, std::size_t size) :
+                m_sb(0), m_blob(static_cast<char*>(blob)), m_size(size), data_written(0), mdo_save(true)
+            {
+            }
+
+            /**
+             * Constructor of a size-only archive. Nothing is written,
+             * only the counter for getArchiveSize() increases. Arrays of
+             * bitwise serializable elements are counted at once,
+             * without visiting the elements.
+             */
+            binary_data_oarchive() :
+                m_sb(0), m_blob(0), m_size(0), data_written(0), mdo_save(false)
             {
             }
 
@@ -466,8 +522,20 @@ namespace RTT
             {
                 // figure number of elements to output - round up
                 count = (count + sizeof(Elem) - 1) / sizeof(Elem);
-                if (mdo_save) {
-                    std::streamsize scount = m_sb.sputn(
+                if (mdo_save && !m_sb) {
+                    if (data_written + count > m_size)
+#if BOOST_VERSION >= 104400
+                        boost::serialization::throw_exception(
+                                boost::archive::archive_exception(
+                                        boost::archive::archive_exception::output_stream_error));
+#else
+                        boost::serialization::throw_exception(
+                                boost::archive::archive_exception(
+                                        boost::archive::archive_exception::stream_error));
+#endif
+                    std::memcpy(m_blob + data_written, address, count);
+                } else if (mdo_save) {
+                    std::streamsize scount = m_sb->sputn(
                             static_cast<const Elem *> (address), count);
                     if (count != static_cast<std::size_t> (scount))
 #if BOOST_VERSION >= 104400
@@ -0,0 +1,217 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_SHM_DISPATCHER_HPP_
+#define ORO_SHM_DISPATCHER_HPP_
+
+#include "../../os/MutexLock.hpp"
+#include "../../Activity.hpp"
+#include "../../Logger.hpp"
+#include "SHMSendRecv.hpp"
+#include <map>
+#include <cstring>
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace RTT { namespace shm { class Dispatcher; } }
+
+namespace RTT {
+    namespace shm {
+        RTT_API void intrusive_ptr_add_ref(const RTT::shm::Dispatcher* p );
+        RTT_API void intrusive_ptr_release(const RTT::shm::Dispatcher* p );
+
+        /**
+         * This object waits on the wake-up FIFOs of all receiving
+         * rings of this process and lets each ready ring forward its
+         * samples into its channel. One thread serves all
+         * connections, like the mqueue Dispatcher does.
+         */
+        class Dispatcher : public Activity
+        {
+            friend void intrusive_ptr_add_ref(const RTT::shm::Dispatcher* p );
+            friend void intrusive_ptr_release(const RTT::shm::Dispatcher* p );
+            mutable os::AtomicInt refcount;
+            static Dispatcher* DispatchI;
+
+            typedef std::map<int,SHMSendRecv*> RingMap;
+            RingMap ringmap;
+
+            bool do_exit;
+
+            /**
+             * Held while a ring is dispatched, such that removeRing()
+             * returns only when its ring is no longer served.
+             */
+            os::Mutex maplock;
+
+            /**
+             * The maximum number of ready rings handled per wake-up.
+             */
+            static const int MaxEvents = 64;
+
+            int epfd;            /* The epoll set with all wake-up FIFOs and wakefd */
+
+            int wakefd;          /* An eventfd to wake up epoll_wait() */
+
+            struct epoll_event events[MaxEvents];
+
+            Dispatcher( const std::string& name)
+            : Activity(ORO_SCHED_RT, os::HighestPriority, 0.0, 0, name),
+              do_exit(false), epfd(-1), wakefd(-1)
+              {
+                  epfd = epoll_create1(EPOLL_CLOEXEC);
+                  wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+                  if (epfd < 0 || wakefd < 0) {
+                      log(Error) <<"SHM Dispatcher failed to create its epoll set: "<<strerror(errno)<<endlog();
+                      return;
+                  }
+                  struct epoll_event ev;
+                  ev.events = EPOLLIN;
+                  ev.data.fd = wakefd;
+                  epoll_ctl(epfd, EPOLL_CTL_ADD, wakefd, &ev);
+              }
+
+            ~Dispatcher() {
+                Logger::In in("SHMDispatcher");
+                log(Info) << "Dispacher cleans up: no more work."<<endlog();
+                stop();
+                if (wakefd >= 0)
+                    close(wakefd);
+                if (epfd >= 0)
+                    close(epfd);
+                DispatchI = 0;
+            }
+
+            /**
+             * Wakes up the loop, which checks do_exit.
+             */
+            void wakeup() {
+                eventfd_write(wakefd, 1);
+            }
+
+            void read_events(int count) {
+                /* Dispatch the ready rings. A ring removed after
+                   epoll_wait() returned is no longer in ringmap. */
+                os::MutexLock lock(maplock);
+                for (int i = 0; i != count; ++i) {
+                    if ( events[i].data.fd == wakefd ) {
+                        eventfd_t value;
+                        eventfd_read(wakefd, &value);
+                        continue;
+                    }
+                    RingMap::iterator it = ringmap.find( events[i].data.fd );
+                    if ( it != ringmap.end() )
+                        it->second->shmDispatch();
+                }
+            }
+
+        public:
+            typedef boost::intrusive_ptr<Dispatcher> shared_ptr;
+
+            static Dispatcher::shared_ptr Instance() {
+                if ( DispatchI == 0) {
+                    DispatchI = new Dispatcher("SHMDispatch");
+                    DispatchI->start();
+                }
+                return DispatchI;
+            }
+
+            /**
+             * Dispatches \a ring each time its wake-up FIFO \a fd
+             * becomes readable.
+             */
+            void addRing( int fd, SHMSendRecv* ring ) {
+                Logger::In in("SHMDispatcher");
+                if (fd < 0) {
+                    log(Error) <<"Invalid wake-up FIFO given to SHM Dispatcher." <<endlog();
+                    return;
+                }
+                log(Debug) <<"Dispatcher is monitoring fd "<< fd <<endlog();
+                os::MutexLock lock(maplock);
+                if ( ringmap.count(fd) )
+                    return;
+                // we add a refcount per ring we monitor.
+                refcount.inc();
+                ringmap[fd] = ring;
+                struct epoll_event ev;
+                ev.events = EPOLLIN;
+                ev.data.fd = fd;
+                if ( epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) != 0 )
+                    log(Error) <<"Dispatcher failed to watch fd "<< fd <<": "<<strerror(errno)<<endlog();
+            }
+
+            void removeRing( int fd ) {
+                Logger::In in("SHMDispatcher");
+                log(Debug) <<"Dispatcher drops fd "<< fd <<endlog();
+                os::MutexLock lock(maplock);
+                RingMap::iterator it = ringmap.find(fd);
+                if ( it != ringmap.end() ) {
+                    struct epoll_event ev;
+                    epoll_ctl(epfd, EPOLL_CTL_DEL, fd, &ev);
+                    ringmap.erase(it);
+                    refcount.dec();
+                }
+            }
+
+            bool initialize() {
+                do_exit = false;
+                return true;
+            }
+
+            void loop() {
+                int count;           /* Number of ready rings */
+                while (1) { /* epoll loop */
+                    count = epoll_wait(epfd, events, MaxEvents, -1);
+
+                    if (count < 0) {
+                        if (errno != EINTR)
+                        {
+                            log(Error) <<"SHM Dispatcher failed to wait on its rings. Stopped thread. error: "<<strerror(errno)<<endlog();
+                            return;
+                        }
+                    }
+                    else if (count > 0)
+                        read_events(count);
+
+                    if ( do_exit )
+                        return;
+                } /* while(1) */
+            }
+
+            bool breakLoop() {
+                do_exit = true;
+                wakeup();
+                return true;
+            }
+        };
+    }
+}
+
+#endif /* ORO_SHM_DISPATCHER_HPP_ */
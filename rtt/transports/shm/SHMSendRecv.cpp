@@ -0,0 +1,421 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <poll.h>
+#include <time.h>
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <cassert>
+#include <stdexcept>
+#include <errno.h>
+#include <boost/algorithm/string.hpp>
+
+#include "SHMSendRecv.hpp"
+#include "Dispatcher.hpp"
+#include "../../types/TypeMarshaller.hpp"
+#include "../../Logger.hpp"
+#include "../../base/ChannelElementBase.hpp"
+#include "../../base/PortInterface.hpp"
+#include "../../DataFlowInterface.hpp"
+#include "../../TaskContext.hpp"
+
+using namespace RTT;
+using namespace RTT::detail;
+using namespace RTT::shm;
+
+namespace {
+    /** Set by the creator of a segment once the ring is initialised. */
+    const unsigned int RingMagic = 0x52545453;
+    /** Alignment of the slots and of their payload. */
+    const size_t SlotAlign = 8;
+
+    size_t align(size_t size, size_t to) {
+        return (size + to - 1) & ~(to - 1);
+    }
+
+    nsecs now() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+    }
+
+    /** The directory of the POSIX shared memory segments, in which the wake-up FIFOs are created. */
+    const char* WakeupDir = "/dev/shm";
+
+    std::string wakeupPath(const std::string& shmname) {
+        return WakeupDir + shmname + ".wake";
+    }
+
+    /**
+     * Opens the wake-up FIFO of \a shmname, which is created by the
+     * side that comes first. Opening it for reading and writing never
+     * blocks and never fails for lack of a peer.
+     */
+    int openWakeup(const std::string& shmname) {
+        std::string path = wakeupPath(shmname);
+        if ( mkfifo(path.c_str(), S_IREAD | S_IWRITE) != 0 && errno != EEXIST )
+            return -1;
+        return open(path.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    }
+}
+
+/**
+ * The sender and receiver fields are kept on different cache lines.
+ * The counters are only modified with the gcc atomic builtins, since
+ * the oro_atomic_t of some architectures can not be shared between
+ * processes.
+ */
+struct SHMSendRecv::Ring {
+    unsigned int magic;
+    unsigned int slots;
+    unsigned int slot_size;
+    unsigned int stride;
+    /** Written by the sender: the number of samples written. */
+    volatile unsigned int head __attribute__((aligned(64)));
+    /** Written by the receiver: the number of samples read. */
+    volatile unsigned int tail __attribute__((aligned(64)));
+    /** True while the receiver waits on the wake-up FIFO. */
+    volatile int waiting;
+} __attribute__((aligned(64)));
+
+SHMSendRecv::SHMSendRecv(types::TypeMarshaller const& transport) :
+    mtransport(transport), marshaller_cookie(0), shmfd(-1), mring(0), mmap_size(0), wakefd(-1), mchan(0),
+    mis_sender(false), minit_done(false), max_size(0)
+{
+}
+
+void SHMSendRecv::setupStream(base::DataSourceBase::shared_ptr ds, base::PortInterface* port, ConnPolicy const& policy,
+                              bool is_sender)
+{
+    Logger::In in("SHMSendRecv");
+
+    max_size = policy.data_size ? policy.data_size : mtransport.getSampleSize(ds);
+    marshaller_cookie = mtransport.createCookie();
+    mis_sender = is_sender;
+
+    if (policy.name_id.empty())
+    {
+        if (!port->getInterface() || !port->getInterface()->getOwner() || port->getInterface()->getOwner()->getName().empty())
+            throw std::runtime_error("SHM name_id not set, and the port is either not attached to a task, or said task has no name. Cannot create a reasonably unique SHM name automatically");
+
+        std::stringstream name_stream;
+        name_stream << port->getInterface()->getOwner()->getName() << '.' << port->getName() << '.' << this << '@' << getpid();
+        std::string name = name_stream.str();
+        boost::algorithm::replace_all(name, "/", "_");
+        policy.name_id = "/" + name;
+    }
+
+    if (policy.name_id[0] != '/')
+        throw std::runtime_error("Could not open shared memory with wrong name. Names must start with '/' and contain no more '/' after the first one.");
+    if (max_size <= 0)
+        throw std::runtime_error("Could not open shared memory with zero sample size.");
+
+    unsigned int slots = policy.size ? policy.size : 10;
+    size_t stride = SlotAlign + align(max_size, SlotAlign);
+    size_t header = align(sizeof(Ring), 64);
+
+    // the first side that opens the segment creates and initialises it.
+    bool creator = true;
+    shmfd = shm_open(policy.name_id.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IREAD | S_IWRITE);
+    if (shmfd < 0 && errno == EEXIST) {
+        creator = false;
+        shmfd = shm_open(policy.name_id.c_str(), O_RDWR, 0);
+    }
+    if (shmfd < 0)
+    {
+        log(Error) << "FAILED opening shared memory '" << policy.name_id << "' for " << (is_sender ? "writing: " : "reading: ")
+                   << strerror(errno) << endlog();
+        throw std::runtime_error("Could not open shared memory: shm_open returned -1.");
+    }
+
+    if (creator) {
+        mmap_size = header + slots * stride;
+        if ( ftruncate(shmfd, mmap_size) == -1 ) {
+            log(Error) << "FAILED resizing shared memory '" << policy.name_id << "' to " << mmap_size << " bytes: " << strerror(errno) << endlog();
+            shm_unlink(policy.name_id.c_str());
+            close(shmfd);
+            shmfd = -1;
+            throw std::runtime_error("Could not open shared memory: ftruncate returned -1.");
+        }
+    } else {
+        // the creator may not have resized the segment yet.
+        struct stat st;
+        for (int i = 0; fstat(shmfd, &st) == 0 && st.st_size == 0 && i < 500; ++i)
+            usleep(1000);
+        mmap_size = st.st_size;
+    }
+
+    void* addr = mmap_size >= header ? mmap(0, mmap_size, PROT_READ | PROT_WRITE, MAP_SHARED, shmfd, 0) : MAP_FAILED;
+    if (addr == MAP_FAILED)
+    {
+        log(Error) << "FAILED mapping shared memory '" << policy.name_id << "' of " << mmap_size << " bytes." << endlog();
+        if (creator)
+            shm_unlink(policy.name_id.c_str());
+        close(shmfd);
+        shmfd = -1;
+        throw std::runtime_error("Could not open shared memory: mmap failed.");
+    }
+    mring = static_cast<Ring*>(addr);
+
+    if (creator) {
+        mring->slots = slots;
+        mring->slot_size = stride - SlotAlign;
+        mring->stride = stride;
+        mring->head = 0;
+        mring->tail = 0;
+        mring->waiting = 0;
+        __sync_synchronize();
+        mring->magic = RingMagic;
+    } else {
+        for (int i = 0; mring->magic != RingMagic && i < 500; ++i)
+            usleep(1000);
+        __sync_synchronize();
+        if (mring->magic != RingMagic || mring->slot_size < (unsigned int)max_size || header + mring->slots * mring->stride > mmap_size)
+        {
+            log(Error) << "Shared memory '" << policy.name_id << "' exists, but does not contain a ring for samples of " << max_size << " bytes." << endlog();
+            munmap(mring, mmap_size);
+            mring = 0;
+            close(shmfd);
+            shmfd = -1;
+            throw std::runtime_error("Could not open shared memory: incompatible ring.");
+        }
+    }
+
+    wakefd = openWakeup(policy.name_id);
+    if (wakefd < 0)
+    {
+        log(Error) << "FAILED opening the wake-up FIFO '" << wakeupPath(policy.name_id) << "': " << strerror(errno) << endlog();
+        if (creator)
+            shm_unlink(policy.name_id.c_str());
+        munmap(mring, mmap_size);
+        mring = 0;
+        close(shmfd);
+        shmfd = -1;
+        throw std::runtime_error("Could not open shared memory: no wake-up FIFO.");
+    }
+
+    log(Debug) << "Opened '" << policy.name_id << "' with slot size='" << mring->slot_size << "' and ring length='" << mring->slots << "' for "
+               << (is_sender ? "writing." : "reading.") << endlog();
+
+    shmname = policy.name_id;
+}
+
+SHMSendRecv::~SHMSendRecv()
+{
+    if (minit_done)
+        Dispatcher::Instance()->removeRing(wakefd);
+    if (wakefd >= 0)
+        close(wakefd);
+    if (mring)
+        munmap(mring, mmap_size);
+    if (shmfd >= 0)
+        close(shmfd);
+}
+
+void SHMSendRecv::cleanupStream()
+{
+    if (!mis_sender)
+    {
+        if (minit_done)
+        {
+            // returns when the Dispatcher no longer serves this ring.
+            Dispatcher::Instance()->removeRing(wakefd);
+            mchan = 0;
+            minit_done = false;
+        }
+    }
+    else
+    {
+        // sender unlinks to avoid future re-use of new readers.
+        shm_unlink(shmname.c_str());
+        unlink(wakeupPath(shmname).c_str());
+    }
+    if (wakefd >= 0)
+        close(wakefd);
+    wakefd = -1;
+    // both sender and receiver unmap their end.
+    if (mring)
+        munmap(mring, mmap_size);
+    mring = 0;
+    if (shmfd >= 0)
+        close(shmfd);
+    shmfd = -1;
+
+    if (marshaller_cookie)
+        mtransport.deleteCookie(marshaller_cookie);
+    marshaller_cookie = 0;
+}
+
+char* SHMSendRecv::slot(unsigned int index) const
+{
+    return reinterpret_cast<char*>(mring) + align(sizeof(Ring), 64) + (index % mring->slots) * mring->stride;
+}
+
+bool SHMSendRecv::shmReady(base::DataSourceBase::shared_ptr ds, base::ChannelElementBase* chan)
+{
+    if (minit_done)
+        return true;
+
+    if (!mis_sender)
+    {
+        // Try to get the initial sample
+        //
+        // The output port implementation guarantees that there will be one
+        // after the connection is ready
+        if ( shmWait( Seconds_to_nsecs(0.5) ) && shmRead(ds) )
+        {
+            minit_done = true;
+            // ok, now we can forward the next samples. The wake-up
+            // makes the Dispatcher forward what is already in the ring.
+            mchan = chan;
+            Dispatcher::Instance()->addRing(wakefd, this);
+            mring->waiting = 1;
+            wakeupReceiver();
+            return true;
+        }
+        log(Error) << "Failed to receive initial data sample for SHM Channel Element." << endlog();
+        return false;
+    }
+    return false;
+}
+
+bool SHMSendRecv::shmRead(RTT::base::DataSourceBase::shared_ptr ds)
+{
+    unsigned int tail = mring->tail;
+    if (tail == mring->head)
+        return false;
+    // read the slot only after seeing the sender's head.
+    __sync_synchronize();
+    char* s = slot(tail);
+    bool ok = mtransport.updateFromBlob(s + SlotAlign, *reinterpret_cast<unsigned int*>(s), ds, marshaller_cookie);
+    // hand the slot back only after unmarshalling it.
+    __sync_synchronize();
+    mring->tail = tail + 1;
+    return ok;
+}
+
+bool SHMSendRecv::shmWrite(RTT::base::DataSourceBase::shared_ptr ds)
+{
+    unsigned int head = mring->head;
+    if (head - mring->tail >= mring->slots)
+        return true; // full, drop the sample like a full mqueue.
+
+    // marshal in place: the slot is the blob.
+    char* s = slot(head);
+    std::pair<void const*, int> blob = mtransport.fillBlob(ds, s + SlotAlign, mring->slot_size, marshaller_cookie);
+    if (blob.first == 0)
+    {
+        log(Error) << "SHMChannel: failed to marshal sample" << endlog();
+        return false;
+    }
+    if (blob.second > (int)mring->slot_size)
+    {
+        log(Error) << "SHMChannel "<< shmname << ": sample of " << blob.second << " bytes does not fit in a slot of " << mring->slot_size << " bytes." << endlog();
+        return false;
+    }
+    if (blob.first != s + SlotAlign)
+        memcpy(s + SlotAlign, blob.first, blob.second);
+    *reinterpret_cast<unsigned int*>(s) = blob.second;
+
+    // publish the slot before the head.
+    __sync_synchronize();
+    mring->head = head + 1;
+    // the receiver either sees the head or we see it waiting.
+    __sync_synchronize();
+    if (mring->waiting)
+        wakeupReceiver();
+    return true;
+}
+
+bool SHMSendRecv::shmWait(nsecs timeout)
+{
+    nsecs deadline = now() + timeout;
+    while (true)
+    {
+        if (mring->tail != mring->head)
+            return true;
+        nsecs left = deadline - now();
+        if (left <= 0)
+            return false;
+        mring->waiting = 1;
+        // the sender either sees waiting or we see its head.
+        __sync_synchronize();
+        if (mring->tail == mring->head) {
+            struct pollfd pfd;
+            pfd.fd = wakefd;
+            pfd.events = POLLIN;
+            poll(&pfd, 1, int(std::max(left / 1000000LL, 1LL)));
+        }
+        mring->waiting = 0;
+        drainWakeups();
+    }
+}
+
+void SHMSendRecv::shmDispatch()
+{
+    drainWakeups();
+    bool forwarded;
+    do {
+        mring->waiting = 0;
+        // signal() consumes one sample, also if the output rejects it.
+        forwarded = false;
+        unsigned int tail = mring->tail;
+        while (true) {
+            mchan->signal();
+            if (mring->tail == tail)
+                break;
+            tail = mring->tail;
+            forwarded = true;
+        }
+        mring->waiting = 1;
+        // the sender either sees waiting or we see its head.
+        __sync_synchronize();
+        // without an output, the samples stay in the ring until the next wake-up.
+    } while (forwarded && mring->tail != mring->head);
+}
+
+void SHMSendRecv::wakeupReceiver()
+{
+    char wakeup = 0;
+    // a full FIFO already wakes up the receiver.
+    if ( write(wakefd, &wakeup, 1) < 0 && errno != EAGAIN )
+        log(Error) << "SHMChannel "<< shmname << ": failed to wake up the receiver: " << strerror(errno) << endlog();
+}
+
+void SHMSendRecv::drainWakeups()
+{
+    char buf[64];
+    while ( read(wakefd, buf, sizeof(buf)) > 0 )
+        ;
+}
@@ -0,0 +1,176 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_SHMSENDRECV_HPP_
+#define ORO_SHMSENDRECV_HPP_
+
+#include "../../rtt-fwd.hpp"
+#include "../../base/DataSourceBase.hpp"
+#include "../../Time.hpp"
+
+namespace RTT
+{
+    namespace shm
+    {
+        /**
+         * Implements the sending/receiving of samples through a ring
+         * buffer in POSIX shared memory. It can only be OR sender OR
+         * receiver (logical XOR).
+         *
+         * The ring is lock-free for one sender and one receiver: the
+         * sender marshals each sample directly into a ring slot with
+         * TypeMarshaller::fillBlob() and the receiver unmarshals it
+         * from the slot with TypeMarshaller::updateFromBlob(), without
+         * passing it through the kernel. When the ring is full, new
+         * samples are dropped, like a full message queue does.
+         *
+         * The receiving rings of a process are served by one shared
+         * Dispatcher thread. The sender only wakes it up, by writing
+         * a byte in a FIFO next to the segment, when the receiver
+         * announced that it ran out of samples.
+         */
+        class SHMSendRecv
+        {
+        public:
+            /**
+             * The layout of the start of the shared memory segment.
+             */
+            struct Ring;
+        protected:
+            /**
+             * Transport marshaller used for size calculations
+             * and data updates.
+             */
+            types::TypeMarshaller const& mtransport;
+            /**
+             * A private blob that is returned by mtransport.getCookie(). It is
+             * used by the marshallers if they need private internal data to do
+             * the marshalling
+             */
+            void* marshaller_cookie;
+            /**
+             * Shared memory file descriptor.
+             */
+            int shmfd;
+            /**
+             * The mapped shared memory segment.
+             */
+            Ring* mring;
+            /**
+             * The size of the mapping of mring.
+             */
+            size_t mmap_size;
+            /**
+             * The FIFO which wakes up the receiver, opened by both sides.
+             */
+            int wakefd;
+            /**
+             * The channel into which the Dispatcher forwards received samples.
+             */
+            base::ChannelElementBase* mchan;
+            /**
+             * True if this object is a sender.
+             */
+            bool mis_sender;
+            /**
+             * True if setupStream() was called, false after cleanupStream().
+             */
+            bool minit_done;
+            /**
+             * The largest sample that fits in a slot.
+             */
+            int max_size;
+            /**
+             * The name of the segment, as specified in the ConnPolicy when
+             * creating the stream, or self-calculated when that name was empty.
+             */
+            std::string shmname;
+
+            char* slot(unsigned int index) const;
+
+            /**
+             * Wakes up the receiver if it waits for new samples.
+             */
+            void wakeupReceiver();
+
+            /**
+             * Empties the wake-up FIFO.
+             */
+            void drainWakeups();
+        public:
+            /**
+             * Create a channel element for remote data exchange.
+             * @param transport The type specific object that will be used to marshal the data.
+             */
+            SHMSendRecv(types::TypeMarshaller const& transport);
+
+            void setupStream(base::DataSourceBase::shared_ptr ds, base::PortInterface* port, ConnPolicy const& policy, bool is_sender);
+
+            ~SHMSendRecv();
+
+            void cleanupStream();
+
+            /**
+             * Works only in receive mode, waits for the initial sample
+             * and lets the Dispatcher forward the next ones to \a chan.
+             * @return true if the initial sample was received.
+             */
+            bool shmReady(base::DataSourceBase::shared_ptr ds, base::ChannelElementBase* chan);
+
+            /**
+             * Read one sample from the ring.
+             * @param ds stores the resulting data sample.
+             * @return true if an item could be read.
+             */
+            bool shmRead(base::DataSourceBase::shared_ptr ds);
+
+            /**
+             * Write one sample in the ring.
+             * @param ds the data sample to write
+             * @return true if it could be sent or if it was dropped
+             * because the ring was full.
+             */
+            bool shmWrite(base::DataSourceBase::shared_ptr ds);
+
+            /**
+             * Waits until the ring contains a sample or \a timeout expired.
+             * @return true if a sample can be read.
+             */
+            bool shmWait(nsecs timeout);
+
+            /**
+             * Works only in receive mode: forwards all samples in
+             * the ring to the channel given to shmReady(). Called by
+             * the Dispatcher when the wake-up FIFO is readable.
+             */
+            void shmDispatch();
+        };
+    }
+}
+
+#endif /* ORO_SHMSENDRECV_HPP_ */
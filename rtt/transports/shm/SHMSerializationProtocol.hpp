@@ -0,0 +1,185 @@
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU General Public                   *
+ *   License as published by the Free Software Foundation;                 *
+ *   version 2 of the License.                                             *
+ *                                                                         *
+ *   As a special exception, you may use this file as part of a free       *
+ *   software library without restriction.  Specifically, if other files   *
+ *   instantiate templates or use macros or inline functions from this     *
+ *   file, or you compile this file and link it with other files to        *
+ *   produce an executable, this file does not by itself cause the         *
+ *   resulting executable to be covered by the GNU General Public          *
+ *   License.  This exception does not however invalidate any other        *
+ *   reasons why the executable file might be covered by the GNU General   *
+ *   Public License.                                                       *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public             *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 59 Temple Place,                                    *
+ *   Suite 330, Boston, MA  02111-1307  USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef ORO_SHM_SERIALIZATION_PROTOCOL_HPP
+#define ORO_SHM_SERIALIZATION_PROTOCOL_HPP
+
+#include "SHMTemplateProtocolBase.hpp"
+#include "../mqueue/binary_data_archive.hpp"
+#include <boost/serialization/is_bitwise_serializable.hpp>
+#include <cstring>
+
+namespace RTT
+{ namespace shm
+  {
+      /**
+       * Marshals a T with the binary_data_archive of the mqueue
+       * transport, directly in its ring slot. Bitwise serializable
+       * types are copied with memcpy. Use this protocol for the types
+       * of a typekit that provide a boost::serialization function.
+       *
+       * Since the slots of a ring have a fixed size, connections of
+       * variable sized types must set ConnPolicy::data_size to the
+       * size of the largest serialized sample.
+       */
+      template<class T>
+      class SHMSerializationProtocol
+          : public SHMTemplateProtocolBase<T>
+      {
+          typedef boost::mpl::bool_< boost::serialization::is_bitwise_serializable<T>::value > is_bitwise;
+
+          /**
+           * The cookie of a channel: the typed data sources of the last
+           * source and target, such that they are only cast once.
+           */
+          struct Cookie {
+              Cookie() : source(0), typed_source(0), target(0), typed_target(0) {}
+              base::DataSourceBase::shared_ptr source;
+              internal::DataSource<T>* typed_source;
+              base::DataSourceBase::shared_ptr target;
+              internal::AssignableDataSource<T>* typed_target;
+          };
+
+          static internal::DataSource<T>* typedSource(base::DataSourceBase::shared_ptr const& source, void* cookie)
+          {
+              Cookie* c = static_cast<Cookie*>(cookie);
+              if ( c && c->source == source )
+                  return c->typed_source;
+              internal::DataSource<T>* d = dynamic_cast< internal::DataSource<T>* >( source.get() );
+              if ( c && d ) {
+                  c->source = source;
+                  c->typed_source = d;
+              }
+              return d;
+          }
+
+          static internal::AssignableDataSource<T>* typedTarget(base::DataSourceBase::shared_ptr const& target, void* cookie)
+          {
+              Cookie* c = static_cast<Cookie*>(cookie);
+              if ( c && c->target == target )
+                  return c->typed_target;
+              internal::AssignableDataSource<T>* ad = internal::AssignableDataSource<T>::narrow( target.get() );
+              if ( c && ad ) {
+                  c->target = target;
+                  c->typed_target = ad;
+              }
+              return ad;
+          }
+
+          static std::pair<void const*,int> save(T const& sample, void* blob, int size, boost::mpl::true_)
+          {
+              if ( sizeof(T) > (unsigned int)size )
+                  return std::make_pair((void*)0,int(0));
+              std::memcpy( blob, &sample, sizeof(T) );
+              return std::make_pair( blob, int(sizeof(T)) );
+          }
+
+          static std::pair<void const*,int> save(T const& sample, void* blob, int size, boost::mpl::false_)
+          {
+              try {
+                  mqueue::binary_data_oarchive out( blob, size );
+                  out << sample;
+                  return std::make_pair( blob, out.getArchiveSize() );
+              } catch ( boost::archive::archive_exception& ) {
+                  // the sample does not fit in the slot.
+                  return std::make_pair((void*)0,int(0));
+              }
+          }
+
+          static bool load(const void* blob, int size, T& sample, boost::mpl::true_)
+          {
+              if ( sizeof(T) > (unsigned int)size )
+                  return false;
+              std::memcpy( &sample, blob, sizeof(T) );
+              return true;
+          }
+
+          static bool load(const void* blob, int size, T& sample, boost::mpl::false_)
+          {
+              try {
+                  mqueue::binary_data_iarchive in( blob, size );
+                  in >> sample;
+                  return true;
+              } catch ( boost::archive::archive_exception& ) {
+                  return false;
+              }
+          }
+
+          static unsigned int sampleSize(T const& sample, boost::mpl::true_)
+          {
+              return sizeof(T);
+          }
+
+          static unsigned int sampleSize(T const& sample, boost::mpl::false_)
+          {
+              mqueue::binary_data_oarchive out;
+              out << sample;
+              return out.getArchiveSize();
+          }
+      public:
+          virtual void* createCookie() const
+          {
+              return new Cookie();
+          }
+
+          virtual void deleteCookie(void* cookie) const
+          {
+              delete static_cast<Cookie*>(cookie);
+          }
+
+          virtual std::pair<void const*,int> fillBlob( base::DataSourceBase::shared_ptr source, void* blob, int size, void* cookie) const
+          {
+              internal::DataSource<T>* d = typedSource( source, cookie );
+              if ( d )
+                  return save( d->rvalue(), blob, size, is_bitwise() );
+              return std::make_pair((void*)0,int(0));
+          }
+
+          virtual bool updateFromBlob(const void* blob, int size, base::DataSourceBase::shared_ptr target, void* cookie) const
+          {
+              internal::AssignableDataSource<T>* ad = typedTarget( target, cookie );
+              if ( ad )
+                  return load( blob, size, ad->set(), is_bitwise() );
+              return false;
+          }
+
+          virtual unsigned int getSampleSize(base::DataSourceBase::shared_ptr sample, void* cookie) const
+          {
+              internal::DataSource<T>* tsample = typedSource( sample, cookie );
+              if ( ! tsample ) {
+                  log(Error) << "getSampleSize: sample has wrong type."<<endlog();
+                  return 0;
+              }
+              tsample->evaluate();
+              return sampleSize( tsample->rvalue(), is_bitwise() );
+          }
+      };
+}
+}
+
+#endif
@@ -70,6 +70,8 @@ namespace RTT
         globals->setValue( new Constant<int>("CIRCULAR_BUFFER", ConnPolicy::CIRCULAR_BUFFER) );
         globals->setValue( new Constant<int>("LOCKED", ConnPolicy::LOCKED) );
         globals->setValue( new Constant<int>("LOCK_FREE", ConnPolicy::LOCK_FREE) );
+        globals->setValue( new Constant<int>("SPSC", ConnPolicy::SPSC) );
+        globals->setValue( new Constant<int>("SEQLOCK", ConnPolicy::SEQLOCK) );
         globals->setValue( new Constant<int>("UNSYNC", ConnPolicy::UNSYNC) );
         globals->setValue( new Constant<BufferPolicy>("UnspecifiedBufferPolicy", UnspecifiedBufferPolicy) );
         globals->setValue( new Constant<BufferPolicy>("PerConnection", PerConnection) );
@@ -23,6 +23,7 @@
 
 #include <internal/AtomicQueue.hpp>
 #include <internal/AtomicMWSRQueue.hpp>
+#include <internal/SegmentedMWSRQueue.hpp>
 
 #include <Activity.hpp>
 
@@ -173,6 +174,7 @@ public:
     BufferLockFree<Dummy>* lockfree;
     BufferLocked<Dummy>* locked;
     BufferUnSync<Dummy>* unsync;
+    BufferSPSC<Dummy>* spsc;
 
     BufferLockFree<Dummy>* clockfree;
     BufferLocked<Dummy>* clocked;
@@ -181,6 +183,7 @@ public:
     DataObjectLocked<Dummy>* dlocked;
     DataObjectLockFree<Dummy>* dlockfree;
     DataObjectUnSync<Dummy>* dunsync;
+    DataObjectSeqLock<Dummy>* dseqlock;
 
     void testBuf();
     void testCirc();
@@ -197,6 +200,7 @@ public:
         lockfree = new BufferLockFree<Dummy>(QS, Dummy());
         locked = new BufferLocked<Dummy>(QS, Dummy());
         unsync = new BufferUnSync<Dummy>(QS, Dummy());
+        spsc = new BufferSPSC<Dummy>(QS, Dummy());
 
         // circular variants.
         clockfree = new BufferLockFree<Dummy>(QS, Dummy(), BufferBase::Options().circular(true));
@@ -206,6 +210,7 @@ public:
         dlockfree = new DataObjectLockFree<Dummy>(Dummy());
         dlocked   = new DataObjectLocked<Dummy>(Dummy());
         dunsync   = new DataObjectUnSync<Dummy>(Dummy());
+        dseqlock  = new DataObjectSeqLock<Dummy>(Dummy());
 
         // defaults
         buffer = lockfree;
@@ -216,12 +221,14 @@ public:
         delete lockfree;
         delete locked;
         delete unsync;
+        delete spsc;
         delete clockfree;
         delete clocked;
         delete cunsync;
         delete dlockfree;
         delete dlocked;
         delete dunsync;
+        delete dseqlock;
     }
 
     class DataObjectWriter : public RunnableInterface {
@@ -1084,6 +1091,87 @@ BOOST_AUTO_TEST_CASE( testAtomicMWSRQueue )
     delete d;
 }
 
+BOOST_AUTO_TEST_CASE( testSegmentedMWSRQueue )
+{
+    Dummy items[2*QS + 1];
+    SegmentedMWSRQueue<Dummy*> squeue(QS);
+    Dummy* d = 0;
+
+    BOOST_CHECK_EQUAL( squeue.capacity(), SegmentedMWSRQueue<Dummy*>::size_type(QS) );
+    BOOST_CHECK( squeue.isEmpty() );
+    BOOST_CHECK( squeue.dequeue(d) == false );
+
+    // fill the queue and check the FIFO order
+    for ( int i = 0; i < QS; ++i)
+        BOOST_CHECK( squeue.enqueue( &items[i] ) );
+    BOOST_CHECK( squeue.isFull() );
+    BOOST_CHECK( squeue.enqueue( &items[QS] ) == false );
+    BOOST_CHECK( squeue.dequeue(d) );
+    BOOST_CHECK_EQUAL( d, &items[0] );
+    BOOST_CHECK( squeue.enqueue( &items[QS] ) );
+
+    // a raised capacity is available immediately
+    squeue.setCapacity(2*QS);
+    for ( int i = QS + 1; i <= 2*QS; ++i)
+        BOOST_CHECK( squeue.enqueue( &items[i] ) );
+    BOOST_CHECK( squeue.enqueue( &items[0] ) == false );
+    for ( int i = 1; i <= 2*QS; ++i) {
+        BOOST_CHECK( squeue.dequeue(d) );
+        BOOST_CHECK_EQUAL( d, &items[i] );
+    }
+    BOOST_CHECK( squeue.isEmpty() );
+
+    QueueStatistics stats = squeue.getStatistics();
+    BOOST_CHECK_EQUAL( stats.max_size, unsigned(2*QS) );
+    BOOST_CHECK_EQUAL( stats.enqueue_failures, 2u );
+    BOOST_CHECK_EQUAL( stats.dequeued, unsigned(2*QS + 1) );
+
+    // an unbounded queue takes over its spare segment when it runs out of nodes
+    squeue.setCapacity(0);
+    squeue.resetStatistics();
+    unsigned int segments = squeue.getStatistics().segments;
+    for ( int i = 0; i < 2*QS; ++i)
+        BOOST_CHECK( squeue.enqueue( &items[i] ) );
+    for ( int i = 0; i < QS; ++i)
+        BOOST_CHECK( squeue.enqueue( &items[i] ) );
+    BOOST_CHECK_EQUAL( squeue.size(), SegmentedMWSRQueue<Dummy*>::size_type(3*QS) );
+    stats = squeue.getStatistics();
+    BOOST_CHECK_EQUAL( stats.segments, segments + 1 );
+    BOOST_CHECK_EQUAL( stats.enqueue_failures, 0u );
+
+    // neither enqueue() nor dequeue() allocate, only reserveSpares() replaces the spare segment
+    BOOST_CHECK_EQUAL( stats.spares, 0u );
+    BOOST_CHECK( squeue.enqueue( &items[0] ) == false );
+    BOOST_CHECK_EQUAL( squeue.getStatistics().enqueue_failures, 1u );
+    BOOST_CHECK( squeue.dequeue(d) );
+    BOOST_CHECK_EQUAL( d, &items[0] );
+    BOOST_CHECK( squeue.enqueue( &items[0] ) );
+    BOOST_CHECK( squeue.enqueue( &items[1] ) == false );
+    BOOST_CHECK_EQUAL( squeue.getStatistics().segments, segments + 1 );
+    squeue.reserveSpares(2);
+    BOOST_CHECK_EQUAL( squeue.getStatistics().spares, 2u );
+    for ( int i = 1; i <= QS; ++i)
+        BOOST_CHECK( squeue.enqueue( &items[i] ) );
+    stats = squeue.getStatistics();
+    BOOST_CHECK_EQUAL( stats.segments, segments + 2 );
+    BOOST_CHECK_EQUAL( stats.spares, 1u );
+    for ( int i = 1; i < 2*QS; ++i) {
+        BOOST_CHECK( squeue.dequeue(d) );
+        BOOST_CHECK_EQUAL( d, &items[i] );
+    }
+    for ( int i = 0; i < QS; ++i) {
+        BOOST_CHECK( squeue.dequeue(d) );
+        BOOST_CHECK_EQUAL( d, &items[i] );
+    }
+    BOOST_CHECK( squeue.dequeue(d) );
+    BOOST_CHECK_EQUAL( d, &items[0] );
+    for ( int i = 1; i <= QS; ++i) {
+        BOOST_CHECK( squeue.dequeue(d) );
+        BOOST_CHECK_EQUAL( d, &items[i] );
+    }
+    BOOST_CHECK( squeue.dequeue(d) == false );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_FIXTURE_TEST_SUITE( BuffersDataFlowTestSuite, BuffersDataFlowTest )
@@ -1112,6 +1200,33 @@ BOOST_AUTO_TEST_CASE( testBufUnsync )
     testCirc();
 }
 
+BOOST_AUTO_TEST_CASE( testBufSPSC )
+{
+    buffer = spsc;
+    testBuf();
+
+    // the reader may keep the previously popped sample while popping the next one
+    Dummy d(1.0, 2.0, 3.0), c(4.0, 5.0, 6.0);
+    for (int i = 0; i != QS; ++i)
+        BOOST_CHECK( buffer->Push( i % 2 ? c : d ) );
+    Dummy* last = buffer->PopWithoutRelease();
+    BOOST_REQUIRE( last );
+    BOOST_CHECK_EQUAL( *last, d );
+    for (int i = 1; i != QS; ++i) {
+        BOOST_CHECK( buffer->Push( i % 2 ? d : c ) );
+        Dummy* next = buffer->PopWithoutRelease();
+        BOOST_REQUIRE( next );
+        BOOST_CHECK_EQUAL( *next, i % 2 ? c : d );
+        BOOST_CHECK_EQUAL( *last, (i - 1) % 2 ? c : d );
+        buffer->Release( last );
+        last = next;
+    }
+    buffer->Release( last );
+    BOOST_CHECK_EQUAL( buffer->size(), QS - 1 );
+    buffer->clear();
+    BOOST_CHECK( buffer->empty() );
+}
+
 BOOST_AUTO_TEST_CASE( testDObjLockFree )
 {
     dataobj = dlockfree;
@@ -1130,6 +1245,22 @@ BOOST_AUTO_TEST_CASE( testDObjUnSync )
     testDObj();
 }
 
+BOOST_AUTO_TEST_CASE( testDObjSeqLock )
+{
+    dataobj = dseqlock;
+    testDObj();
+
+    // only the first read after a write returns NewData, clear() resets to NoData
+    Dummy d(1.0, 2.0, 3.0), r;
+    BOOST_REQUIRE( dataobj->Set( d ) );
+    BOOST_CHECK_EQUAL( NewData, dataobj->Get(r) );
+    BOOST_CHECK_EQUAL( d, r );
+    BOOST_CHECK_EQUAL( OldData, dataobj->Get(r) );
+    dataobj->clear();
+    BOOST_CHECK_EQUAL( NoData, dataobj->Get(r) );
+    BOOST_CHECK_EQUAL( d, dataobj->data_sample() );
+}
+
 BOOST_AUTO_TEST_CASE( testBufLockFree4Writers1Reader )
 {
     buffer
@@ -1170,6 +1301,12 @@ BOOST_AUTO_TEST_CASE( testBufLockFree4Writers4Readers )
     delete buffer;
 }
 
+BOOST_AUTO_TEST_CASE( testBufSPSC1Writer1Reader )
+{
+    buffer = spsc;
+    testBufMultiThreaded(1, 1);
+}
+
 BOOST_AUTO_TEST_CASE( testBufLocked4Writers4Readers )
 {
     buffer
@@ -1212,6 +1349,12 @@ BOOST_AUTO_TEST_CASE( testDObjLockFree4Writers4Readers )
     delete dataobj;
 }
 
+BOOST_AUTO_TEST_CASE( testDObjSeqLockSingleWriter4Readers )
+{
+    dataobj = dseqlock;
+    testDObjMultiThreaded(1, 4);
+}
+
 BOOST_AUTO_TEST_CASE( testDObjLockedSingleWriter4Readers )
 {
     dataobj = dlocked;
@@ -11,11 +11,19 @@
 #include <signal.h>
 
 #include <base/ChannelElement.hpp>
+#include <internal/ConnFactory.hpp>
 
 using namespace std;
 using namespace RTT;
 using namespace RTT::base;
 
+// A channel element which can not signal its reader, like a remote reader that went away.
+class UnreachableChannelElement : public ChannelElement<int>
+{
+public:
+    virtual bool signal() { return false; }
+};
+
 // Registers the test suite into the 'registry'
 BOOST_AUTO_TEST_SUITE(  ChannelElementsTestSuite )
 
@@ -326,4 +334,28 @@ BOOST_AUTO_TEST_CASE( testDisconnectOnInvalidWrite )
     BOOST_CHECK( !out->connected() );
 }
 
+BOOST_AUTO_TEST_CASE( testStatisticsCountNotConnected )
+{
+    ConnPolicy policy = ConnPolicy::buffer(4);
+    policy.statistics = true;
+    ChannelElement<int>::shared_ptr storage(internal::ConnFactory::buildDataStorage<int>(policy));
+    BOOST_REQUIRE( storage );
+    internal::ChannelStatisticsElementBase* element = dynamic_cast<internal::ChannelStatisticsElementBase*>(storage.get());
+    BOOST_REQUIRE( element );
+    internal::ConnectionStatistics::shared_ptr statistics = element->getStatistics();
+
+    // without a reader, signalling always succeeds
+    BOOST_CHECK_EQUAL( storage->write(1), WriteSuccess );
+    BOOST_CHECK_EQUAL( statistics->getNotConnected(), 0 );
+
+    ChannelElement<int>::shared_ptr reader(new UnreachableChannelElement());
+    BOOST_REQUIRE( storage->connectTo(reader) );
+    BOOST_CHECK_EQUAL( storage->write(2), NotConnected );
+    BOOST_CHECK_EQUAL( storage->write(3), NotConnected );
+    BOOST_CHECK_EQUAL( statistics->getWrites(), 3 );
+    BOOST_CHECK_EQUAL( statistics->getNotConnected(), 2 );
+    BOOST_CHECK_EQUAL( statistics->getDrops(), 0 );
+    BOOST_CHECK_EQUAL( statistics->getFillLevel(), 3 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
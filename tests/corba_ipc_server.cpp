@@ -141,6 +141,8 @@ int ORO_main(int argc, char** argv)
         TheServer ctest7("peerDH");
         TheServer ctest8("peerBH");
         TheServer ctest9("peerRMCb");
+        TheServer ctest10("peerBT");
+        TheServer ctest11("peerOT");
 
         // wait for shutdown.
         corba::TaskContextServer::RunOrb();
@@ -28,6 +28,7 @@
 #include <transports/corba/ServiceC.h>
 #include <transports/corba/corba.h>
 #include <transports/corba/CorbaConnPolicy.hpp>
+#include <transports/corba/OctetConversion.hpp>
 #include <rtt/InputPort.hpp>
 #include <rtt/OutputPort.hpp>
 #include <rtt/TaskContext.hpp>
@@ -35,6 +36,7 @@
 #include <transports/corba/TaskContextProxy.hpp>
 #include <transports/corba/CorbaLib.hpp>
 #include <rtt/internal/DataSourceTypeInfo.hpp>
+#include <rtt/os/TimeService.hpp>
 
 #include <string>
 #include <stdlib.h>
@@ -717,5 +719,145 @@ BOOST_AUTO_TEST_CASE( testBufferHalfs )
     BOOST_CHECK_EQUAL( result, 4.44);
 }
 
+BOOST_AUTO_TEST_CASE( testBatchedTransfer )
+{
+    tp = corba::TaskContextProxy::Create( "peerBT" , /* is_ior = */ false);
+    if (!tp )
+        tp = corba::TaskContextProxy::CreateFromFile( "peerBT.ior");
+
+    BOOST_REQUIRE(tp);
+
+    s = tp->server();
+    ts2  = corba::TaskContextServer::Create( tc, /* use_naming = */ false );
+    s2 = ts2->server();
+
+    const int samples = 1000;
+    RTT::corba::CConnPolicy policy = toCORBA(ConnPolicy::buffer(samples));
+    policy.init = false;
+    policy.transport = ORO_CORBA_PROTOCOL_ID; // force creation of non-local connections
+
+    corba::CDataFlowInterface_var ports  = s->ports();
+    corba::CDataFlowInterface_var ports2 = s2->ports();
+
+    // a batch written in one call arrives in order.
+    mi->connectTo( tp->ports()->getPort("mo"), toRTT(policy) );
+    CChannelElement_var cce = ports->buildChannelOutput("mi", policy);
+    BOOST_REQUIRE( cce.in() );
+    cce->channelReady(policy);
+    CChannelElement::CSamples batch;
+    batch.length(3);
+    for (CORBA::ULong i = 0; i != batch.length(); ++i)
+        batch[i] <<= double(i + 1);
+    BOOST_CHECK_EQUAL( cce->writeSamples(batch), CWriteSuccess );
+    double result = 0.0;
+    for (int i = 1; i != 4; ++i) {
+        wait_for_equal( mi->read( result ), NewData, 5 );
+        BOOST_CHECK_EQUAL( result, double(i) );
+    }
+    cce->disconnect();
+    mi->disconnect();
+
+    // the dispatcher sends the samples of the local buffer in batches,
+    // which the server round-trips to us.
+    BOOST_CHECK( tc->start() );
+    BOOST_CHECK( ports2->createConnection("mo", ports, "mi", policy) );
+    BOOST_CHECK( ports->createConnection("mo", ports2, "mi", policy) );
+    os::TimeService::ticks start = os::TimeService::Instance()->getTicks();
+    for (int i = 0; i != samples; ++i)
+        mo->write( double(i) );
+    int received = 0;
+    int wait = 0;
+    while ( received != samples && wait++ != 100 ) {
+        while ( mi->read( result, false ) == NewData ) {
+            BOOST_CHECK_EQUAL( result, double(received) );
+            ++received;
+        }
+        if ( received != samples )
+            usleep(10000);
+    }
+    Seconds elapsed = os::TimeService::Instance()->secondsSince(start);
+    BOOST_CHECK_EQUAL( received, samples );
+    BOOST_TEST_MESSAGE( "Round-tripped " << received << " samples in " << elapsed << "s: " << received / elapsed << " samples/s" );
+    ports->disconnectPort("mo");
+    ports->disconnectPort("mi");
+    testPortDisconnected();
+}
+
+BOOST_AUTO_TEST_CASE( testOctetTransfer )
+{
+    tp = corba::TaskContextProxy::Create( "peerOT" , /* is_ior = */ false);
+    if (!tp )
+        tp = corba::TaskContextProxy::CreateFromFile( "peerOT.ior");
+
+    BOOST_REQUIRE(tp);
+
+    s = tp->server();
+
+    const CORBA::ULong batches = 10;
+    const CORBA::ULong batch_size = 100;
+    RTT::corba::CConnPolicy policy = toCORBA(ConnPolicy::buffer(batches * batch_size));
+    policy.init = false;
+    policy.transport = ORO_CORBA_PROTOCOL_ID; // force creation of non-local connections
+
+    corba::CDataFlowInterface_var ports  = s->ports();
+
+    // the server's samples round-trip to us.
+    mi->connectTo( tp->ports()->getPort("mo"), toRTT(policy) );
+    CChannelElement_var cce = ports->buildChannelOutput("mi", policy);
+    BOOST_REQUIRE( cce.in() );
+
+    // only the encoding of the port's type is accepted.
+    CORBA::Boolean accepted = true;
+    RTT::corba::CConnPolicyExtras extras = toCORBAExtras(toRTT(policy));
+    BOOST_CHECK( cce->channelReadyOctets(policy, extras, corba::OctetConversion<int>::encoding().c_str(), accepted) );
+    BOOST_CHECK( !accepted );
+    BOOST_CHECK( cce->channelReadyOctets(policy, extras, corba::OctetConversion<double>::encoding().c_str(), accepted) );
+#ifdef RTT_CORBA_OCTET_SAMPLES
+    BOOST_CHECK( accepted );
+#else
+    // raw octets are never accepted unless PLUGINS_CORBA_OCTET_SAMPLES is enabled.
+    BOOST_CHECK( !accepted );
+#endif
+
+    // compare writeSamples() and writeOctets() over the same loopback connection.
+    std::vector<double> values(batch_size);
+    CChannelElement::CSamples any_batch;
+    CChannelElement::COctetSamples octet_batch;
+    any_batch.length(batch_size);
+    octet_batch.length(batch_size);
+    for (int octets = 0; octets != 2; ++octets) {
+        os::TimeService::ticks start = os::TimeService::Instance()->getTicks();
+        for (CORBA::ULong b = 0; b != batches; ++b) {
+            for (CORBA::ULong i = 0; i != batch_size; ++i) {
+                values[i] = double(b * batch_size + i);
+                if (octets)
+                    BOOST_REQUIRE( corba::OctetConversion<double>::toOctets(octet_batch[i], values[i]) );
+                else
+                    any_batch[i] <<= values[i];
+            }
+            if (octets)
+                BOOST_CHECK_EQUAL( cce->writeOctets(octet_batch), CWriteSuccess );
+            else
+                BOOST_CHECK_EQUAL( cce->writeSamples(any_batch), CWriteSuccess );
+        }
+        double result = 0.0;
+        CORBA::ULong received = 0;
+        int wait = 0;
+        while ( received != batches * batch_size && wait++ != 100 ) {
+            while ( mi->read( result, false ) == NewData ) {
+                BOOST_CHECK_EQUAL( result, double(received) );
+                ++received;
+            }
+            if ( received != batches * batch_size )
+                usleep(10000);
+        }
+        Seconds elapsed = os::TimeService::Instance()->secondsSince(start);
+        BOOST_CHECK_EQUAL( received, batches * batch_size );
+        BOOST_TEST_MESSAGE( (octets ? "Octets: " : "Anys: ") << "round-tripped " << received << " samples in " << elapsed << "s: " << received / elapsed << " samples/s" );
+    }
+    cce->disconnect();
+    mi->disconnect();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
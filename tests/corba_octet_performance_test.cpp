@@ -0,0 +1,104 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "unit.hpp"
+
+#include <transports/corba/corba.h>
+#include <transports/corba/CorbaConversion.hpp>
+#include <transports/corba/OctetConversion.hpp>
+#include <rtt/os/TimeService.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <iostream>
+#include <vector>
+
+using namespace RTT;
+using namespace RTT::corba;
+
+/**
+ * A bitwise serializable type which no typekit registers.
+ */
+struct UnregisteredSample
+{
+    double values[4];
+};
+BOOST_IS_BITWISE_SERIALIZABLE(UnregisteredSample)
+
+/**
+ * Compares the conversion of samples through a CORBA::Any with the
+ * conversion to raw octets, including the copy the ORB makes of the
+ * octets when it receives them.
+ */
+class CorbaOctetPerformanceTest
+{
+public:
+    template<class T>
+    void runAny(const char* what, const T& value, int count)
+    {
+        T result;
+        CORBA::Any any;
+        os::TimeService::ticks start = os::TimeService::Instance()->getTicks();
+        for (int i = 0; i != count; ++i) {
+            BOOST_REQUIRE( AnyConversion<T>::updateAny(value, any) );
+            BOOST_REQUIRE( AnyConversion<T>::update(any, result) );
+        }
+        Seconds elapsed = os::TimeService::Instance()->secondsSince(start);
+        BOOST_CHECK( result == value );
+        std::cout << " * " << what << " as any: " << (count / elapsed) << " samples/s" << std::endl;
+    }
+
+    template<class T>
+    void runOctets(const char* what, const T& value, int count)
+    {
+        T result;
+        CChannelElement::COctets octets;
+        os::TimeService::ticks start = os::TimeService::Instance()->getTicks();
+        for (int i = 0; i != count; ++i) {
+            BOOST_REQUIRE( OctetConversion<T>::toOctets(octets, value) );
+            CChannelElement::COctets received(octets);
+            BOOST_REQUIRE( OctetConversion<T>::fromOctets(result, received) );
+        }
+        Seconds elapsed = os::TimeService::Instance()->secondsSince(start);
+        BOOST_CHECK( result == value );
+        std::cout << " * " << what << " as octets: " << (count / elapsed) << " samples/s" << std::endl;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE( CorbaOctetPerformanceTestSuite, CorbaOctetPerformanceTest )
+
+BOOST_AUTO_TEST_CASE( testOctetEncoding )
+{
+    // the encoding names the registered type, not the compiler's type id.
+    std::string enc = OctetConversion<double>::encoding();
+    BOOST_CHECK_EQUAL( enc.substr(0, enc.find('/')), "double" );
+    BOOST_CHECK( enc.find("/8/") != std::string::npos );
+    BOOST_CHECK( OctetConversion<int>::encoding() != enc );
+    BOOST_CHECK_EQUAL( OctetConversion< std::vector<double> >::encoding().substr(0, 7), "vector:" );
+    // types which are not registered, or not bitwise, are sent as anys.
+    BOOST_CHECK( OctetConversion<UnregisteredSample>::encoding().empty() );
+    BOOST_CHECK( OctetConversion<std::string>::encoding().empty() );
+}
+
+BOOST_AUTO_TEST_CASE( testDoubleConversion )
+{
+    runAny("double", 3.14, 1000000);
+    runOctets("double", 3.14, 1000000);
+}
+
+BOOST_AUTO_TEST_CASE( testVectorConversion )
+{
+    for (unsigned int size = 10; size <= 10000; size *= 10) {
+        std::vector<double> value(size, 2.71);
+        std::string what = "vector<double>(" + boost::lexical_cast<std::string>(size) + ")";
+        runAny(what.c_str(), value, 10000);
+        runOctets(what.c_str(), value, 10000);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -30,6 +30,9 @@
 #include <rtt/Service.hpp>
 #include <rtt/transports/corba/DataFlowI.h>
 #include <rtt/transports/corba/RemotePorts.hpp>
+#include <rtt/transports/corba/CorbaDispatcher.hpp>
+#include <rtt/transports/corba/CorbaSendDispatcher.hpp>
+#include <rtt/transports/corba/OperationInterfaceI.h>
 #include <transports/corba/ServiceC.h>
 #include <transports/corba/CorbaLib.hpp>
 #include <transports/corba/CorbaConnPolicy.hpp>
@@ -125,6 +128,22 @@ void CorbaTest::new_data_listener(base::PortInterface* port)
     signalled_port = port;
 }
 
+/**
+ * Rejects sendOperationCallback() like the skeleton of a service
+ * which predates it.
+ */
+class LegacyOperationInterface : public RTT_corba_COperationInterface_i
+{
+public:
+    LegacyOperationInterface(OperationInterface* ops, PortableServer::POA_ptr poa)
+        : RTT_corba_COperationInterface_i(ops, poa) {}
+
+    void sendOperationCallback(const char*, const corba::CAnyArguments&, corba::CAsyncSendHandle_ptr)
+    {
+        throw CORBA::BAD_OPERATION();
+    }
+};
+
 
 #define ASSERT_PORT_SIGNALLING(code, read_port) do { \
     signalled_port = 0; \
@@ -413,6 +432,19 @@ BOOST_AUTO_TEST_CASE( testOperationCallerC_Send )
     BOOST_CHECK_EQUAL( r, 0.0 );
     BOOST_CHECK_EQUAL( cr, -5.0 );
 
+    // collectIfDone() returns at once while the results are underway.
+    mc = tp->provides("methods")->create("m0", caller->engine()).ret( r );
+    shc = mc.send();
+    shc.arg(cr);
+    cr = 0.0;
+    SendStatus ss = shc.collectIfDone();
+    for (int i = 0; ss == SendNotReady && i != 500; ++i) {
+        usleep(10000);
+        ss = shc.collectIfDone();
+    }
+    BOOST_CHECK_EQUAL( ss, SendSuccess );
+    BOOST_CHECK_EQUAL( cr, -1.0 );
+
 #ifndef RTT_CORBA_SEND_ONEWAY_OPERATIONS
     mc = tp->provides("methods")->create("m0except", caller->engine());
     BOOST_CHECK_NO_THROW( mc.check() );
@@ -425,6 +457,32 @@ BOOST_AUTO_TEST_CASE( testOperationCallerC_Send )
 #endif
 }
 
+BOOST_AUTO_TEST_CASE( testSendToLegacyService )
+{
+    LegacyOperationInterface legacy_i( tc->provides("methods").get(), corba::ApplicationServer::rootPOA.in() );
+    corba::COperationInterface_var legacy = legacy_i._this();
+
+    // the first send finds out that the service is old, the second knows it.
+    corba::CorbaSendDispatcher* dispatcher = corba::CorbaSendDispatcher::Instance();
+    for (int i = 0; i != 2; ++i) {
+        RTT_corba_CAsyncSendHandle_i* ash = dispatcher->acquire();
+        ash->prepare( legacy.in(), "m0", corba::CAnyArguments() );
+        corba::CSendHandle_var sh = ash->reference();
+        BOOST_REQUIRE( dispatcher->send( ash ) );
+
+        corba::CAnyArguments_var results;
+        BOOST_CHECK_EQUAL( sh->collect( results.out() ), corba::CSendSuccess );
+        BOOST_REQUIRE_EQUAL( results->length(), 1u );
+        double cr = 0.0;
+        BOOST_CHECK( results[0] >>= cr );
+        BOOST_CHECK_EQUAL( cr, -1.0 );
+        sh->dispose();
+    }
+
+    PortableServer::ObjectId_var oid = corba::ApplicationServer::rootPOA->servant_to_id( &legacy_i );
+    corba::ApplicationServer::rootPOA->deactivate_object( oid.in() );
+}
+
 BOOST_AUTO_TEST_CASE( testRemoteOperationCallerCall )
 {
 
@@ -772,6 +830,12 @@ BOOST_AUTO_TEST_CASE( testPortProxying )
     mo2->createConnection(*read_port);
     BOOST_CHECK(read_port->connected());
     BOOST_CHECK(write_port->connected());
+    // the dispatcher counts the connection under the name of the peer.
+    std::vector<corba::CorbaPeerStatistics> peers = corba::CorbaDispatcher::GetPeerStatistics();
+    bool found = false;
+    for (unsigned int i = 0; i != peers.size(); ++i)
+        found = found || peers[i].peer == tp->getName();
+    BOOST_CHECK(found);
     read_port->disconnect();
     BOOST_CHECK(!read_port->connected());
     BOOST_CHECK(!write_port->connected());
@@ -1001,5 +1065,31 @@ BOOST_AUTO_TEST_CASE( testBufferHalfs )
     BOOST_CHECK_EQUAL( result, 4.44);
 }
 
+/**
+ * The policy fields which older peers do not know travel in
+ * CConnPolicyExtras, such that CConnPolicy stays compatible.
+ */
+BOOST_AUTO_TEST_CASE( testConnPolicyExtras )
+{
+    ConnPolicy policy = ConnPolicy::buffer(10, ConnPolicy::SPSC);
+    policy.statistics = true;
+    policy.batch_size = 8;
+    policy.batch_period = 0.01;
+
+    RTT::corba::CConnPolicy cpolicy = toCORBA(policy);
+    BOOST_CHECK_EQUAL( cpolicy.lock_policy, RTT::corba::CLockFree );
+    ConnPolicy old = toRTT(cpolicy);
+    BOOST_CHECK_EQUAL( old.lock_policy, ConnPolicy::LOCK_FREE );
+    BOOST_CHECK( !old.statistics );
+    BOOST_CHECK_EQUAL( old.batch_size, 0 );
+
+    ConnPolicy full = toRTT(cpolicy, toCORBAExtras(policy));
+    BOOST_CHECK_EQUAL( full.lock_policy, ConnPolicy::SPSC );
+    BOOST_CHECK( full.statistics );
+    BOOST_CHECK_EQUAL( full.batch_size, 8 );
+    BOOST_CHECK_EQUAL( full.batch_period, 0.01 );
+    BOOST_CHECK_EQUAL( full.size, 10 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
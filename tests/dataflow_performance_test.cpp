@@ -1611,6 +1611,30 @@ BOOST_AUTO_TEST_CASE( DataFlowPerformanceTest_Buffer_Shared_4Writers4Readers )
 }
 #endif
 
+#if RTT_VERSION_GTE(2,8,99)
+// 1 writer, 1 reader, PerConnection, LOCK_FREE
+BOOST_AUTO_TEST_CASE( DataFlowPerformanceTest_Buffer_PerConnection_LockFree_1Writer1Reader )
+{
+    options.NumberOfWriters = 1;
+    options.NumberOfReaders = 1;
+    options.policy.buffer_policy = PerConnection;
+    options.policy.lock_policy = ConnPolicy::LOCK_FREE;
+    runner.reset(new RunnerType(options));
+    run();
+}
+
+// 1 writer, 1 reader, PerConnection, SPSC
+BOOST_AUTO_TEST_CASE( DataFlowPerformanceTest_Buffer_PerConnection_SPSC_1Writer1Reader )
+{
+    options.NumberOfWriters = 1;
+    options.NumberOfReaders = 1;
+    options.policy.buffer_policy = PerConnection;
+    options.policy.lock_policy = ConnPolicy::SPSC;
+    runner.reset(new RunnerType(options));
+    run();
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // Registers the fixture into the 'registry'
@@ -1642,3 +1666,82 @@ BOOST_AUTO_TEST_CASE( DataFlowPerformanceTest_EmptyReads_Shared_7Writers1Reader
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
+
+#if RTT_VERSION_GTE(2,8,99)
+#include <sys/resource.h>
+
+// A reader which drains its buffered event port in every updateHook()
+class BurstReader : public RTT::TaskContext
+{
+public:
+    RTT::InputPort<double> input_port;
+    RTT::os::AtomicInt updates;
+    RTT::os::AtomicInt samples;
+
+    BurstReader()
+        : RTT::TaskContext("BurstReader")
+        , input_port("in")
+    {
+        this->ports()->addEventPort(input_port);
+    }
+
+    ~BurstReader()
+    {
+        stop();
+        disconnect();
+    }
+
+    void updateHook()
+    {
+        double sample;
+        updates.inc();
+        while(input_port.read(sample, false) == NewData)
+            samples.inc();
+    }
+};
+
+// Writes a burst of samples at about 10 kHz into an event port and reports the
+// number of updateHook()s, the context switches and the cpu time of the process.
+static int runEventPortBurst(RTT::Seconds min_trigger_interval)
+{
+    const int number_of_samples = 5000;
+    BurstReader reader;
+    RTT::OutputPort<double> output_port("out");
+    BOOST_REQUIRE( output_port.connectTo(&reader.input_port, RTT::ConnPolicy::buffer(number_of_samples)) );
+    reader.engine()->setMinTriggerInterval(min_trigger_interval);
+    BOOST_REQUIRE( reader.start() );
+
+    struct rusage before, after;
+    getrusage(RUSAGE_SELF, &before);
+    for(int i = 0; i < number_of_samples; ++i) {
+        output_port.write(i);
+        usleep(100);
+    }
+    for(int i = 0; i < 1000 && reader.samples.read() < number_of_samples; ++i)
+        usleep(1000);
+    getrusage(RUSAGE_SELF, &after);
+    reader.stop();
+
+    double cputime = (after.ru_utime.tv_sec - before.ru_utime.tv_sec) + (after.ru_stime.tv_sec - before.ru_stime.tv_sec)
+                   + ((after.ru_utime.tv_usec - before.ru_utime.tv_usec) + (after.ru_stime.tv_usec - before.ru_stime.tv_usec)) * 1e-6;
+    std::cout << " * Min trigger interval:    " << min_trigger_interval << " s" << std::endl;
+    std::cout << "   Samples read:            " << reader.samples.read() << " of " << number_of_samples << std::endl;
+    std::cout << "   updateHook() calls:      " << reader.updates.read() << std::endl;
+    std::cout << "   Context switches:        " << (after.ru_nvcsw - before.ru_nvcsw) << " voluntary, "
+              << (after.ru_nivcsw - before.ru_nivcsw) << " involuntary" << std::endl;
+    std::cout << "   CPU time:                " << cputime << " s" << std::endl;
+    std::cout << "   Port queue:              " << reader.engine()->getQueueStatistics(RTT::ExecutionEngine::PortQueue) << std::endl;
+    BOOST_CHECK_EQUAL( reader.samples.read(), number_of_samples );
+    return reader.updates.read();
+}
+
+BOOST_AUTO_TEST_CASE( DataFlowPerformanceTest_EventPortBurst )
+{
+    std::cout << "***************************************************************************************************************************" << std::endl;
+    std::cout << " * Event port burst: 5000 samples at 10 kHz into a buffered event port" << std::endl;
+    int updates = runEventPortBurst(0.0);
+    runEventPortBurst(0.001);
+    BOOST_CHECK( runEventPortBurst(0.01) < updates );
+    std::cout << std::endl;
+}
+#endif
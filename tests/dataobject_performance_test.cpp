@@ -0,0 +1,152 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "unit.hpp"
+
+#include <rtt/Activity.hpp>
+#include <rtt/base/RunnableInterface.hpp>
+#include <rtt/base/DataObjectLockFree.hpp>
+#include <rtt/base/DataObjectLocked.hpp>
+#include <rtt/base/DataObjectSeqLock.hpp>
+#include <rtt/os/TimeService.hpp>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/lexical_cast.hpp>
+#include <iostream>
+#include <vector>
+#include <unistd.h>
+
+using namespace RTT;
+using namespace RTT::base;
+
+/**
+ * A trivially copyable sample which is large enough that copying it
+ * takes a while. All elements of a sample written by the writer are
+ * equal, so a reader can detect torn reads.
+ */
+struct LargeSample
+{
+    double values[128];
+    LargeSample() { set(0.0); }
+    void set(double value) { for (unsigned int i = 0; i < 128; ++i) values[i] = value; }
+    bool consistent() const { for (unsigned int i = 1; i < 128; ++i) if (values[i] != values[0]) return false; return true; }
+};
+
+/**
+ * Measures how the read throughput of the data objects scales with the
+ * number of readers while one writer updates the sample continuously.
+ */
+class DataObjectPerformanceTest
+{
+public:
+    class Writer : public RunnableInterface {
+    public:
+        DataObjectInterface<LargeSample> *dataobj;
+        volatile bool stop;
+        LargeSample sample;
+        int writes;
+
+        Writer(DataObjectInterface<LargeSample> *dataobj) : dataobj(dataobj), stop(false), writes(0) {}
+        bool initialize() { stop = false; return true; }
+        void step() {
+            while (!stop) {
+                sample.set(writes);
+                if (dataobj->Set(sample))
+                    ++writes;
+            }
+        }
+        void finalize() {}
+        bool breakLoop() { stop = true; return true; }
+    };
+
+    class Reader : public RunnableInterface {
+    public:
+        DataObjectInterface<LargeSample> *dataobj;
+        volatile bool stop;
+        LargeSample sample;
+        int reads;
+        int torn;
+
+        Reader(DataObjectInterface<LargeSample> *dataobj) : dataobj(dataobj), stop(false), reads(0), torn(0) {}
+        bool initialize() { stop = false; return true; }
+        void step() {
+            while (!stop) {
+                dataobj->Get(sample, true);
+                ++reads;
+                if (!sample.consistent())
+                    ++torn;
+            }
+        }
+        void finalize() {}
+        bool breakLoop() { stop = true; return true; }
+    };
+
+    // Runs one writer and \a number_of_readers readers on \a dataobj for a second.
+    void run(const char* what, DataObjectInterface<LargeSample> *dataobj, int number_of_readers)
+    {
+        Writer writer(dataobj);
+        Activity writer_activity(ORO_SCHED_OTHER, 0, 0, &writer, "Writer");
+        std::vector< boost::shared_ptr<Reader> > readers;
+        std::vector< boost::shared_ptr<Activity> > reader_activities;
+        for (int i = 0; i < number_of_readers; ++i) {
+            readers.push_back(boost::shared_ptr<Reader>(new Reader(dataobj)));
+            reader_activities.push_back(boost::shared_ptr<Activity>(new Activity(ORO_SCHED_OTHER, 0, 0, readers.back().get(), "Reader" + boost::lexical_cast<std::string>(i))));
+        }
+
+        for (int i = 0; i < number_of_readers; ++i)
+            BOOST_REQUIRE( reader_activities[i]->start() );
+        BOOST_REQUIRE( writer_activity.start() );
+        os::TimeService::ticks start = os::TimeService::Instance()->getTicks();
+        sleep(1);
+        BOOST_REQUIRE( writer_activity.stop() );
+        for (int i = 0; i < number_of_readers; ++i)
+            BOOST_REQUIRE( reader_activities[i]->stop() );
+        Seconds elapsed = os::TimeService::Instance()->secondsSince(start);
+
+        int reads = 0, torn = 0;
+        for (int i = 0; i < number_of_readers; ++i) {
+            BOOST_CHECK_GT( readers[i]->reads, 0 );
+            reads += readers[i]->reads;
+            torn += readers[i]->torn;
+        }
+        std::cout << " * " << what << ", " << number_of_readers << " reader(s): "
+                  << (reads / elapsed) << " reads/s (" << (reads / elapsed / number_of_readers) << " per reader), "
+                  << (writer.writes / elapsed) << " writes/s" << std::endl;
+        BOOST_CHECK_GT( writer.writes, 0 );
+        BOOST_CHECK_EQUAL( torn, 0 );
+    }
+
+    void runScaling(const char* what, DataObjectInterface<LargeSample> *dataobj)
+    {
+        for (int readers = 1; readers <= 8; readers *= 2)
+            run(what, dataobj, readers);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE( DataObjectPerformanceTestSuite, DataObjectPerformanceTest )
+
+BOOST_AUTO_TEST_CASE( testLockFreeReaderScaling )
+{
+    DataObjectLockFree<LargeSample> dataobj(LargeSample(), DataObjectBase::Options().max_threads(9));
+    runScaling("LOCK_FREE", &dataobj);
+}
+
+BOOST_AUTO_TEST_CASE( testSeqLockReaderScaling )
+{
+    DataObjectSeqLock<LargeSample> dataobj((LargeSample()));
+    runScaling("SEQLOCK", &dataobj);
+}
+
+BOOST_AUTO_TEST_CASE( testLockedReaderScaling )
+{
+    DataObjectLocked<LargeSample> dataobj((LargeSample()));
+    runScaling("LOCKED", &dataobj);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
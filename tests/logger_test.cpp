@@ -23,7 +23,12 @@
 
 #include <iostream>
 #include <boost/scoped_ptr.hpp>
+#include <boost/lexical_cast.hpp>
 #include <Activity.hpp>
+#include <BinaryLog.hpp>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
 #include <base/RunnableInterface.hpp>
 
 using namespace boost;
@@ -64,6 +69,26 @@ struct TestLog
 };
 
 
+struct BurstLog
+  : public RunnableInterface
+{
+  enum { Count = 1000 };
+  volatile bool done;
+  BurstLog() : done(false) {}
+  bool initialize() { return true; }
+
+  void step() {}
+
+  void loop() {
+      for (int i = 0; i != Count; ++i)
+          log(Info) << "async burst thread " << i << endlog();
+      done = true;
+  }
+
+  void finalize() {}
+};
+
+
 BOOST_FIXTURE_TEST_SUITE( LoggerTestSuite, LoggerTest )
 
 BOOST_AUTO_TEST_CASE( testStartStop )
@@ -118,4 +143,164 @@ BOOST_AUTO_TEST_CASE( testThreadLog )
 
 }
 
+BOOST_AUTO_TEST_CASE( testAsyncLog )
+{
+  std::stringstream out;
+  Logger::LogLevel level = Logger::log().getLogLevel();
+  Logger::log().setLogLevel( Logger::Info );
+  Logger::log().setStdStream( out );
+  unsigned int dropped = Logger::log().getDroppedMessages();
+
+  BOOST_REQUIRE( Logger::log().setAsynchronous(true) );
+  BOOST_CHECK( Logger::log().isAsynchronous() );
+
+  log(Info) << "Test asynchronous logging : Two ";
+  log() << "parts on one line." << endlog();
+
+  // a burst of a thread which exits and of this thread. Bursts may
+  // overflow the rings, depending on how fast the flusher catches up.
+  BurstLog burst;
+  {
+      Activity t( 0, &burst, "BurstLog" );
+      BOOST_REQUIRE( t.start() );
+      for (int i = 0; i != 1000 && !burst.done; ++i)
+          usleep(10000);
+      BOOST_REQUIRE( burst.done );
+      t.stop();
+  }
+  for (int i = 0; i != BurstLog::Count; ++i)
+      log(Info) << "async burst main " << i << endlog();
+
+  // switching back writes all messages which were not dropped.
+  BOOST_CHECK( Logger::log().setAsynchronous(false) );
+  BOOST_CHECK( !Logger::log().isAsynchronous() );
+  dropped = Logger::log().getDroppedMessages() - dropped;
+  Logger::log().setStdStream( std::cerr );
+  Logger::log().setLogLevel( level );
+
+  std::string line;
+  int written = 0, first_main = -1, last_main = -1, first_thread = -1, last_thread = -1;
+  bool parts = false, reported = false;
+  while ( std::getline(out, line) ) {
+      parts = parts || line.find("Test asynchronous logging : Two parts on one line.") != std::string::npos;
+      reported = reported || line.find("Dropped ") != std::string::npos;
+      std::string::size_type pos;
+      if ( (pos = line.find("async burst main ")) != std::string::npos ) {
+          int i = boost::lexical_cast<int>( line.substr(pos + 17) );
+          BOOST_CHECK( i > last_main );
+          if ( first_main == -1 )
+              first_main = i;
+          last_main = i;
+          ++written;
+      } else if ( (pos = line.find("async burst thread ")) != std::string::npos ) {
+          int i = boost::lexical_cast<int>( line.substr(pos + 19) );
+          BOOST_CHECK( i > last_thread );
+          if ( first_thread == -1 )
+              first_thread = i;
+          last_thread = i;
+          ++written;
+      }
+  }
+  BOOST_CHECK( parts );
+  BOOST_CHECK_EQUAL( written + dropped, 2u * BurstLog::Count );
+  BOOST_CHECK_EQUAL( reported, dropped != 0 );
+  // the first messages of a burst always fit in the ring.
+  BOOST_CHECK_EQUAL( first_main, 0 );
+  BOOST_CHECK_EQUAL( first_thread, 0 );
+
+  log(Info) << "Test asynchronous logging : back to synchronous." << endlog();
+}
+
+BOOST_AUTO_TEST_CASE( testBinaryLog )
+{
+  ORO_BINLOG_SITE(site, Logger::Info, "binary message %d of %s: %f");
+  ORO_BINLOG_SITE(debugsite, Logger::RealTime, "never written %d");
+
+  BOOST_CHECK( !BinaryLog::isOpen() );
+  BinaryLog::write( site, 1, "nothing", 1.0 );
+  BOOST_CHECK_EQUAL( site.id, 0u );
+
+  // small files, such that the messages rotate over several files.
+  BOOST_REQUIRE( BinaryLog::open( "logger_test.blog", 4096, 2 ) );
+  {
+      Logger::In in("BinaryLogTest");
+      for (int i = 0; i != 500; ++i)
+          BinaryLog::write( site, i, std::string("testBinaryLog"), i * 0.5 );
+      BinaryLog::write( debugsite, 1 );
+  }
+  BOOST_CHECK( site.id != 0 );
+  BOOST_CHECK_EQUAL( debugsite.id, 0u );
+  BinaryLog::close();
+  BOOST_CHECK( !BinaryLog::isOpen() );
+
+  // only the last two files are kept. The first rotation always finds
+  // the file which open() mapped ahead.
+  int kept = 0, last = 0;
+  for (int i = 0; i != 100; ++i)
+      if ( std::ifstream( ("logger_test.blog." + boost::lexical_cast<std::string>(i)).c_str() ) ) {
+          ++kept;
+          last = i;
+      }
+  BOOST_CHECK_EQUAL( kept, 2 );
+  BOOST_CHECK( last >= 1 );
+  for (int i = last - 1; i <= last; ++i)
+      std::remove( ("logger_test.blog." + boost::lexical_cast<std::string>(i)).c_str() );
+}
+
+BOOST_AUTO_TEST_CASE( testBinaryLogDecode )
+{
+#if defined(RTT_PYTHON) && defined(RTT_BINLOG_DECODE)
+  ORO_BINLOG_SITE(site, Logger::Info, "decoded message %d of %s: %f");
+
+  // keeps all files, such that every message which is not dropped is decoded.
+  unsigned int dropped = BinaryLog::getDroppedMessages();
+  BOOST_REQUIRE( BinaryLog::open( "logger_decode.blog", 4096, 1000 ) );
+  {
+      Logger::In in("BinaryLogDecode");
+      for (int i = 0; i != 500; ++i)
+          BinaryLog::write( site, i, "testBinaryLogDecode", i * 0.5 );
+  }
+  BinaryLog::close();
+  dropped = BinaryLog::getDroppedMessages() - dropped;
+
+  std::string command = std::string(RTT_PYTHON) + " " + RTT_BINLOG_DECODE;
+  int files = 0;
+  for (; std::ifstream( ("logger_decode.blog." + boost::lexical_cast<std::string>(files)).c_str() ); ++files)
+      command += " logger_decode.blog." + boost::lexical_cast<std::string>(files);
+  BOOST_CHECK( files >= 2 );
+  FILE* decoded = popen( command.c_str(), "r" );
+  BOOST_REQUIRE( decoded );
+
+  char buf[256];
+  unsigned int written = 0;
+  int first = -1, last = -1;
+  while ( fgets( buf, sizeof(buf), decoded ) ) {
+      std::string line( buf );
+      std::string::size_type pos = line.find("[ Info   ][BinaryLogDecode] decoded message ");
+      BOOST_REQUIRE_MESSAGE( pos != std::string::npos, line );
+      std::stringstream rest( line.substr( pos + 44 ) );
+      int i;
+      std::string of, text;
+      double value;
+      rest >> i >> of >> text >> value;
+      BOOST_CHECK( i > last );
+      if ( first == -1 )
+          first = i;
+      BOOST_CHECK_EQUAL( text, "testBinaryLogDecode:" );
+      BOOST_CHECK_CLOSE( value, i * 0.5, 1e-9 );
+      last = i;
+      ++written;
+  }
+  BOOST_CHECK_EQUAL( pclose( decoded ), 0 );
+  // the first file has room for the first messages.
+  BOOST_CHECK_EQUAL( first, 0 );
+  BOOST_CHECK_EQUAL( written + dropped, 500u );
+
+  for (int i = 0; i != files; ++i)
+      std::remove( ("logger_decode.blog." + boost::lexical_cast<std::string>(i)).c_str() );
+#else
+  BOOST_TEST_MESSAGE( "No python interpreter to decode the binary log." );
+#endif
+}
+
 BOOST_AUTO_TEST_SUITE_END()
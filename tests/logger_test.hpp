@@ -39,6 +39,9 @@ public:
     void testLogEnv();
     void testNewLog();
     void testThreadLog();
+    void testAsyncLog();
+    void testBinaryLog();
+    void testBinaryLogDecode();
 };
 
 #endif
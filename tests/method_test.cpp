@@ -270,6 +270,51 @@ BOOST_AUTO_TEST_CASE(testOwnThreadOperationCallerSend)
     BOOST_CHECK_EQUAL( -8.0, h7.ret() );
 }
 
+BOOST_AUTO_TEST_CASE(testOwnThreadOperationCallerSendPool)
+{
+    OperationCaller<double(int,double)> m2("m2", &OperationsFixture::m2, this, tc->engine(), caller->engine(), OwnThread);
+    BOOST_REQUIRE( tc->isRunning() );
+    BOOST_REQUIRE( caller->isRunning() );
+
+    BOOST_CHECK_EQUAL( m2.getSendPoolStatistics().size, 0u );
+    BOOST_CHECK( m2.setSendPoolSize(2) );
+    BOOST_CHECK_EQUAL( m2.getSendPoolStatistics().size, 2u );
+
+    // released handles return their clone to the pool, once the engines
+    // released it too.
+    double retn = 0;
+    for (int i = 0; i != 10; ++i) {
+        for (int t = 0; t != 1000 && m2.getSendPoolStatistics().available != 2u; ++t)
+            usleep(1000);
+        BOOST_REQUIRE_EQUAL( m2.getSendPoolStatistics().available, 2u );
+        SendHandle<double(int,double)> h = m2.send(1, 2.0);
+        BOOST_CHECK_EQUAL( SendSuccess, h.collect(retn) );
+        BOOST_CHECK_EQUAL( retn, -3.0 );
+    }
+    BOOST_CHECK_EQUAL( m2.getSendPoolStatistics().hits, 10u );
+    BOOST_CHECK_EQUAL( m2.getSendPoolStatistics().misses, 0u );
+
+    // while the handles are kept, the pool runs out of clones.
+    for (int t = 0; t != 1000 && m2.getSendPoolStatistics().available != 2u; ++t)
+        usleep(1000);
+    SendHandle<double(int,double)> h0 = m2.send(1, 2.0);
+    SendHandle<double(int,double)> h1 = m2.send(1, 2.0);
+    SendHandle<double(int,double)> h2 = m2.send(1, 2.0);
+    BOOST_CHECK_EQUAL( SendSuccess, h0.collect(retn) );
+    BOOST_CHECK_EQUAL( SendSuccess, h1.collect(retn) );
+    BOOST_CHECK_EQUAL( SendSuccess, h2.collect(retn) );
+    BOOST_CHECK_EQUAL( retn, -3.0 );
+    BOOST_CHECK_EQUAL( m2.getSendPoolStatistics().hits, 12u );
+    BOOST_CHECK_EQUAL( m2.getSendPoolStatistics().misses, 1u );
+
+    // copies do not share the pool.
+    OperationCaller<double(int,double)> copy = m2;
+    BOOST_CHECK_EQUAL( copy.getSendPoolStatistics().size, 0u );
+
+    BOOST_CHECK( m2.setSendPoolSize(0) );
+    BOOST_CHECK_EQUAL( m2.getSendPoolStatistics().size, 0u );
+}
+
 BOOST_AUTO_TEST_CASE(testLocalOperationCallerFactory)
 {
     // Test the addition of 'simple' operationCallers to the operation interface,
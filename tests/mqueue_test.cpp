@@ -24,6 +24,8 @@
 #include <transports/mqueue/MQLib.hpp>
 #include <transports/mqueue/MQChannelElement.hpp>
 #include <transports/mqueue/MQTemplateProtocol.hpp>
+#include <transports/mqueue/MQSerializationProtocol.hpp>
+#include <boost/serialization/vector.hpp>
 #include <os/fosi.h>
 
 using namespace std;
@@ -34,6 +36,7 @@ using namespace RTT::detail;
 #include <OutputPort.hpp>
 #include <TaskContext.hpp>
 #include <string>
+#include <sstream>
 
 using namespace RTT;
 using namespace RTT::detail;
@@ -382,5 +385,355 @@ BOOST_AUTO_TEST_CASE( testVectorTransport )
     rtos_disable_rt_warning();
 }
 
+/**
+ * Marshals directly with the serialization protocol, using the
+ * memcpy path for a double and the blob archive for a vector.
+ */
+BOOST_AUTO_TEST_CASE( testSerializationProtocol )
+{
+    char blob[1000];
+    mqueue::MQSerializationProtocol<double> dp;
+    void* dcookie = dp.createCookie();
+    ValueDataSource<double>::shared_ptr d = new ValueDataSource<double>(1.5);
+    ValueDataSource<double>::shared_ptr dr = new ValueDataSource<double>(0.0);
+    BOOST_CHECK_EQUAL( dp.getSampleSize(d, dcookie), sizeof(double) );
+    for (int i = 0; i != 2; ++i) { // second round uses the cached data sources
+        d->set( 1.5 + i );
+        std::pair<void const*,int> res = dp.fillBlob(d, blob, 1000, dcookie);
+        BOOST_CHECK( res.first == blob );
+        BOOST_CHECK_EQUAL( res.second, int(sizeof(double)) );
+        BOOST_CHECK( dp.updateFromBlob(blob, res.second, dr, dcookie) );
+        BOOST_CHECK_EQUAL( dr->rvalue(), 1.5 + i );
+    }
+    BOOST_CHECK( dp.fillBlob(d, blob, 4, dcookie).first == 0 );
+    dp.deleteCookie(dcookie);
+
+    mqueue::MQSerializationProtocol< std::vector<double> > vp;
+    void* vcookie = vp.createCookie();
+    ValueDataSource< std::vector<double> >::shared_ptr v = new ValueDataSource< std::vector<double> >( std::vector<double>(10, 6.66) );
+    ValueDataSource< std::vector<double> >::shared_ptr vr = new ValueDataSource< std::vector<double> >( std::vector<double>(10, 0.0) );
+    std::pair<void const*,int> res = vp.fillBlob(v, blob, 1000, vcookie);
+    BOOST_CHECK( res.first == blob );
+    BOOST_CHECK_EQUAL( res.second, int(vp.getSampleSize(v, vcookie)) );
+    BOOST_CHECK( vp.updateFromBlob(blob, res.second, vr, vcookie) );
+    BOOST_CHECK( vr->rvalue() == v->rvalue() );
+    vp.deleteCookie(vcookie);
+}
+
+BOOST_AUTO_TEST_CASE( testManyStreams )
+{
+    // all receiving queues are watched by the same dispatcher.
+    const int count = 32;
+    std::vector< InputPort<double>* > ins;
+    std::vector< OutputPort<double>* > outs;
+    policy.type = ConnPolicy::DATA;
+    policy.pull = false;
+    for (int i = 0; i != count; ++i) {
+        ins.push_back( new InputPort<double>("in") );
+        outs.push_back( new OutputPort<double>("out") );
+        std::stringstream name;
+        name << "/many" << i;
+        policy.name_id = name.str();
+        BOOST_REQUIRE( outs[i]->createStream( policy ) );
+        BOOST_REQUIRE( ins[i]->createStream( policy ) );
+    }
+
+    for (int i = 0; i != count; ++i)
+        outs[i]->write( double(i) );
+    usleep(200000);
+    for (int i = 0; i != count; ++i) {
+        double value = -1;
+        BOOST_CHECK_EQUAL( NewData, ins[i]->read(value) );
+        BOOST_CHECK_EQUAL( double(i), value );
+    }
+
+    // the remaining queues are still dispatched after removing the others.
+    for (int i = 0; i < count; i += 2) {
+        outs[i]->disconnect();
+        ins[i]->disconnect();
+    }
+    for (int i = 1; i < count; i += 2)
+        outs[i]->write( double(count + i) );
+    usleep(200000);
+    for (int i = 1; i < count; i += 2) {
+        double value = -1;
+        BOOST_CHECK_EQUAL( NewData, ins[i]->read(value) );
+        BOOST_CHECK_EQUAL( double(count + i), value );
+    }
+
+    for (int i = 0; i != count; ++i) {
+        outs[i]->disconnect();
+        ins[i]->disconnect();
+        delete ins[i];
+        delete outs[i];
+    }
+}
+
+/**
+ * Packs several samples in one message, which is sent when it is
+ * full or when it gets older than the batch period.
+ */
+BOOST_AUTO_TEST_CASE( testBatchedStream )
+{
+    InputPort<double> in("in");
+    OutputPort<double> out("out");
+    policy.type = ConnPolicy::BUFFER;
+    policy.pull = false;
+    policy.size = 10;
+    policy.name_id = "/batch1";
+    policy.batch_size = 4;
+    policy.batch_period = 0.5;
+    BOOST_REQUIRE( out.createStream( policy ) );
+    BOOST_REQUIRE( in.createStream( policy ) );
+
+    double value = -1;
+    for (int i = 1; i != 4; ++i)
+        out.write( double(i) );
+    usleep(50000);
+    BOOST_CHECK_EQUAL( NoData, in.read(value) );
+
+    // the fourth sample completes the batch.
+    out.write( 4.0 );
+    usleep(200000);
+    for (int i = 1; i != 5; ++i) {
+        BOOST_CHECK_EQUAL( NewData, in.read(value) );
+        BOOST_CHECK_EQUAL( double(i), value );
+    }
+    BOOST_CHECK_EQUAL( OldData, in.read(value) );
+
+    // an incomplete batch is sent by the dispatcher after the batch period.
+    out.write( 5.0 );
+    out.write( 6.0 );
+    usleep(1000000);
+    for (int i = 5; i != 7; ++i) {
+        BOOST_CHECK_EQUAL( NewData, in.read(value) );
+        BOOST_CHECK_EQUAL( double(i), value );
+    }
+
+    out.disconnect();
+    in.disconnect();
+}
+
+/**
+ * All samples of the first batch are delivered: the first one
+ * initializes the channel, like the first message does without
+ * batching, and the others are forwarded.
+ */
+BOOST_AUTO_TEST_CASE( testBatchedInitialSample )
+{
+    mqueue::MQTemplateProtocol<double> transport;
+    policy.type = ConnPolicy::BUFFER;
+    policy.pull = false;
+    policy.size = 10;
+    policy.name_id = "/batchinit1";
+    policy.batch_size = 4;
+    policy.batch_period = 0.0;
+    base::ChannelElement<double>::shared_ptr sender = new mqueue::MQChannelElement<double>(mw1, transport, policy, true);
+    // the initial sample flushes the samples batched before it.
+    BOOST_CHECK_EQUAL( WriteSuccess, sender->write(1.0) );
+    BOOST_CHECK_EQUAL( WriteSuccess, sender->write(2.0) );
+    BOOST_CHECK_EQUAL( WriteSuccess, sender->data_sample(3.0) );
+
+    base::ChannelElement<double>::shared_ptr receiver = new mqueue::MQChannelElement<double>(mr1, transport, policy, false);
+    base::ChannelElement<double>::shared_ptr buffer =
+        RTT::detail::DataSourceTypeInfo<double>::getTypeInfo()->buildDataStorage(policy)->narrow<double>();
+    BOOST_REQUIRE( receiver->inputReady(buffer) );
+    BOOST_CHECK_EQUAL( 1.0, buffer->data_sample() );
+
+    double value = -1;
+    BOOST_CHECK_EQUAL( NewData, buffer->read(value) );
+    BOOST_CHECK_EQUAL( 2.0, value );
+    BOOST_CHECK_EQUAL( NewData, buffer->read(value) );
+    BOOST_CHECK_EQUAL( 3.0, value );
+    BOOST_CHECK_EQUAL( OldData, buffer->read(value) );
+}
+
+/**
+ * Reads \a in until the reply to one of its requests brought new data.
+ * A pull reader never waits for the writer, such that the first read
+ * after a write only asks for the new samples.
+ */
+static FlowStatus readPulled(InputPort<double>& in, double& value)
+{
+    FlowStatus result = in.read(value);
+    for (int i = 0; i != 100 && result != NewData; ++i) {
+        usleep(10000);
+        result = in.read(value);
+    }
+    return result;
+}
+
+/**
+ * Lets the reader pull the samples, such that the writer only sends
+ * the samples which are read.
+ */
+BOOST_AUTO_TEST_CASE( testPullStream )
+{
+    InputPort<double> in("in");
+    OutputPort<double> out("out");
+    policy.type = ConnPolicy::DATA;
+    policy.pull = true;
+    policy.name_id = "/pull1";
+    BOOST_REQUIRE( out.createStream( policy ) );
+    BOOST_REQUIRE( in.createStream( policy ) );
+
+    // a data connection returns the latest sample only.
+    double value = -1;
+    BOOST_CHECK_EQUAL( NoData, in.read(value) );
+    for (int i = 1; i != 101; ++i)
+        out.write( double(i) );
+    BOOST_CHECK_EQUAL( NewData, readPulled(in, value) );
+    BOOST_CHECK_EQUAL( 100.0, value );
+    BOOST_CHECK_EQUAL( OldData, in.read(value) );
+    BOOST_CHECK_EQUAL( 100.0, value );
+    out.write( 101.0 );
+    BOOST_CHECK_EQUAL( NewData, readPulled(in, value) );
+    BOOST_CHECK_EQUAL( 101.0, value );
+    out.disconnect();
+    in.disconnect();
+
+    // a buffer connection returns the samples in order, over several requests.
+    policy.type = ConnPolicy::BUFFER;
+    policy.size = 8;
+    policy.name_id = "/pull2";
+    BOOST_REQUIRE( out.createStream( policy ) );
+    BOOST_REQUIRE( in.createStream( policy ) );
+    for (int i = 1; i != 9; ++i)
+        out.write( double(i) );
+    for (int i = 1; i != 9; ++i) {
+        BOOST_CHECK_EQUAL( NewData, readPulled(in, value) );
+        BOOST_CHECK_EQUAL( double(i), value );
+    }
+    BOOST_CHECK_EQUAL( OldData, in.read(value) );
+    out.disconnect();
+    in.disconnect();
+
+    // batched replies.
+    policy.name_id = "/pull3";
+    policy.batch_size = 4;
+    policy.batch_period = 0.0;
+    BOOST_REQUIRE( out.createStream( policy ) );
+    BOOST_REQUIRE( in.createStream( policy ) );
+    for (int i = 1; i != 7; ++i)
+        out.write( double(i) );
+    for (int i = 1; i != 7; ++i) {
+        BOOST_CHECK_EQUAL( NewData, readPulled(in, value) );
+        BOOST_CHECK_EQUAL( double(i), value );
+    }
+    BOOST_CHECK_EQUAL( OldData, in.read(value) );
+    out.disconnect();
+    in.disconnect();
+
+    // a queue of one message has no room for the end of a reply, which
+    // the writer sends as soon as the reader took the sample. The reader
+    // need not wait for its request to time out before it asks again.
+    policy.name_id = "/pull4";
+    policy.size = 1;
+    policy.batch_size = 0;
+    BOOST_REQUIRE( out.createStream( policy ) );
+    BOOST_REQUIRE( in.createStream( policy ) );
+    for (int i = 1; i != 4; ++i) {
+        out.write( double(i) );
+        FlowStatus result = in.read(value);
+        for (int j = 0; j != 20 && result != NewData; ++j) {
+            usleep(10000);
+            result = in.read(value);
+        }
+        BOOST_CHECK_EQUAL( NewData, result );
+        BOOST_CHECK_EQUAL( double(i), value );
+    }
+    out.disconnect();
+    in.disconnect();
+}
+
+/**
+ * Sends samples which are larger than the message size of the queue,
+ * by resizing the queue or by fragmenting the samples.
+ */
+BOOST_AUTO_TEST_CASE( testLargeSamples )
+{
+    std::vector<double> data(10, 1.0);
+    InputPort< std::vector<double> > vin("VIn");
+    OutputPort< std::vector<double> > vout("VOut");
+    vout.setDataSample( data );
+
+    policy.type = ConnPolicy::BUFFER;
+    policy.pull = false;
+    policy.size = 10;
+    policy.name_id = "/large1";
+    BOOST_REQUIRE( vout.createStream( policy ) );
+    BOOST_REQUIRE( vin.createStream( policy ) );
+
+    // 200 doubles do not fit in the queue, which is resized.
+    // 5000 doubles exceed the system limit and are fragmented.
+    int sizes[] = { 200, 5000, 20 };
+    for (int i = 0; i != 3; ++i) {
+        data.assign( sizes[i], i + 2.0 );
+        vout.write( data );
+        usleep(200000);
+        std::vector<double> result;
+        BOOST_CHECK_EQUAL( NewData, vin.read(result) );
+        BOOST_CHECK( result == data );
+    }
+    vout.disconnect();
+    vin.disconnect();
+
+    // a batch is sent before a fragmented sample.
+    policy.name_id = "/large2";
+    policy.batch_size = 4;
+    policy.batch_period = 0.1;
+    data.assign( 10, 1.0 );
+    vout.setDataSample( data );
+    BOOST_REQUIRE( vout.createStream( policy ) );
+    BOOST_REQUIRE( vin.createStream( policy ) );
+    for (int i = 0; i != 3; ++i) {
+        data.assign( sizes[i], i + 2.0 );
+        vout.write( data );
+    }
+    usleep(400000);
+    for (int i = 0; i != 3; ++i) {
+        std::vector<double> result;
+        BOOST_CHECK_EQUAL( NewData, vin.read(result) );
+        BOOST_CHECK_EQUAL( result.size(), sizes[i] );
+        BOOST_CHECK_EQUAL( result.back(), i + 2.0 );
+    }
+    vout.disconnect();
+    vin.disconnect();
+}
+
+/**
+ * Samples which grow faster than the receiver reads resize the queue
+ * several times before the receiver follows the first resize.
+ */
+BOOST_AUTO_TEST_CASE( testBackToBackResizes )
+{
+    std::vector<double> data(10, 1.0);
+    InputPort< std::vector<double> > vin("VIn");
+    OutputPort< std::vector<double> > vout("VOut");
+    vout.setDataSample( data );
+
+    policy.type = ConnPolicy::BUFFER;
+    policy.pull = false;
+    policy.size = 10;
+    policy.name_id = "/resize1";
+    BOOST_REQUIRE( vout.createStream( policy ) );
+    BOOST_REQUIRE( vin.createStream( policy ) );
+
+    int sizes[] = { 20, 50, 100, 200, 400, 800 };
+    for (int i = 0; i != 6; ++i) {
+        data.assign( sizes[i], i + 2.0 );
+        vout.write( data );
+    }
+    usleep(200000);
+    for (int i = 0; i != 6; ++i) {
+        std::vector<double> result;
+        BOOST_REQUIRE_EQUAL( NewData, vin.read(result) );
+        BOOST_CHECK_EQUAL( result.size(), sizes[i] );
+        BOOST_CHECK_EQUAL( result.back(), i + 2.0 );
+    }
+    vout.disconnect();
+    vin.disconnect();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,97 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "unit.hpp"
+
+#include <rtt/Operation.hpp>
+#include <rtt/OperationCaller.hpp>
+#include <rtt/TaskContext.hpp>
+#include <rtt/internal/GlobalEngine.hpp>
+#include <rtt/os/Atomic.hpp>
+#include <rtt/os/TimeService.hpp>
+
+#include <iostream>
+#include <unistd.h>
+#include <sys/resource.h>
+
+using namespace RTT;
+
+/**
+ * Measures the throughput of operations which are executed in the
+ * thread of the component that provides them (OwnThread).
+ */
+class OperationPerformanceTest
+{
+public:
+    TaskContext server;
+    os::AtomicInt counter;
+    OperationCaller<void(void)> count;
+
+    OperationPerformanceTest()
+        : server("Server"), count("count")
+    {
+        server.provides()->addOperation("count", &OperationPerformanceTest::doCount, this, OwnThread);
+        // room for all messages of testSendThroughput, senders never allocate.
+        server.engine()->setQueueCapacity(ExecutionEngine::MessageQueue, 100000);
+        count = server.provides()->getOperation("count");
+        count.setCaller(internal::GlobalEngine::Instance());
+        BOOST_REQUIRE( server.start() );
+    }
+
+    ~OperationPerformanceTest()
+    {
+        server.stop();
+    }
+
+    void doCount() { counter.inc(); }
+
+    // Reports the rate of \a n operations which took from \a start until now
+    // and the context switches of the process since \a before.
+    void report(const char* what, int n, os::TimeService::ticks start, struct rusage const& before)
+    {
+        Seconds elapsed = os::TimeService::Instance()->secondsSince(start);
+        struct rusage after;
+        getrusage(RUSAGE_SELF, &after);
+        std::cout << " * " << what << ": " << n << " in " << elapsed << " s (" << (elapsed > 0 ? n / elapsed : 0.0) << "/s), "
+                  << "context switches: " << (after.ru_nvcsw - before.ru_nvcsw) << " voluntary, "
+                  << (after.ru_nivcsw - before.ru_nivcsw) << " involuntary" << std::endl;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE( OperationPerformanceTestSuite, OperationPerformanceTest )
+
+BOOST_AUTO_TEST_CASE( testSendThroughput )
+{
+    const int number_of_sends = 100000;
+    struct rusage before;
+    getrusage(RUSAGE_SELF, &before);
+    os::TimeService::ticks start = os::TimeService::Instance()->getTicks();
+    for (int i = 0; i < number_of_sends; ++i)
+        count.send();
+    report("send() enqueued", number_of_sends, start, before);
+    for (int i = 0; i < 10000 && counter.read() < number_of_sends; ++i)
+        usleep(1000);
+    report("send() executed", number_of_sends, start, before);
+    std::cout << "   Message queue: " << server.engine()->getQueueStatistics(ExecutionEngine::MessageQueue) << std::endl;
+    BOOST_CHECK_EQUAL( counter.read(), number_of_sends );
+}
+
+BOOST_AUTO_TEST_CASE( testCallThroughput )
+{
+    const int number_of_calls = 10000;
+    struct rusage before;
+    getrusage(RUSAGE_SELF, &before);
+    os::TimeService::ticks start = os::TimeService::Instance()->getTicks();
+    for (int i = 0; i < number_of_calls; ++i)
+        count.call();
+    report("call() executed", number_of_calls, start, before);
+    BOOST_CHECK_EQUAL( counter.read(), number_of_calls );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
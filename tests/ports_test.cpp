@@ -374,6 +374,117 @@ BOOST_AUTO_TEST_CASE(testPortOneWriterThreeReaders)
     BOOST_CHECK_EQUAL( rp3.read(value), NoData );
 }
 
+BOOST_AUTO_TEST_CASE(testPortZeroCopyConnections)
+{
+    typedef std::vector<double> Sample;
+    OutputPort<Sample> wp("W", /* keep_last_written_value = */ false);
+    ConnPolicy zero_copy_data = ConnPolicy::data();
+    zero_copy_data.zero_copy = true;
+    ConnPolicy zero_copy_buffer = ConnPolicy::buffer(4);
+    zero_copy_buffer.zero_copy = true;
+    InputPort<Sample> rp1("R1", zero_copy_data);
+    InputPort<Sample> rp2("R2", zero_copy_buffer);
+    InputPort<Sample> rp3("R3", ConnPolicy::data());
+
+    BOOST_REQUIRE( wp.createConnection(rp1) );
+    BOOST_REQUIRE( wp.createConnection(rp2) );
+    BOOST_REQUIRE( wp.createConnection(rp3) );
+
+    // a published sample is shared by all zero-copy connections
+    OutputPort<Sample>::LoanedSample loaned = wp.loan();
+    BOOST_REQUIRE( loaned );
+    loaned->value().assign(100, 1.0);
+    const Sample* published = &loaned->value();
+    BOOST_CHECK_EQUAL( wp.publish(loaned), WriteSuccess );
+    BOOST_CHECK( !loaned );
+
+    InputPort<Sample>::SampleView view1, view2, view3;
+    BOOST_CHECK_EQUAL( rp1.take(view1), NewData );
+    BOOST_CHECK_EQUAL( rp2.take(view2), NewData );
+    BOOST_REQUIRE( view1 );
+    BOOST_REQUIRE( view2 );
+    BOOST_CHECK_EQUAL( &view1->value(), published );
+    BOOST_CHECK_EQUAL( &view2->value(), published );
+    BOOST_CHECK_EQUAL( view1->value().size(), 100u );
+
+    // other connections receive a copy
+    BOOST_CHECK_EQUAL( rp3.take(view3), NewData );
+    BOOST_REQUIRE( view3 );
+    BOOST_CHECK( &view3->value() != published );
+    BOOST_CHECK( view3->value() == view1->value() );
+
+    BOOST_CHECK_EQUAL( rp1.take(view1), OldData );
+    BOOST_CHECK_EQUAL( rp2.take(view2), OldData );
+    BOOST_CHECK_EQUAL( &view1->value(), published );
+
+    // write() and read() copy samples in and out of zero-copy connections
+    Sample sample(10, 2.0), result;
+    BOOST_CHECK_EQUAL( wp.write(sample), WriteSuccess );
+    BOOST_CHECK_EQUAL( rp1.read(result), NewData );
+    BOOST_CHECK( result == sample );
+    BOOST_CHECK_EQUAL( rp2.read(result), NewData );
+    BOOST_CHECK( result == sample );
+    BOOST_CHECK_EQUAL( rp3.read(result), NewData );
+    BOOST_CHECK( result == sample );
+}
+
+BOOST_AUTO_TEST_CASE(testPortConnectionStatistics)
+{
+    OutputPort<double> wp("W");
+    ConnPolicy buffer_policy = ConnPolicy::buffer(2);
+    buffer_policy.statistics = true;
+    ConnPolicy data_policy = ConnPolicy::data();
+    data_policy.statistics = true;
+    InputPort<double> rp1("R1", buffer_policy);
+    InputPort<double> rp2("R2", data_policy);
+    InputPort<double> rp3("R3", ConnPolicy::data());
+
+    BOOST_REQUIRE( wp.createConnection(rp1) );
+    BOOST_REQUIRE( wp.createConnection(rp2) );
+    BOOST_REQUIRE( wp.createConnection(rp3) );
+    BOOST_CHECK_EQUAL( wp.getConnectionStatistics().size(), 2u );
+    BOOST_REQUIRE_EQUAL( rp1.getConnectionStatistics().size(), 1u );
+    BOOST_REQUIRE_EQUAL( rp2.getConnectionStatistics().size(), 1u );
+    BOOST_CHECK_EQUAL( rp3.getConnectionStatistics().size(), 0u );
+
+    // the third sample does not fit into the buffer
+    BOOST_CHECK_EQUAL( wp.write(1.0), WriteSuccess );
+    BOOST_CHECK_EQUAL( wp.write(2.0), WriteSuccess );
+    BOOST_CHECK_EQUAL( wp.write(3.0), WriteFailure );
+
+    double value;
+    BOOST_CHECK_EQUAL( rp1.read(value), NewData );
+    BOOST_CHECK_EQUAL( rp1.read(value), NewData );
+    BOOST_CHECK_EQUAL( rp1.read(value), OldData );
+    BOOST_CHECK_EQUAL( rp2.read(value), NewData );
+    BOOST_CHECK_EQUAL( rp2.read(value), OldData );
+
+    internal::ConnectionStatistics::shared_ptr buffer_stats = rp1.getConnectionStatistics().front();
+    BOOST_CHECK_EQUAL( buffer_stats->getWrites(), 3 );
+    BOOST_CHECK_EQUAL( buffer_stats->getReads(), 2 );
+    BOOST_CHECK_EQUAL( buffer_stats->getDrops(), 1 );
+    BOOST_CHECK_EQUAL( buffer_stats->getNotConnected(), 0 );
+    BOOST_CHECK_EQUAL( buffer_stats->getFillLevel(), 0 );
+    BOOST_CHECK_EQUAL( buffer_stats->getHighWatermark(), 2 );
+
+    internal::ConnectionStatistics::shared_ptr data_stats = rp2.getConnectionStatistics().front();
+    BOOST_CHECK_EQUAL( data_stats->getWrites(), 3 );
+    BOOST_CHECK_EQUAL( data_stats->getReads(), 1 );
+    BOOST_CHECK_EQUAL( data_stats->getDrops(), 0 );
+    BOOST_CHECK_EQUAL( data_stats->getHighWatermark(), 1 );
+
+    // every sample that was read has its latency recorded
+    int latencies = 0;
+    for (unsigned int i = 0; i < internal::ConnectionStatistics::LatencyBuckets; ++i)
+        latencies += buffer_stats->getLatencyCount(i);
+    BOOST_CHECK_EQUAL( latencies, 2 );
+
+    BOOST_CHECK( !wp.reportConnectionStatistics().empty() );
+    wp.resetConnectionStatistics();
+    BOOST_CHECK_EQUAL( buffer_stats->getWrites(), 0 );
+    BOOST_CHECK_EQUAL( data_stats->getReads(), 0 );
+}
+
 BOOST_AUTO_TEST_CASE(testPortOneWriterThreeReadersWithSharedOutputBuffer)
 {
     ConnPolicy cp = ConnPolicy::buffer(4);
@@ -0,0 +1,297 @@
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "unit.hpp"
+
+#include <transports/shm/SHMLib.hpp>
+#include <transports/shm/SHMChannelElement.hpp>
+#include <transports/shm/SHMTemplateProtocol.hpp>
+#include <os/fosi.h>
+#include <sys/mman.h>
+
+#include <InputPort.hpp>
+#include <OutputPort.hpp>
+#include <TaskContext.hpp>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace RTT;
+using namespace RTT::detail;
+
+class SHMTest
+{
+public:
+    SHMTest()
+    {
+        mr = new InputPort<double>("mr");
+        mw = new OutputPort<double>("mw");
+
+        // both tc's are non periodic
+        tc =  new TaskContext( "root" );
+        tc->ports()->addPort( *mw );
+
+        t2 = new TaskContext("other");
+        t2->ports()->addEventPort( *mr, boost::bind(&SHMTest::new_data_listener, this, _1) );
+
+        tc->start();
+        t2->start();
+
+        policy.init = false;
+        policy.lock_policy = ConnPolicy::LOCK_FREE;
+        policy.size = 0;
+        policy.transport = ORO_SHM_PROTOCOL_ID;
+    }
+
+    ~SHMTest()
+    {
+        delete tc;
+        delete t2;
+
+        delete mr;
+        delete mw;
+    }
+
+    TaskContext* tc;
+    TaskContext* t2;
+
+    PortInterface* signalled_port;
+    void new_data_listener(PortInterface* port)
+    {
+        signalled_port = port;
+    }
+
+    InputPort<double>*  mr;
+    OutputPort<double>* mw;
+
+    ConnPolicy policy;
+
+    void testPortDataConnection();
+    void testPortBufferConnection();
+    void testPortDisconnected();
+};
+
+#define ASSERT_PORT_SIGNALLING(code, read_port) do { \
+    signalled_port = 0; \
+    code; \
+    rtos_disable_rt_warning(); \
+    usleep(100000); \
+    rtos_enable_rt_warning(); \
+    BOOST_CHECK( read_port == signalled_port ); \
+} while(0)
+
+void SHMTest::testPortDataConnection()
+{
+    rtos_enable_rt_warning();
+    BOOST_CHECK( mw->connected() );
+    BOOST_CHECK( mr->connected() );
+
+    double value = 0;
+
+    // Check if no-data works
+    BOOST_CHECK( NoData == mr->read(value) );
+
+    // Check if writing works (including signalling)
+    ASSERT_PORT_SIGNALLING(mw->write(1.0), mr);
+    BOOST_CHECK( mr->read(value) );
+    BOOST_CHECK_EQUAL( 1.0, value );
+    ASSERT_PORT_SIGNALLING(mw->write(2.0), mr);
+    BOOST_CHECK( mr->read(value) );
+    BOOST_CHECK_EQUAL( 2.0, value );
+    BOOST_CHECK( OldData == mr->read(value) );
+
+    rtos_disable_rt_warning();
+}
+
+void SHMTest::testPortBufferConnection()
+{
+    rtos_enable_rt_warning();
+    // This test assumes that there is a buffer connection mw => mr of size 3
+    BOOST_CHECK( mw->connected() );
+    BOOST_CHECK( mr->connected() );
+
+    double value = 0;
+
+    // Check if no-data works
+    BOOST_CHECK( NoData == mr->read(value) );
+
+    // Check if writing works
+    ASSERT_PORT_SIGNALLING(mw->write(1.0), mr);
+    ASSERT_PORT_SIGNALLING(mw->write(2.0), mr);
+    ASSERT_PORT_SIGNALLING(mw->write(3.0), mr);
+    ASSERT_PORT_SIGNALLING(mw->write(4.0), 0);  // because size == 3
+    BOOST_CHECK( mr->read(value) );
+    BOOST_CHECK_EQUAL( 1.0, value );
+    BOOST_CHECK( mr->read(value) );
+    BOOST_CHECK_EQUAL( 2.0, value );
+    BOOST_CHECK( mr->read(value) );
+    BOOST_CHECK_EQUAL( 3.0, value );
+    BOOST_CHECK( OldData == mr->read(value) );
+
+    rtos_disable_rt_warning();
+}
+
+void SHMTest::testPortDisconnected()
+{
+    BOOST_CHECK( !mw->connected() );
+    BOOST_CHECK( !mr->connected() );
+}
+
+BOOST_FIXTURE_TEST_SUITE(  SHMTestSuite,  SHMTest )
+
+BOOST_AUTO_TEST_CASE( testPortConnections )
+{
+    policy.type = ConnPolicy::DATA;
+    policy.pull = true;
+    policy.name_id = "/shmdata1";
+    BOOST_REQUIRE( mw->createConnection(*mr, policy) );
+    BOOST_CHECK( policy.name_id == "/shmdata1" );
+    testPortDataConnection();
+    mw->disconnect();
+    mr->disconnect();
+    testPortDisconnected();
+
+    policy.type = ConnPolicy::BUFFER;
+    policy.pull = false;
+    policy.size = 3;
+    policy.name_id = "";
+    BOOST_REQUIRE( mw->createConnection(*mr, policy) );
+    testPortBufferConnection();
+    mw->disconnect();
+    mr->disconnect();
+    testPortDisconnected();
+}
+
+BOOST_AUTO_TEST_CASE( testPortStreams )
+{
+    policy.type = ConnPolicy::DATA;
+    policy.pull = false;
+    policy.name_id = "/shmdata1";
+    BOOST_REQUIRE( mw->createStream( policy ) );
+    BOOST_REQUIRE( mr->createStream( policy ) );
+    testPortDataConnection();
+    mw->disconnect();
+    mr->disconnect();
+    testPortDisconnected();
+
+    policy.type = ConnPolicy::BUFFER;
+    policy.pull = true;
+    policy.size = 3;
+    policy.name_id = "/shmbuffer1";
+    BOOST_REQUIRE( mw->createStream( policy ) );
+    BOOST_REQUIRE( mr->createStream( policy ) );
+    testPortBufferConnection();
+    mw->disconnect();
+    mr->disconnect();
+    testPortDisconnected();
+}
+
+BOOST_AUTO_TEST_CASE( testPortStreamsTimeout )
+{
+    // Test creating an input stream without an output stream available.
+    policy.type = ConnPolicy::DATA;
+    policy.pull = false;
+    policy.name_id = "/shmtimeout1";
+    BOOST_REQUIRE( mr->createStream( policy ) == false );
+    BOOST_CHECK( mr->connected() == false );
+    mr->disconnect();
+    shm_unlink("/shmtimeout1");
+    unlink("/dev/shm/shmtimeout1.wake");
+
+    // Test creating a stream with a wrong name
+    policy.name_id = "shmdata1";
+    BOOST_REQUIRE( mw->createStream( policy ) == false );
+    BOOST_CHECK( mw->connected() == false );
+}
+
+/**
+ * Samples written faster than they are read are kept in the ring
+ * and are forwarded in order.
+ */
+BOOST_AUTO_TEST_CASE( testRingBurst )
+{
+    policy.type = ConnPolicy::BUFFER;
+    policy.pull = false;
+    policy.size = 50;
+    policy.name_id = "/shmburst1";
+    BOOST_REQUIRE( mw->createStream( policy ) );
+    BOOST_REQUIRE( mr->createStream( policy ) );
+
+    for (int i = 0; i != 50; ++i)
+        mw->write( double(i) );
+    rtos_disable_rt_warning();
+    usleep(100000);
+
+    double value = -1;
+    for (int i = 0; i != 50; ++i) {
+        BOOST_REQUIRE_EQUAL( NewData, mr->read(value) );
+        BOOST_CHECK_EQUAL( double(i), value );
+    }
+    BOOST_CHECK( OldData == mr->read(value) );
+    mw->disconnect();
+    mr->disconnect();
+    testPortDisconnected();
+}
+
+/**
+ * Types with a boost::serialization function are marshalled in their
+ * slot, and the rings of all connections are served by one dispatcher.
+ */
+BOOST_AUTO_TEST_CASE( testSerializedStreams )
+{
+    InputPort< std::vector<double> > vr("vr");
+    OutputPort< std::vector<double> > vw("vw");
+    tc->ports()->addPort( vw );
+    t2->ports()->addEventPort( vr );
+    vw.setDataSample( std::vector<double>(10, 0.0) );
+
+    policy.type = ConnPolicy::BUFFER;
+    policy.pull = false;
+    policy.size = 5;
+    policy.name_id = "/shmdouble1";
+    BOOST_REQUIRE( mw->createStream( policy ) );
+    BOOST_REQUIRE( mr->createStream( policy ) );
+
+    ConnPolicy vpolicy = policy;
+    vpolicy.name_id = "/shmvector1";
+    vpolicy.data_size = 1024;
+    BOOST_REQUIRE( vw.createStream( vpolicy ) );
+    BOOST_REQUIRE( vr.createStream( vpolicy ) );
+
+    std::vector<double> sample(10);
+    for (int i = 0; i != 3; ++i) {
+        for (unsigned int j = 0; j != sample.size(); ++j)
+            sample[j] = i * 100 + j;
+        vw.write( sample );
+        mw->write( double(i) );
+    }
+    rtos_disable_rt_warning();
+    usleep(100000);
+
+    std::vector<double> vvalue;
+    double value = -1;
+    for (int i = 0; i != 3; ++i) {
+        BOOST_REQUIRE_EQUAL( NewData, vr.read(vvalue) );
+        BOOST_REQUIRE_EQUAL( vvalue.size(), 10u );
+        for (unsigned int j = 0; j != vvalue.size(); ++j)
+            BOOST_CHECK_EQUAL( vvalue[j], double(i * 100 + j) );
+        BOOST_REQUIRE_EQUAL( NewData, mr->read(value) );
+        BOOST_CHECK_EQUAL( double(i), value );
+    }
+    BOOST_CHECK( OldData == vr.read(vvalue) );
+    vw.disconnect();
+    vr.disconnect();
+    mw->disconnect();
+    mr->disconnect();
+    testPortDisconnected();
+    tc->ports()->removePort("vw");
+    t2->ports()->removePort("vr");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
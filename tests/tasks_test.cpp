@@ -23,11 +23,20 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <vector>
 
 #include <extras/PeriodicActivity.hpp>
+#include <extras/ThreadPoolActivity.hpp>
+#include <TaskContext.hpp>
+#include <OperationCaller.hpp>
+#include <internal/GlobalEngine.hpp>
+#include <os/Atomic.hpp>
 #include <os/TimeService.hpp>
+#include <os/CpuSet.hpp>
+#include <os/MainThread.hpp>
+#include <os/Thread.hpp>
 #include <Logger.hpp>
 
 #include <boost/scoped_ptr.hpp>
@@ -248,6 +257,49 @@ struct TestSelfRemove
     }
 };
 
+/**
+ * Counts its executions in a ThreadPoolActivity and checks
+ * that it is never executed by two workers at once.
+ */
+struct TestPoolRunnable
+    : public RunnableInterface
+{
+    os::AtomicInt triggers, timeouts, executing, overlaps, not_self;
+
+    bool initialize() { return true; }
+    void finalize() {}
+
+    void step() {
+        if ( executing.read() != 0 )
+            overlaps.inc();
+        executing.inc();
+        if ( !this->getThread()->isSelf() )
+            not_self.inc();
+        usleep(100);
+        executing.dec();
+    }
+
+    void work(RunnableInterface::WorkReason reason) {
+        if (reason == RunnableInterface::TimeOut)
+            timeouts.inc();
+        else
+            triggers.inc();
+    }
+};
+
+/**
+ * Counts its steps in a PeriodicActivity.
+ */
+struct TestCountSteps
+    : public RunnableInterface
+{
+    os::AtomicInt steps;
+
+    bool initialize() { return true; }
+    void step() { steps.inc(); }
+    void finalize() {}
+};
+
 void
 ActivitiesTest::setUp()
 {
@@ -466,6 +518,93 @@ BOOST_AUTO_TEST_CASE( testAffinity )
 
 #endif
 
+BOOST_AUTO_TEST_CASE( testCpuSet )
+{
+    os::CpuSet cpus;
+    BOOST_CHECK( cpus.none() );
+    BOOST_CHECK( cpus.set(0) );
+    BOOST_CHECK( cpus.set(40) );
+    BOOST_CHECK( cpus.set(os::CpuSet::MaxCpus - 1) );
+    BOOST_CHECK( !cpus.set(os::CpuSet::MaxCpus) );
+    BOOST_CHECK_EQUAL( 3u, cpus.count() );
+    BOOST_CHECK( cpus.test(40) );
+    BOOST_CHECK( !cpus.fitsMask() );
+    BOOST_CHECK_EQUAL( 1u, cpus.toMask() );
+    BOOST_CHECK_EQUAL( "0,40,1023", cpus.toString() );
+
+    BOOST_CHECK( cpus.fromString("0-3,8,95-96\n") );
+    BOOST_CHECK_EQUAL( 7u, cpus.count() );
+    BOOST_CHECK_EQUAL( "0-3,8,95-96", cpus.toString() );
+    BOOST_CHECK( !cpus.fromString("3-1") );
+    BOOST_CHECK( !cpus.fromString("1,x") );
+    BOOST_CHECK( !cpus.fromString("2048") );
+    BOOST_CHECK_EQUAL( "0-3,8,95-96", cpus.toString() );
+
+    BOOST_CHECK_EQUAL( os::CpuSet(0x13u), cpus.fromString("0-1,4") ? cpus : os::CpuSet() );
+    BOOST_CHECK( cpus.fitsMask() );
+    BOOST_CHECK_EQUAL( 0x13u, cpus.toMask() );
+}
+
+#if defined( OROCOS_TARGET_GNULINUX )
+BOOST_AUTO_TEST_CASE( testCpuSetAffinity )
+{
+    os::CpuSet allowed = os::MainThread::Instance()->getCpuSet();
+    BOOST_REQUIRE( !allowed.none() );
+    unsigned int lastCPU = os::CpuSet::MaxCpus - 1;
+    while ( !allowed.test(lastCPU) )
+        --lastCPU;
+    os::CpuSet cpus;
+    cpus.set(lastCPU);
+
+    boost::scoped_ptr<Activity> t( new Activity(ORO_SCHED_OTHER, os::LowestPriority, 0.0, cpus, 0, "CpuSetThread") );
+    BOOST_CHECK_EQUAL( cpus, t->getCpuSet() );
+    if ( lastCPU < 32 ) {
+        BOOST_CHECK_EQUAL( 1u << lastCPU, t->getCpuAffinity() );
+    }
+
+    // an empty set allows all cpus again.
+    BOOST_CHECK( t->setCpuSet(os::CpuSet()) );
+    BOOST_CHECK_EQUAL( allowed, t->getCpuSet() );
+
+    // a periodic activity shares the TimerThread with the same cpus.
+    extras::PeriodicActivity p1(ORO_SCHED_OTHER, os::LowestPriority, 0.1, cpus);
+    extras::PeriodicActivity p2(ORO_SCHED_OTHER, os::LowestPriority, 0.1, cpus);
+    BOOST_CHECK_EQUAL( cpus, p1.getCpuSet() );
+    BOOST_CHECK_EQUAL( p1.thread(), p2.thread() );
+}
+
+BOOST_AUTO_TEST_CASE( testNumaNode )
+{
+    os::CpuSet node0;
+    std::ifstream cpulist("/sys/devices/system/node/node0/cpulist");
+    std::string line;
+    if ( !std::getline(cpulist, line) || !node0.fromString(line) || node0.none() ) {
+        BOOST_TEST_MESSAGE("Skipping testNumaNode because there is no NUMA information.");
+        return;
+    }
+
+    TaskContext tc("numa");
+    tc.setActivity( new Activity(ORO_SCHED_OTHER, os::LowestPriority, 0.0, 0, 0, "NumaThread") );
+    BOOST_CHECK_EQUAL( -1, tc.getNumaNode() );
+    BOOST_CHECK( tc.setNumaNode(0) );
+    BOOST_CHECK_EQUAL( 0, tc.getNumaNode() );
+    // the cpus are limited to those which the process may use.
+    os::CpuSet placed = tc.getCpuSet();
+    BOOST_CHECK( !placed.none() );
+    for (unsigned int i = 0; i != os::CpuSet::MaxCpus; ++i)
+        if ( placed.test(i) )
+            BOOST_CHECK( node0.test(i) );
+    BOOST_CHECK( tc.start() );
+    BOOST_CHECK( tc.stop() );
+
+    BOOST_CHECK( !tc.setNumaNode(4095) );
+    BOOST_CHECK_EQUAL( 0, tc.getNumaNode() );
+    BOOST_CHECK( tc.setNumaNode(-1) );
+    BOOST_CHECK_EQUAL( -1, tc.getNumaNode() );
+    BOOST_CHECK_EQUAL( os::MainThread::Instance()->getCpuSet(), tc.getCpuSet() );
+}
+#endif
+
 BOOST_AUTO_TEST_CASE( testNonPeriodic )
 {
     scoped_ptr<TestRunnableInterface> t_run_int_nonper
@@ -615,6 +754,172 @@ BOOST_AUTO_TEST_CASE( testAllocation )
     testRemoveAllocate();
 }
 
+BOOST_AUTO_TEST_CASE( testTimerThreadMultiRate )
+{
+    // more activities than TimerThread reserves memory for, with periods of 1, 2 and 4 ticks.
+    const unsigned int number_of_activities = 3 * TimerThread::MAX_ACTIVITIES;
+    TimerThreadPtr tt( new TimerThread(ORO_SCHED_OTHER, os::LowestPriority, "TestTimer", 0.01) );
+    std::vector<TestCountSteps*> runnables;
+    std::vector<PeriodicActivity*> activities;
+    for (unsigned int i = 0; i != number_of_activities; ++i) {
+        runnables.push_back( new TestCountSteps() );
+        activities.push_back( new PeriodicActivity( 0.01 * (1 << (i % 3)), tt, runnables.back() ) );
+    }
+    BOOST_CHECK_EQUAL( 0.04, activities[2]->getPeriod() );
+    for (unsigned int i = 0; i != number_of_activities; ++i)
+        BOOST_CHECK( activities[i]->start() );
+    BOOST_CHECK_EQUAL( number_of_activities, tt->getActivityCount() );
+
+    usleep(500000);
+
+    for (unsigned int i = 0; i != number_of_activities; ++i)
+        BOOST_CHECK( activities[i]->stop() );
+    BOOST_CHECK_EQUAL( 0u, tt->getActivityCount() );
+
+    int steps[3] = { 0, 0, 0 };
+    for (unsigned int i = 0; i != number_of_activities; ++i) {
+        steps[i % 3] += runnables[i]->steps.read();
+        BOOST_CHECK( runnables[i]->steps.read() > 0 );
+        BOOST_CHECK( activities[i]->getMaxJitter() >= activities[i]->getMeanJitter() );
+    }
+    // the slower activities are stepped less often.
+    BOOST_CHECK( steps[0] > steps[1] );
+    BOOST_CHECK( steps[1] > steps[2] );
+
+    // stopped activities are no longer stepped.
+    int stopped = runnables[0]->steps.read();
+    usleep(50000);
+    BOOST_CHECK_EQUAL( stopped, runnables[0]->steps.read() );
+
+    for (unsigned int i = 0; i != number_of_activities; ++i) {
+        delete activities[i];
+        delete runnables[i];
+    }
+}
+
+// A periodic thread which counts its steps.
+class CountingThread : public os::Thread
+{
+public:
+    os::AtomicInt steps;
+    CountingThread() : os::Thread(ORO_SCHED_OTHER, os::LowestPriority, 0.01, 0, "CountingThread") {}
+    void step() { steps.inc(); }
+};
+
+BOOST_AUTO_TEST_CASE( testThreadStatistics )
+{
+    boost::scoped_ptr<TestCountSteps> run( new TestCountSteps() );
+    boost::scoped_ptr<Activity> t( new Activity(25, 0.01, 0, "StatsThread") );
+    t->run( run.get() );
+
+    os::ThreadStatistics stats;
+    BOOST_CHECK( !t->thread()->isStatisticsEnabled() );
+    BOOST_CHECK( t->thread()->setStatisticsEnabled(true) );
+    BOOST_CHECK( t->thread()->isStatisticsEnabled() );
+
+    BOOST_CHECK( t->start() );
+    usleep(300000);
+    BOOST_CHECK( t->stop() );
+
+    BOOST_CHECK( t->thread()->getStatistics(stats) );
+    BOOST_CHECK( stats.cycles > 0 );
+    BOOST_CHECK( stats.cycles <= (unsigned long)run->steps.read() );
+    BOOST_CHECK( stats.max_wakeup_latency >= stats.getMeanWakeupLatency() );
+    BOOST_CHECK( stats.max_step_duration >= stats.getMeanStepDuration() );
+    BOOST_CHECK( stats.max_step_duration > 0 );
+    unsigned long histogram_cycles = 0;
+    for (unsigned int i = 0; i != os::ThreadStatistics::HistogramSize; ++i)
+        histogram_cycles += stats.wakeup_histogram[i];
+    BOOST_CHECK_EQUAL( stats.cycles, histogram_cycles );
+
+    t->thread()->resetStatistics();
+    BOOST_CHECK( t->thread()->getStatistics(stats) );
+    BOOST_CHECK_EQUAL( 0ul, stats.cycles );
+
+    // the first cycle of a periodic thread has no wake-up latency and is not measured.
+    boost::scoped_ptr<CountingThread> thread( new CountingThread() );
+    BOOST_CHECK( thread->setStatisticsEnabled(true) );
+    BOOST_CHECK( thread->start() );
+    usleep(100000);
+    BOOST_CHECK( thread->stop() );
+    BOOST_CHECK( thread->getStatistics(stats) );
+    BOOST_CHECK( stats.cycles > 0 );
+    BOOST_CHECK( stats.cycles < (unsigned long)thread->steps.read() );
+
+    BOOST_CHECK_EQUAL( 0u, os::ThreadStatistics::histogramBucket(999) );
+    BOOST_CHECK_EQUAL( 1u, os::ThreadStatistics::histogramBucket(1000) );
+    BOOST_CHECK_EQUAL( 4u, os::ThreadStatistics::histogramBucket(10000) );
+    BOOST_CHECK_EQUAL( os::ThreadStatistics::HistogramSize - 1, os::ThreadStatistics::histogramBucket(Seconds_to_nsecs(10.0)) );
+
+    // the statistics of a component's activity.
+    TaskContext tc("stats");
+    tc.setActivity( new Activity(25, 0.01) );
+    BOOST_CHECK( tc.getActivity()->thread()->setStatisticsEnabled(true) );
+    BOOST_CHECK( tc.start() );
+    usleep(100000);
+    BOOST_CHECK( tc.stop() );
+    BOOST_CHECK( tc.getActivity()->thread()->getStatistics(stats) );
+    BOOST_CHECK( stats.cycles > 0 );
+}
+
+BOOST_AUTO_TEST_CASE( testThreadPoolActivity )
+{
+    const unsigned int number_of_activities = 16;
+    PoolSchedulerPtr pool( new PoolScheduler(ORO_SCHED_OTHER, os::LowestPriority, 3, "TestPool") );
+    std::vector<TestPoolRunnable*> runnables;
+    std::vector<ThreadPoolActivity*> activities;
+    for (unsigned int i = 0; i != number_of_activities; ++i) {
+        runnables.push_back( new TestPoolRunnable() );
+        activities.push_back( new ThreadPoolActivity(pool, runnables.back()) );
+        BOOST_CHECK( !activities.back()->thread()->isSelf() );
+        BOOST_CHECK( !activities.back()->trigger() );
+        BOOST_CHECK( activities.back()->start() );
+        BOOST_CHECK( !activities.back()->isPeriodic() );
+    }
+
+    // triggers of a queued activity are merged into one execution.
+    for (int round = 0; round != 100; ++round)
+        for (unsigned int i = 0; i != number_of_activities; ++i)
+            BOOST_CHECK( activities[i]->trigger() );
+    usleep(200*1000);
+    for (unsigned int i = 0; i != number_of_activities; ++i) {
+        BOOST_CHECK( runnables[i]->triggers.read() >= 1 );
+        BOOST_CHECK( runnables[i]->triggers.read() <= 100 );
+        BOOST_CHECK_EQUAL( runnables[i]->timeouts.read(), 0 );
+        BOOST_CHECK( activities[i]->timeout() );
+    }
+    usleep(200*1000);
+
+    for (unsigned int i = 0; i != number_of_activities; ++i) {
+        BOOST_CHECK( activities[i]->stop() );
+        BOOST_CHECK( !activities[i]->isActive() );
+        BOOST_CHECK( !activities[i]->trigger() );
+        BOOST_CHECK_EQUAL( runnables[i]->timeouts.read(), 1 );
+        BOOST_CHECK_EQUAL( runnables[i]->overlaps.read(), 0 );
+        BOOST_CHECK_EQUAL( runnables[i]->not_self.read(), 0 );
+        BOOST_CHECK_EQUAL( runnables[i]->executing.read(), 0 );
+        delete activities[i];
+        delete runnables[i];
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testThreadPoolActivityEngine )
+{
+    // a component executed by a pool serves OwnThread operations and can
+    // call the operations of other components of the same pool.
+    PoolSchedulerPtr pool( new PoolScheduler(ORO_SCHED_OTHER, os::LowestPriority, 2, "TestPool") );
+    TaskContext server("server");
+    server.setActivity( new ThreadPoolActivity(pool) );
+    server.provides()->addOperation("isSelf", &ExecutionEngine::isSelf, server.engine(), OwnThread);
+    OperationCaller<bool(void)> isSelf = server.provides()->getOperation("isSelf");
+    isSelf.setCaller( GlobalEngine::Instance() );
+    BOOST_CHECK( server.start() );
+    BOOST_CHECK( !server.engine()->isSelf() );
+    for (int i = 0; i != 100; ++i)
+        BOOST_CHECK( isSelf() );
+    BOOST_CHECK( server.stop() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #if defined( OROCOS_TARGET_GNULINUX ) && defined( ORO_HAVE_PTHREAD_SETNAME_NP )
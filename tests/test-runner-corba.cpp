@@ -28,6 +28,7 @@
 #include <os/StartStopManager.hpp>
 #include <transports/corba/TaskContextServer.hpp>
 #include <transports/corba/CorbaDispatcher.hpp>
+#include <transports/corba/CorbaSendDispatcher.hpp>
 
 #include "test-runner.hpp"
 #define BOOST_TEST_MAIN
@@ -103,6 +104,7 @@ public:
 	}
 	~InitOrocos(){
 	    corba::CorbaDispatcher::ReleaseAll();
+	    corba::CorbaSendDispatcher::ReleaseAll();
 	    corba::TaskContextServer::ShutdownOrb(true);
 	    corba::TaskContextServer::DestroyOrb();
 
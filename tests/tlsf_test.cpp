@@ -20,7 +20,10 @@
 
 #include "unit.hpp"
 #include <rtt/os/tlsf/tlsf.h>
+#include <rtt/os/TimeService.hpp>
 #include <signal.h>
+#include <pthread.h>
+#include <vector>
 
 void signal_handler(int sig_num){
     if(sig_num == SIGABRT){
@@ -92,6 +95,142 @@ BOOST_AUTO_TEST_CASE(testUseSecondaryMemPool){
     oro_rt_free(a);
 }
 
+BOOST_AUTO_TEST_CASE(testThreadCache){
+    struct tlsf_thread_cache_statistics before, after;
+    flush_thread_cache();
+    get_thread_cache_statistics(&before);
+    void* a = oro_rt_malloc(48);
+    BOOST_REQUIRE(a);
+    oro_rt_free(a);
+    void* b = oro_rt_malloc(40);
+    get_thread_cache_statistics(&after);
+#if TLSF_THREAD_CACHE
+    // the freed block is reused from the cache of this thread.
+    BOOST_CHECK_EQUAL(a, b);
+    BOOST_CHECK_EQUAL(after.hits, before.hits + 1);
+    BOOST_CHECK_EQUAL(after.misses, before.misses + 1);
+    BOOST_CHECK_EQUAL(after.cached, 0u);
+#endif
+    oro_rt_free(b);
+    get_thread_cache_statistics(&after);
+#if TLSF_THREAD_CACHE
+    BOOST_CHECK(after.cached > 0);
+    BOOST_CHECK(get_cached_size_mp() >= after.cached);
+#endif
+    flush_thread_cache();
+    get_thread_cache_statistics(&after);
+    BOOST_CHECK_EQUAL(after.cached, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(testFreeSize){
+    size_t largest = 0;
+    void* a = oro_rt_malloc(1000);
+    size_t free_size = get_free_size_mp(&largest);
+    BOOST_CHECK(largest <= free_size);
+    oro_rt_free(a);
+    flush_thread_cache();
+    size_t largest2 = 0;
+    BOOST_CHECK(get_free_size_mp(&largest2) >= free_size);
+    BOOST_CHECK(largest2 >= largest);
+}
+
+namespace {
+    const int Rounds = 100000;
+
+    /**
+     * Allocates and frees small blocks of several sizes, like the
+     * RT threads of a component do.
+     */
+    void* allocateAndFree(void*)
+    {
+        void* blocks[8];
+        for (int r = 0; r != Rounds; ++r) {
+            for (int i = 0; i != 8; ++i)
+                blocks[i] = oro_rt_malloc(16 + 24 * i);
+            for (int i = 0; i != 8; ++i)
+                oro_rt_free(blocks[i]);
+        }
+        return 0;
+    }
+
+    /**
+     * Frees the blocks that another thread allocated.
+     */
+    struct Handover {
+        pthread_mutex_t lock;
+        std::vector<void*> blocks;
+        bool done;
+    };
+
+    void* freeHandedOver(void* arg)
+    {
+        Handover* h = static_cast<Handover*>(arg);
+        std::vector<void*> blocks;
+        bool done = false;
+        while (!done) {
+            // once done is set, all blocks were handed over.
+            pthread_mutex_lock(&h->lock);
+            blocks.swap(h->blocks);
+            done = h->done;
+            pthread_mutex_unlock(&h->lock);
+            for (unsigned int i = 0; i != blocks.size(); ++i)
+                oro_rt_free(blocks[i]);
+            blocks.clear();
+        }
+        flush_thread_cache();
+        return 0;
+    }
+
+    double runThreads(int n)
+    {
+        std::vector<pthread_t> threads(n);
+        RTT::os::TimeService::ticks start = RTT::os::TimeService::Instance()->getTicks();
+        for (int i = 0; i != n; ++i)
+            pthread_create(&threads[i], 0, &allocateAndFree, 0);
+        for (int i = 0; i != n; ++i)
+            pthread_join(threads[i], 0);
+        return RTT::os::TimeService::Instance()->secondsSince(start);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testContention){
+    size_t used = get_used_size_mp();
+    for (int n = 1; n <= 8; n *= 2) {
+        double t = runThreads(n);
+        BOOST_TEST_MESSAGE( n << " threads: " << t * 1e9 / (n * Rounds * 8.0) << " ns per malloc/free pair." );
+    }
+    // exited threads return their cached blocks.
+#if TLSF_STATISTIC
+    BOOST_CHECK_EQUAL(get_used_size_mp(), used);
+#endif
+    (void)used;
+}
+
+BOOST_AUTO_TEST_CASE(testCrossThreadFree){
+    Handover h;
+    pthread_mutex_init(&h.lock, 0);
+    h.done = false;
+    pthread_t consumer;
+    pthread_create(&consumer, 0, &freeHandedOver, &h);
+    RTT::os::TimeService::ticks start = RTT::os::TimeService::Instance()->getTicks();
+    for (int r = 0; r != Rounds; ++r) {
+        void* p = oro_rt_malloc(64);
+        BOOST_REQUIRE(p);
+        pthread_mutex_lock(&h.lock);
+        h.blocks.push_back(p);
+        pthread_mutex_unlock(&h.lock);
+    }
+    pthread_mutex_lock(&h.lock);
+    h.done = true;
+    pthread_mutex_unlock(&h.lock);
+    pthread_join(consumer, 0);
+    double t = RTT::os::TimeService::Instance()->secondsSince(start);
+    BOOST_TEST_MESSAGE( "cross thread free: " << t * 1e9 / Rounds << " ns per malloc/free pair." );
+    pthread_mutex_destroy(&h.lock);
+    // the magazines of the freeing thread are bounded.
+    BOOST_CHECK(get_cached_size_mp() < 2 * 32 * 256);
+}
+
 BOOST_AUTO_TEST_CASE(testDoubleFree)
 {
     signal(SIGABRT,&signal_handler);
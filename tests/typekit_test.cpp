@@ -32,6 +32,8 @@
 #include <types/OperatorTypes.hpp>
 
 #include <types/SequenceTypeInfo.hpp>
+#include <types/PropertyDecomposition.hpp>
+#include <ConnPolicy.hpp>
 
 struct TypekitFixture
 {
@@ -69,4 +71,26 @@ BOOST_AUTO_TEST_CASE( testComposeDecompose )
     }
 }
 
+//! Tests that all fields of a ConnPolicy survive a decompose/compose cycle.
+BOOST_AUTO_TEST_CASE( testConnPolicyComposeDecompose )
+{
+    TypeInfo* ti = Types()->type("ConnPolicy");
+    BOOST_REQUIRE(ti);
+    ConnPolicy policy = ConnPolicy::buffer(20, ConnPolicy::LOCKED);
+    policy.zero_copy = true;
+    policy.statistics = true;
+    policy.batch_size = 4;
+    internal::ValueDataSource<ConnPolicy>::shared_ptr input = new internal::ValueDataSource<ConnPolicy>(policy);
+    internal::ValueDataSource<ConnPolicy>::shared_ptr output = new internal::ValueDataSource<ConnPolicy>();
+    PropertyBag decomposed;
+    BOOST_REQUIRE(typeDecomposition(input, decomposed));
+    BOOST_REQUIRE(ti->composeType(new internal::ValueDataSource<PropertyBag>(decomposed), output));
+    BOOST_CHECK(output->get().type == ConnPolicy::BUFFER);
+    BOOST_CHECK_EQUAL(output->get().size, 20);
+    BOOST_CHECK(output->get().lock_policy == ConnPolicy::LOCKED);
+    BOOST_CHECK(output->get().zero_copy);
+    BOOST_CHECK(output->get().statistics);
+    BOOST_CHECK_EQUAL(output->get().batch_size, 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()